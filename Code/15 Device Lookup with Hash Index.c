@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+// Define a structure with function pointers for actions
+typedef struct {
+    int id;
+    char name[20];
+    void (*action)(int);       // Main action function pointer
+    void (*timedAction)(int);  // Timed action function pointer
+    int runtimeHours;          // Assigned runtime in hours
+} Device;
+
+// Open-addressing hash index: Device.id -> position in the devices[] array
+#define EMPTY_SLOT -1
+
+typedef struct {
+    int *keys;       // Device ID stored in each slot
+    int *positions;  // Index into devices[], EMPTY_SLOT when the slot is free
+    int capacity;    // Always a power of two
+    int count;
+} DeviceIndex;
+
+// Functions for different actions
+void turnOn(int id) { printf("Device %d: Turned ON\n", id); }
+void turnOff(int id) { printf("Device %d: Turned OFF\n", id); }
+void reset(int id) { printf("Device %d: Resetting...\n", id); }
+void standby(int id) { printf("Device %d: Entering Standby Mode\n", id); }
+
+// Timed action functions
+void runFor10Hours(int id) { printf("Device %d is running for 10 hours.\n", id); }
+void runFor20Hours(int id) { printf("Device %d is running for 20 hours.\n", id); }
+void runFor30Hours(int id) { printf("Device %d is running for 30 hours.\n", id); }
+void runFor40Hours(int id) { printf("Device %d is running for 40 hours.\n", id); }
+
+// Function Prototypes
+int initDeviceIndex(DeviceIndex *index, int expectedDevices);
+void freeDeviceIndex(DeviceIndex *index);
+int buildDeviceIndex(DeviceIndex *index, Device devices[], int numDevices);
+int indexInsert(DeviceIndex *index, int id, int position);
+int indexRemove(DeviceIndex *index, int id);
+Device* findDeviceIndexed(DeviceIndex *index, Device devices[], int id);
+Device* findDeviceByID(Device devices[], int numDevices, int id);
+int renameDevice(DeviceIndex *index, Device devices[], Device *device, int newID);
+void updateDeviceID(DeviceIndex *index, Device devices[], Device *device);
+void runLookupBenchmark(void);
+
+// Mix the bits of the ID so sequential IDs spread across the table
+static inline uint32_t hashDeviceID(int id) {
+    uint32_t h = (uint32_t)id;
+    h ^= h >> 16;
+    h *= 0x7feb352dU;
+    h ^= h >> 15;
+    h *= 0x846ca68bU;
+    h ^= h >> 16;
+    return h;
+}
+
+// Allocate a table that stays at most half full for the expected device count
+int initDeviceIndex(DeviceIndex *index, int expectedDevices) {
+    int capacity = 16;
+    while (capacity < expectedDevices * 2) {
+        capacity <<= 1;
+    }
+
+    index->keys = malloc(sizeof(int) * capacity);
+    index->positions = malloc(sizeof(int) * capacity);
+    if (index->keys == NULL || index->positions == NULL) {
+        free(index->keys);
+        free(index->positions);
+        return -1;
+    }
+
+    for (int i = 0; i < capacity; i++) {
+        index->positions[i] = EMPTY_SLOT;
+    }
+    index->capacity = capacity;
+    index->count = 0;
+    return 0;
+}
+
+void freeDeviceIndex(DeviceIndex *index) {
+    free(index->keys);
+    free(index->positions);
+    index->keys = NULL;
+    index->positions = NULL;
+    index->capacity = 0;
+    index->count = 0;
+}
+
+// Grow the table and re-place every entry (only when the load factor passes 1/2)
+static int growDeviceIndex(DeviceIndex *index) {
+    DeviceIndex bigger;
+    if (initDeviceIndex(&bigger, index->capacity) != 0) return -1;
+
+    for (int i = 0; i < index->capacity; i++) {
+        if (index->positions[i] != EMPTY_SLOT) {
+            indexInsert(&bigger, index->keys[i], index->positions[i]);
+        }
+    }
+    freeDeviceIndex(index);
+    *index = bigger;
+    return 0;
+}
+
+// Build the index once for an existing device array
+int buildDeviceIndex(DeviceIndex *index, Device devices[], int numDevices) {
+    if (initDeviceIndex(index, numDevices) != 0) {
+        printf("Error: Out of memory for an index of %d devices\n", numDevices);
+        return -1;
+    }
+
+    for (int i = 0; i < numDevices; i++) {
+        int result = indexInsert(index, devices[i].id, i);
+        if (result != 0) {
+            if (result == -2) {
+                printf("Error: Out of memory growing the device index\n");
+            } else {
+                printf("Error: Duplicate device ID %d\n", devices[i].id);
+            }
+            freeDeviceIndex(index);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// Insert (id -> position), linear probing. Returns -1 if the ID is already present,
+// -2 if the table had to grow and could not.
+int indexInsert(DeviceIndex *index, int id, int position) {
+    if ((index->count + 1) * 2 > index->capacity) {
+        if (growDeviceIndex(index) != 0) return -2;
+    }
+
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t slot = hashDeviceID(id) & mask;
+
+    while (index->positions[slot] != EMPTY_SLOT) {
+        if (index->keys[slot] == id) {
+            return -1; // Duplicate ID
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    index->keys[slot] = id;
+    index->positions[slot] = position;
+    index->count++;
+    return 0;
+}
+
+// Remove an ID using backward-shift deletion, so no tombstones build up
+int indexRemove(DeviceIndex *index, int id) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t slot = hashDeviceID(id) & mask;
+
+    while (index->positions[slot] != EMPTY_SLOT && index->keys[slot] != id) {
+        slot = (slot + 1) & mask;
+    }
+    if (index->positions[slot] == EMPTY_SLOT) {
+        return -1; // Not found
+    }
+
+    // Pull later entries of the same probe chain back into the hole
+    uint32_t hole = slot;
+    uint32_t next = (hole + 1) & mask;
+    while (index->positions[next] != EMPTY_SLOT) {
+        uint32_t home = hashDeviceID(index->keys[next]) & mask;
+        // Move the entry only if its home slot is not between the hole and its current slot
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            index->keys[hole] = index->keys[next];
+            index->positions[hole] = index->positions[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    index->positions[hole] = EMPTY_SLOT;
+    index->count--;
+    return 0;
+}
+
+// Function to find a device by ID through the hash index
+Device* findDeviceIndexed(DeviceIndex *index, Device devices[], int id) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t slot = hashDeviceID(id) & mask;
+
+    while (index->positions[slot] != EMPTY_SLOT) {
+        if (index->keys[slot] == id) {
+            return &devices[index->positions[slot]];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+// Function to find a device by ID (linear scan, kept for comparison)
+Device* findDeviceByID(Device devices[], int numDevices, int id) {
+    for (int i = 0; i < numDevices; i++) {
+        if (devices[i].id == id) {
+            return &devices[i];
+        }
+    }
+    return NULL;
+}
+
+// Change a device's ID and keep the index consistent (remove + reinsert)
+int renameDevice(DeviceIndex *index, Device devices[], Device *device, int newID) {
+    if (newID == device->id) return 0;
+    if (findDeviceIndexed(index, devices, newID) != NULL) {
+        return -1; // ID already in use
+    }
+
+    int position = (int)(device - devices);
+    indexRemove(index, device->id);
+    device->id = newID;
+    return indexInsert(index, newID, position);
+}
+
+// Function to update device ID
+void updateDeviceID(DeviceIndex *index, Device devices[], Device *device) {
+    if (device) {
+        int newID;
+        printf("Current ID of %s is %d.\n", device->name, device->id);
+        printf("Enter a new ID for %s (or enter -1 to keep the old ID): ", device->name);
+        if (scanf("%d", &newID) != 1) newID = -1;
+
+        if (newID != -1) {
+            int oldID = device->id;
+            if (renameDevice(index, devices, device, newID) == 0) {
+                printf("Device ID changed from %d to %d.\n", oldID, newID);
+            } else {
+                printf("Device ID %d is already in use, ID remains %d.\n", newID, oldID);
+            }
+        } else {
+            printf("Device ID remains unchanged.\n");
+        }
+    }
+}
+
+// Function to update a device's main action
+void updateDeviceAction(Device *device, void (*newAction)(int)) {
+    if (device) {
+        device->action = newAction;
+        printf("Device %d (%s) action updated.\n", device->id, device->name);
+    }
+}
+
+// Function to update a device's timed action
+void updateDeviceTimedAction(Device *device, void (*newTimedAction)(int), int runtime) {
+    if (device) {
+        device->timedAction = newTimedAction;
+        device->runtimeHours = runtime;
+        printf("Device %d (%s) timed action updated to %d hours.\n", device->id, device->name, runtime);
+    }
+}
+
+// Function to display the list of devices
+void displayDevices(Device devices[], int numDevices) {
+    printf("\n---- Device List ----\n");
+    for (int i = 0; i < numDevices; i++) {
+        printf("Device ID: %d, Name: %s, Runtime: %d hours -> ",
+               devices[i].id, devices[i].name, devices[i].runtimeHours);
+        devices[i].action(devices[i].id);
+        devices[i].timedAction(devices[i].id);
+    }
+}
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Compare linear findDeviceByID against the hash index at several registry sizes
+void runLookupBenchmark(void) {
+    int sizes[] = {10, 1000, 100000, 1000000};
+    int numSizes = sizeof(sizes) / sizeof(sizes[0]);
+    const int indexedLookups = 2000000;
+
+    printf("\n---- Lookup Benchmark ----\n");
+    printf("%10s %16s %16s %10s\n", "Devices", "Linear ns/op", "Indexed ns/op", "Speedup");
+
+    for (int s = 0; s < numSizes; s++) {
+        int n = sizes[s];
+        Device *devices = malloc(sizeof(Device) * n);
+        int *queries = malloc(sizeof(int) * indexedLookups);
+        if (devices == NULL || queries == NULL) {
+            printf("Error: Out of memory for %d devices\n", n);
+            free(devices);
+            free(queries);
+            return;
+        }
+
+        // Non-sequential unique IDs, like a real registry
+        for (int i = 0; i < n; i++) {
+            devices[i] = (Device){100000 + i * 7, "Device", turnOn, runFor10Hours, 10};
+        }
+        for (int i = 0; i < indexedLookups; i++) {
+            queries[i] = devices[rand() % n].id;
+        }
+
+        DeviceIndex index;
+        if (buildDeviceIndex(&index, devices, n) != 0) {
+            free(devices);
+            free(queries);
+            return;
+        }
+
+        // Linear scans get fewer queries on big registries so the run stays short
+        int linearLookups = n >= 100000 ? 200 : 200000;
+        long checksum = 0;
+        struct timespec t0, t1;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int q = 0; q < linearLookups; q++) {
+            Device *d = findDeviceByID(devices, n, queries[q]);
+            checksum += d ? d->runtimeHours : 0;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double linearNs = elapsedNs(t0, t1) / linearLookups;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int q = 0; q < indexedLookups; q++) {
+            Device *d = findDeviceIndexed(&index, devices, queries[q]);
+            checksum += d ? d->runtimeHours : 0;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double indexedNs = elapsedNs(t0, t1) / indexedLookups;
+
+        printf("%10d %16.1f %16.1f %9.1fx   (checksum %ld)\n",
+               n, linearNs, indexedNs, linearNs / indexedNs, checksum);
+
+        freeDeviceIndex(&index);
+        free(devices);
+        free(queries);
+    }
+}
+
+int main() {
+    // Initialize devices with function pointers
+    Device devices[] = {
+        {101, "Fan", turnOn, runFor10Hours, 10},
+        {102, "Light", turnOff, runFor20Hours, 20},
+        {103, "Thermostat", reset, runFor30Hours, 30},
+        {104, "Router", standby, runFor40Hours, 40},
+        {105, "TV", turnOn, runFor10Hours, 10}
+    };
+
+    int numDevices = sizeof(devices) / sizeof(devices[0]);
+
+    DeviceIndex index;
+    if (buildDeviceIndex(&index, devices, numDevices) != 0) {
+        return 1;
+    }
+
+    // Display initial device states
+    displayDevices(devices, numDevices);
+
+    // Update TV ID (the index follows the rename)
+    updateDeviceID(&index, devices, &devices[4]); // TV is at index 4
+
+    // Allow user to change device actions and timed actions
+    int deviceChoice = -1;
+    printf("\nSelect a device to change its action and runtime (Enter ID): ");
+    scanf("%d", &deviceChoice);
+
+    Device *selectedDevice = findDeviceIndexed(&index, devices, deviceChoice);
+
+    if (selectedDevice) {
+        int actionChoice = 0, timeChoice = 0;
+
+        // Update main action
+        printf("\nSelect new **main action** for %s (ID %d):\n", selectedDevice->name, selectedDevice->id);
+        printf("1. Turn On\n2. Turn Off\n3. Reset\n4. Standby\nEnter your choice: ");
+        scanf("%d", &actionChoice);
+
+        switch (actionChoice) {
+            case 1: updateDeviceAction(selectedDevice, turnOn); break;
+            case 2: updateDeviceAction(selectedDevice, turnOff); break;
+            case 3: updateDeviceAction(selectedDevice, reset); break;
+            case 4: updateDeviceAction(selectedDevice, standby); break;
+            default: printf("Invalid action choice!\n");
+        }
+
+        // Update timed action
+        printf("\nSelect new **timed action** for %s (ID %d):\n", selectedDevice->name, selectedDevice->id);
+        printf("1. Run for 10 hours\n2. Run for 20 hours\n3. Run for 30 hours\n4. Run for 40 hours\nEnter your choice: ");
+        scanf("%d", &timeChoice);
+
+        switch (timeChoice) {
+            case 1: updateDeviceTimedAction(selectedDevice, runFor10Hours, 10); break;
+            case 2: updateDeviceTimedAction(selectedDevice, runFor20Hours, 20); break;
+            case 3: updateDeviceTimedAction(selectedDevice, runFor30Hours, 30); break;
+            case 4: updateDeviceTimedAction(selectedDevice, runFor40Hours, 40); break;
+            default: printf("Invalid time choice!\n");
+        }
+    } else {
+        printf("Device with ID %d not found!\n", deviceChoice);
+    }
+
+    // Display updated device states
+    displayDevices(devices, numDevices);
+    freeDeviceIndex(&index);
+
+    // Linear scan vs hash index
+    runLookupBenchmark();
+
+    return 0;
+}
@@ -0,0 +1,336 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MAX_SENSORS 5
+#define INITIAL_FLEET_CAPACITY 16
+#define ARENA_BLOCK_SIZE (1 << 20)  // 1 MiB default block
+#define ARENA_ALIGNMENT 64          // Cache-line aligned allocations
+
+// Structure for vehicle sensors
+typedef struct {
+    char type[20];
+    float value;
+} Sensor;
+
+// Structure for vehicle information
+typedef struct {
+    char make[50];
+    char model[50];
+    int year;
+    float engine_capacity;
+    int mileage;
+    Sensor sensors[MAX_SENSORS];
+    int sensor_count;
+} Vehicle;
+
+// One block of raw memory handed out by bumping 'used'
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    size_t size;
+    size_t used;
+    unsigned char *data;
+} ArenaBlock;
+
+// Block/arena allocator: many allocations, one free at the end
+typedef struct {
+    ArenaBlock *head;      // Current block, older blocks follow
+    size_t blockSize;
+    int blockCount;        // Number of malloc calls made by the arena
+    size_t bytesReserved;  // Currently held, released blocks excluded
+} Arena;
+
+// Fleet management structure, vehicles stay contiguous in arena memory
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int capacity;
+    int relocations;       // Times the vehicle array had to be copied to grow
+    Arena arena;
+} VehicleFleet;
+
+// Function prototypes
+void arenaInit(Arena *arena, size_t blockSize);
+void *arenaAlloc(Arena *arena, size_t bytes);
+int arenaExtend(Arena *arena, void *ptr, size_t oldBytes, size_t newBytes);
+int arenaRelease(Arena *arena, void *ptr, size_t bytes);
+void arenaFree(Arena *arena);
+void fleetInit(VehicleFleet *fleet);
+int fleetReserve(VehicleFleet *fleet, int capacity);
+void fleetFree(VehicleFleet *fleet);
+Vehicle createVehicle(char *make, char *model, int year, float engine_capacity, int mileage);
+int addVehicle(VehicleFleet *fleet, Vehicle vehicle);
+void addSensor(Vehicle *vehicle, char *type, float value);
+void printVehicle(Vehicle vehicle);
+void displayFleet(VehicleFleet *fleet);
+void displaySensorData(Vehicle *vehicle);
+void updateMileage(Vehicle *vehicle, int mileage);
+void loadLargeFleet(int numVehicles, int useReserve);
+
+// ---------------- Arena allocator ----------------
+
+void arenaInit(Arena *arena, size_t blockSize) {
+    arena->head = NULL;
+    arena->blockSize = blockSize;
+    arena->blockCount = 0;
+    arena->bytesReserved = 0;
+}
+
+static size_t alignUp(size_t n) {
+    return (n + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+static ArenaBlock *arenaNewBlock(Arena *arena, size_t minBytes) {
+    size_t size = minBytes > arena->blockSize ? minBytes : arena->blockSize;
+    ArenaBlock *block = malloc(sizeof(ArenaBlock));
+    if (block == NULL) return NULL;
+
+    block->data = aligned_alloc(ARENA_ALIGNMENT, alignUp(size));
+    if (block->data == NULL) {
+        free(block);
+        return NULL;
+    }
+    block->size = alignUp(size);
+    block->used = 0;
+    block->next = arena->head;
+    arena->head = block;
+    arena->blockCount++;
+    arena->bytesReserved += block->size;
+    return block;
+}
+
+void *arenaAlloc(Arena *arena, size_t bytes) {
+    bytes = alignUp(bytes);
+    ArenaBlock *block = arena->head;
+
+    if (block == NULL || block->size - block->used < bytes) {
+        block = arenaNewBlock(arena, bytes);
+        if (block == NULL) return NULL;
+    }
+
+    void *ptr = block->data + block->used;
+    block->used += bytes;
+    return ptr;
+}
+
+// Grow the most recent allocation in place. Returns 1 on success, 0 if it must be moved.
+int arenaExtend(Arena *arena, void *ptr, size_t oldBytes, size_t newBytes) {
+    ArenaBlock *block = arena->head;
+    if (block == NULL || ptr == NULL) return 0;
+
+    oldBytes = alignUp(oldBytes);
+    newBytes = alignUp(newBytes);
+    if ((unsigned char *)ptr + oldBytes != block->data + block->used) return 0;
+    if (block->used - oldBytes + newBytes > block->size) return 0;
+
+    block->used += newBytes - oldBytes;
+    return 1;
+}
+
+// Hand back an allocation that has its block to itself. Returns 1 if the block was
+// freed, 0 if something else still lives in it (it is then reclaimed by arenaFree).
+int arenaRelease(Arena *arena, void *ptr, size_t bytes) {
+    for (ArenaBlock **link = &arena->head; *link != NULL; link = &(*link)->next) {
+        ArenaBlock *block = *link;
+        if (block->data != ptr) continue;
+        if (block->used != alignUp(bytes)) return 0;
+        *link = block->next;
+        arena->bytesReserved -= block->size;
+        free(block->data);
+        free(block);
+        return 1;
+    }
+    return 0;
+}
+
+void arenaFree(Arena *arena) {
+    ArenaBlock *block = arena->head;
+    while (block != NULL) {
+        ArenaBlock *next = block->next;
+        free(block->data);
+        free(block);
+        block = next;
+    }
+    arenaInit(arena, arena->blockSize);
+}
+
+// ---------------- Growable fleet ----------------
+
+void fleetInit(VehicleFleet *fleet) {
+    fleet->vehicles = NULL;
+    fleet->count = 0;
+    fleet->capacity = 0;
+    fleet->relocations = 0;
+    arenaInit(&fleet->arena, ARENA_BLOCK_SIZE);
+}
+
+// Make room for at least 'capacity' vehicles with a single arena allocation
+int fleetReserve(VehicleFleet *fleet, int capacity) {
+    if (capacity <= fleet->capacity) return 0;
+
+    size_t oldBytes = sizeof(Vehicle) * (size_t)fleet->capacity;
+    size_t newBytes = sizeof(Vehicle) * (size_t)capacity;
+
+    if (fleet->vehicles != NULL && arenaExtend(&fleet->arena, fleet->vehicles, oldBytes, newBytes)) {
+        fleet->capacity = capacity;
+        return 0;
+    }
+
+    // Past the first block each copy gets a block of its own, so the one it replaces
+    // can be handed back instead of staying reserved until fleetFree
+    Vehicle *moved = arenaAlloc(&fleet->arena, newBytes);
+    if (moved == NULL) {
+        printf("Error: Out of memory reserving %d vehicles\n", capacity);
+        return -1;
+    }
+    if (fleet->count > 0) {
+        memcpy(moved, fleet->vehicles, sizeof(Vehicle) * (size_t)fleet->count);
+        fleet->relocations++;
+    }
+    if (fleet->vehicles != NULL) arenaRelease(&fleet->arena, fleet->vehicles, oldBytes);
+    fleet->vehicles = moved;
+    fleet->capacity = capacity;
+    return 0;
+}
+
+void fleetFree(VehicleFleet *fleet) {
+    arenaFree(&fleet->arena);
+    fleet->vehicles = NULL;
+    fleet->count = 0;
+    fleet->capacity = 0;
+}
+
+Vehicle createVehicle(char *make, char *model, int year, float engine_capacity, int mileage) {
+    Vehicle vehicle;
+    strcpy(vehicle.make, make);
+    strcpy(vehicle.model, model);
+    vehicle.year = year;
+    vehicle.engine_capacity = engine_capacity;
+    vehicle.mileage = mileage;
+    vehicle.sensor_count = 0;
+    return vehicle;
+}
+
+// Append a vehicle, doubling capacity when full
+int addVehicle(VehicleFleet *fleet, Vehicle vehicle) {
+    if (fleet->count == fleet->capacity) {
+        int newCapacity = fleet->capacity ? fleet->capacity * 2 : INITIAL_FLEET_CAPACITY;
+        if (fleetReserve(fleet, newCapacity) != 0) {
+            printf("Error: Cannot grow fleet, vehicle not added\n");
+            return -1;
+        }
+    }
+    fleet->vehicles[fleet->count++] = vehicle;
+    return 0;
+}
+
+void addSensor(Vehicle *vehicle, char *type, float value) {
+    if (vehicle->sensor_count < MAX_SENSORS) {
+        strcpy(vehicle->sensors[vehicle->sensor_count].type, type);
+        vehicle->sensors[vehicle->sensor_count].value = value;
+        vehicle->sensor_count++;
+    } else {
+        printf("Error: Sensor limit reached for vehicle %s %s\n", vehicle->make, vehicle->model);
+    }
+}
+
+void printVehicle(Vehicle vehicle) {
+    printf("Make: %s\n", vehicle.make);
+    printf("Model: %s\n", vehicle.model);
+    printf("Year: %d\n", vehicle.year);
+    printf("Engine Capacity: %.2fL\n", vehicle.engine_capacity);
+    printf("Mileage: %d km\n", vehicle.mileage);
+}
+
+void displayFleet(VehicleFleet *fleet) {
+    for (int i = 0; i < fleet->count; i++) {
+        printVehicle(fleet->vehicles[i]);
+        printf("----------------------\n");
+    }
+}
+
+void displaySensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        printf("%s: %.2f\n", vehicle->sensors[i].type, vehicle->sensors[i].value);
+    }
+}
+
+void updateMileage(Vehicle *vehicle, int mileage) {
+    vehicle->mileage = mileage;
+}
+
+static double elapsedMs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Load a synthetic fleet and report how many allocations and copies it took
+void loadLargeFleet(int numVehicles, int useReserve) {
+    VehicleFleet fleet;
+    struct timespec t0, t1, t2;
+    fleetInit(&fleet);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (useReserve) {
+        fleetReserve(&fleet, numVehicles);
+    }
+    Vehicle v = createVehicle("Toyota", "Corolla", 2020, 1.8, 0);
+    addSensor(&v, "Temperature", 85.0);
+    for (int i = 0; i < numVehicles; i++) {
+        v.mileage = i;
+        if (addVehicle(&fleet, v) != 0) break;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    // Scan-heavy loop over contiguous storage, same access pattern as displayFleet
+    long long totalMileage = 0;
+    for (int i = 0; i < fleet.count; i++) {
+        totalMileage += fleet.vehicles[i].mileage;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+
+    printf("%-12s %8d vehicles | load %7.2f ms | scan %6.2f ms | arena blocks %d | relocations %d | %.1f MB reserved | mileage sum %lld\n",
+           useReserve ? "reserve" : "grow-on-add", fleet.count,
+           elapsedMs(t0, t1), elapsedMs(t1, t2),
+           fleet.arena.blockCount, fleet.relocations,
+           fleet.arena.bytesReserved / (1024.0 * 1024.0), totalMileage);
+
+    fleetFree(&fleet);
+}
+
+int main() {
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+
+    // Creating and adding vehicles
+    addVehicle(&fleet, createVehicle("Toyota", "Camry", 2021, 2.5, 15000));
+    addVehicle(&fleet, createVehicle("Ford", "Mustang", 2020, 5.0, 22000));
+
+    // Adding sensors to vehicles
+    addSensor(&fleet.vehicles[1], "Temperature", 85.2);
+    addSensor(&fleet.vehicles[0], "Oil Pressure", 30.5);
+    addSensor(&fleet.vehicles[1], "Brake Fluid", 12.7);
+
+    // Displaying fleet
+    printf("Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+
+    // Displaying sensor data
+    for (int j = 0; j < fleet.count; j++) {
+        printf("\nSensor Data for Vehicle: %d %s %s:\n", (j + 1), fleet.vehicles[j].make, fleet.vehicles[j].model);
+        displaySensorData(&fleet.vehicles[j]);
+    }
+
+    // Updating mileage
+    updateMileage(&fleet.vehicles[0], 18000);
+    printf("\nUpdated Mileage for %s %s: %d km\n", fleet.vehicles[0].make, fleet.vehicles[0].model, fleet.vehicles[0].mileage);
+    fleetFree(&fleet);
+
+    // Large fleets: geometric growth vs a single bulk reserve
+    printf("\n---- Large Fleet Load ----\n");
+    loadLargeFleet(200000, 0);
+    loadLargeFleet(200000, 1);
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+// Define a structure for storing vehicle information
+typedef struct {
+    char make[50];
+    char model[50];
+    int year;
+    float engine_capacity;
+    int mileage;
+    int seat;
+} Vehicle;
+
+// Handle that stays valid across removals of other vehicles
+typedef struct {
+    uint32_t slot;
+    uint32_t generation;
+} VehicleHandle;
+
+#define INVALID_SLOT UINT32_MAX
+#define SHIFT_BASELINE_VEHICLES 10000   // Shift-down is timed at this size and scaled up
+#define SHIFT_BASELINE_OPS 10000
+
+// Indirection entry: where a handle's vehicle currently lives
+typedef struct {
+    uint32_t generation;  // Bumped on every removal, stale handles stop matching
+    uint32_t denseIndex;  // Position in vehicles[] while alive, next free slot otherwise
+} Slot;
+
+// Slot-map fleet: vehicles stay packed for scans, handles go through slots[]
+typedef struct {
+    Vehicle *vehicles;    // Dense array, [0, count) are live
+    uint32_t *slotOf;     // slotOf[i] = slot that owns vehicles[i]
+    int count;
+    int capacity;
+    Slot *slots;
+    uint32_t slotCount;
+    uint32_t slotCapacity;
+    uint32_t freeHead;    // First free slot, INVALID_SLOT if none
+} VehicleFleet;
+
+// Function prototypes
+void fleetInit(VehicleFleet *fleet);
+void fleetFree(VehicleFleet *fleet);
+VehicleHandle addVehicle(VehicleFleet *fleet, Vehicle vehicle);
+Vehicle *getVehicle(VehicleFleet *fleet, VehicleHandle handle);
+int removeVehicleByHandle(VehicleFleet *fleet, VehicleHandle handle);
+VehicleHandle handleAt(VehicleFleet *fleet, int index);
+void printVehicle(Vehicle vehicle);
+void displayFleet(VehicleFleet *fleet);
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model);
+int removeVehicle(VehicleFleet *fleet, char *make, char *model);
+void runChurnBenchmark(int fleetSize, int operations);
+
+void fleetInit(VehicleFleet *fleet) {
+    memset(fleet, 0, sizeof(*fleet));
+    fleet->freeHead = INVALID_SLOT;
+}
+
+void fleetFree(VehicleFleet *fleet) {
+    free(fleet->vehicles);
+    free(fleet->slotOf);
+    free(fleet->slots);
+    fleetInit(fleet);
+}
+
+static int growDense(VehicleFleet *fleet) {
+    int newCapacity = fleet->capacity ? fleet->capacity * 2 : 16;
+    Vehicle *vehicles = realloc(fleet->vehicles, sizeof(Vehicle) * newCapacity);
+    if (vehicles == NULL) return -1;
+    fleet->vehicles = vehicles;
+
+    uint32_t *slotOf = realloc(fleet->slotOf, sizeof(uint32_t) * newCapacity);
+    if (slotOf == NULL) return -1;
+    fleet->slotOf = slotOf;
+
+    fleet->capacity = newCapacity;
+    return 0;
+}
+
+static uint32_t allocSlot(VehicleFleet *fleet) {
+    if (fleet->freeHead != INVALID_SLOT) {
+        uint32_t slot = fleet->freeHead;
+        fleet->freeHead = fleet->slots[slot].denseIndex;
+        return slot;
+    }
+
+    if (fleet->slotCount == fleet->slotCapacity) {
+        uint32_t newCapacity = fleet->slotCapacity ? fleet->slotCapacity * 2 : 16;
+        Slot *slots = realloc(fleet->slots, sizeof(Slot) * newCapacity);
+        if (slots == NULL) return INVALID_SLOT;
+        fleet->slots = slots;
+        fleet->slotCapacity = newCapacity;
+    }
+    fleet->slots[fleet->slotCount].generation = 0;
+    return fleet->slotCount++;
+}
+
+// Function to add a vehicle to the fleet, O(1) amortized
+VehicleHandle addVehicle(VehicleFleet *fleet, Vehicle vehicle) {
+    VehicleHandle handle = {INVALID_SLOT, 0};
+
+    if (fleet->count == fleet->capacity && growDense(fleet) != 0) {
+        printf("Error: Out of memory, cannot add vehicle\n");
+        return handle;
+    }
+    uint32_t slot = allocSlot(fleet);
+    if (slot == INVALID_SLOT) {
+        printf("Error: Out of memory, cannot add vehicle\n");
+        return handle;
+    }
+
+    int index = fleet->count++;
+    fleet->vehicles[index] = vehicle;
+    fleet->slotOf[index] = slot;
+    fleet->slots[slot].denseIndex = (uint32_t)index;
+
+    handle.slot = slot;
+    handle.generation = fleet->slots[slot].generation;
+    return handle;
+}
+
+// O(1) lookup, NULL when the handle is stale or invalid
+Vehicle *getVehicle(VehicleFleet *fleet, VehicleHandle handle) {
+    if (handle.slot >= fleet->slotCount) return NULL;
+    Slot *slot = &fleet->slots[handle.slot];
+    if (slot->generation != handle.generation) return NULL;
+    return &fleet->vehicles[slot->denseIndex];
+}
+
+// O(1) removal: move the last vehicle into the hole and retire the slot
+int removeVehicleByHandle(VehicleFleet *fleet, VehicleHandle handle) {
+    if (getVehicle(fleet, handle) == NULL) return -1;
+
+    Slot *slot = &fleet->slots[handle.slot];
+    uint32_t hole = slot->denseIndex;
+    uint32_t last = (uint32_t)fleet->count - 1;
+
+    if (hole != last) {
+        fleet->vehicles[hole] = fleet->vehicles[last];
+        fleet->slotOf[hole] = fleet->slotOf[last];
+        fleet->slots[fleet->slotOf[hole]].denseIndex = hole;
+    }
+    fleet->count--;
+
+    slot->generation++;
+    slot->denseIndex = fleet->freeHead;
+    fleet->freeHead = handle.slot;
+    return 0;
+}
+
+// Handle for the vehicle currently stored at a dense index
+VehicleHandle handleAt(VehicleFleet *fleet, int index) {
+    uint32_t slot = fleet->slotOf[index];
+    VehicleHandle handle = {slot, fleet->slots[slot].generation};
+    return handle;
+}
+
+// Function to print details of a single vehicle
+void printVehicle(Vehicle vehicle) {
+    printf("Make: %s\n", vehicle.make);
+    printf("Model: %s\n", vehicle.model);
+    printf("Year: %d\n", vehicle.year);
+    printf("Engine Capacity: %.2fL\n", vehicle.engine_capacity);
+    printf("Mileage: %d km\n", vehicle.mileage);
+    printf("Seat: %d \n", vehicle.seat);
+}
+
+// Function to display the entire fleet
+void displayFleet(VehicleFleet *fleet) {
+    for (int i = 0; i < fleet->count; i++) {
+        printVehicle(fleet->vehicles[i]);
+        printf("----------------------\n");
+    }
+}
+
+// Function to search for a vehicle in the fleet by make and model
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model) {
+    for (int i = 0; i < fleet->count; i++) {
+        if (strcmp(fleet->vehicles[i].make, make) == 0 && strcmp(fleet->vehicles[i].model, model) == 0) {
+            return i; // Return the index of the found vehicle
+        }
+    }
+    return -1; // Return -1 if not found
+}
+
+// Function to remove a vehicle from the fleet (the search is still linear, the removal is O(1))
+int removeVehicle(VehicleFleet *fleet, char *make, char *model) {
+    int index = findVehicleIndex(fleet, make, model);
+    if (index == -1) {
+        return -1; // Vehicle not found
+    }
+    return removeVehicleByHandle(fleet, handleAt(fleet, index));
+}
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Constant add/remove churn: slot map vs the original shift-down removal
+void runChurnBenchmark(int fleetSize, int operations) {
+    Vehicle v = {"Toyota", "Corolla", 2020, 1.8, 0, 4};
+    struct timespec t0, t1;
+
+    // Slot map: keep a list of live handles and replace a random one each step
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+    VehicleHandle *live = malloc(sizeof(VehicleHandle) * fleetSize);
+    if (live == NULL) {
+        printf("Error: Out of memory for %d churn handles\n", fleetSize);
+        return;
+    }
+    for (int i = 0; i < fleetSize; i++) {
+        v.mileage = i;
+        live[i] = addVehicle(&fleet, v);
+    }
+
+    int staleDetected = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int op = 0; op < operations; op++) {
+        int pick = rand() % fleetSize;
+        VehicleHandle old = live[pick];
+        removeVehicleByHandle(&fleet, old);
+        v.mileage = op;
+        live[pick] = addVehicle(&fleet, v);
+        staleDetected += (getVehicle(&fleet, old) == NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double slotMapNs = elapsedNs(t0, t1) / operations;
+
+    // Every surviving handle must still resolve to a live vehicle
+    int valid = 0;
+    for (int i = 0; i < fleetSize; i++) {
+        valid += (getVehicle(&fleet, live[i]) != NULL);
+    }
+    fleetFree(&fleet);
+    free(live);
+
+    // Shift-down array, as in the original removeVehicle. It moves O(n) vehicles per removal,
+    // so larger fleets are timed at SHIFT_BASELINE_VEHICLES and scaled linearly.
+    int shiftVehicles = fleetSize < SHIFT_BASELINE_VEHICLES ? fleetSize : SHIFT_BASELINE_VEHICLES;
+    int shiftOps = operations < SHIFT_BASELINE_OPS ? operations : SHIFT_BASELINE_OPS;
+    Vehicle *array = malloc(sizeof(Vehicle) * shiftVehicles);
+    if (array == NULL) {
+        printf("Error: Out of memory for %d shift-down vehicles\n", shiftVehicles);
+        return;
+    }
+    int count = shiftVehicles;
+    for (int i = 0; i < count; i++) {
+        array[i] = v;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int op = 0; op < shiftOps; op++) {
+        int index = rand() % count;
+        for (int i = index; i < count - 1; i++) {
+            array[i] = array[i + 1];
+        }
+        count--;
+        array[count++] = v;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double shiftNs = elapsedNs(t0, t1) / shiftOps * ((double)fleetSize / shiftVehicles);
+    free(array);
+
+    printf("%9d vehicles | slot map %8.1f ns/op | shift-down %12.1f ns/op%s | stale handles caught %d/%d | live handles valid %d/%d\n",
+           fleetSize, slotMapNs, shiftNs, shiftVehicles < fleetSize ? " (scaled)" : "         ",
+           staleDetected, operations, valid, fleetSize);
+}
+
+int main() {
+    // Initialize fleet
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+
+    // Array of vehicles
+    Vehicle vehicle[] = {
+        {"Toyota", "Corolla", 2020, 1.8, 15000, 4},
+        {"Ford", "Focus", 2019, 2.0, 20000, 3},
+        {"Honda", "Civic", 2021, 1.5, 5000, 2},
+    };
+
+    // Adding vehicles to the fleet and keeping their handles
+    VehicleHandle toyota = addVehicle(&fleet, vehicle[0]);
+    VehicleHandle ford = addVehicle(&fleet, vehicle[1]);
+    VehicleHandle honda = addVehicle(&fleet, vehicle[2]);
+
+    // Display the fleet
+    printf("Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+
+    // Remove a vehicle from the fleet
+    if (removeVehicle(&fleet, "Toyota", "Corolla") == 0) {
+        printf("\nVehicle removed successfully!\n");
+    } else {
+        printf("\nError: Vehicle not found for removal.\n");
+    }
+
+    // Handles held elsewhere survive the removal, the removed one is reported stale
+    printf("Toyota handle: %s\n", getVehicle(&fleet, toyota) ? "valid" : "stale");
+    Vehicle *found = getVehicle(&fleet, ford);
+    if (found) {
+        printf("\nFord handle still resolves:\n");
+        printVehicle(*found);
+    }
+    found = getVehicle(&fleet, honda);
+    if (found) {
+        printf("\nHonda handle still resolves:\n");
+        printVehicle(*found);
+    }
+
+    // Display the updated fleet
+    printf("\nUpdated Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+    fleetFree(&fleet);
+
+    // Add/remove churn
+    printf("\n---- Churn Benchmark ----\n");
+    runChurnBenchmark(1000, 1000000);
+    runChurnBenchmark(100000, 1000000);
+    runChurnBenchmark(1000000, 1000000);
+
+    return 0;
+}
@@ -0,0 +1,502 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define NO_SYMBOL UINT16_MAX   // Symbol ID for strings that were never interned
+#define NO_VEHICLE -1
+
+// Vehicle with make/model stored as interned symbol IDs instead of char[50]
+typedef struct {
+    uint16_t make;   // Symbol ID in the string table
+    uint16_t model;  // Symbol ID in the string table
+    int year;
+    float engine_capacity;
+    int mileage;
+    int seat;
+    int nextSameKey; // Next vehicle with the same (make, model), NO_VEHICLE at the end
+} Vehicle;
+
+// String interning table: every distinct make/model is stored exactly once
+typedef struct {
+    char **strings;     // Symbol ID -> string
+    int count;
+    int capacity;
+    int32_t *buckets;   // Open-addressing table of symbol IDs, -1 = empty
+    int bucketCount;    // Power of two
+} StringTable;
+
+// Composite (make, model) -> first vehicle index, chained through nextSameKey
+typedef struct {
+    uint32_t *keys;     // (make << 16) | model
+    int *heads;         // First vehicle index with this key, NO_VEHICLE = empty slot
+    int capacity;       // Power of two
+    int count;
+} MakeModelIndex;
+
+// Fleet with symbol table and composite index
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int capacity;
+    StringTable symbols;
+    MakeModelIndex index;
+} VehicleFleet;
+
+// Function prototypes
+void stringTableInit(StringTable *table);
+void stringTableFree(StringTable *table);
+uint16_t internString(StringTable *table, const char *str);
+uint16_t lookupSymbol(StringTable *table, const char *str);
+const char *symbolName(StringTable *table, uint16_t id);
+void fleetInit(VehicleFleet *fleet);
+void fleetFree(VehicleFleet *fleet);
+int addVehicle(VehicleFleet *fleet, const char *make, const char *model, int year, float engine_capacity, int mileage, int seat);
+void printVehicle(VehicleFleet *fleet, const Vehicle *vehicle);
+void displayFleet(VehicleFleet *fleet);
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model);
+int findVehicleBySymbols(VehicleFleet *fleet, uint16_t make, uint16_t model);
+int removeVehicle(VehicleFleet *fleet, char *make, char *model);
+void runSearchBenchmark(int numVehicles, int numSearches);
+
+// FNV-1a string hash
+static uint32_t hashString(const char *str) {
+    uint32_t h = 2166136261U;
+    while (*str) {
+        h ^= (unsigned char)*str++;
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static uint32_t hashKey(uint32_t key) {
+    key ^= key >> 16;
+    key *= 0x7feb352dU;
+    key ^= key >> 15;
+    key *= 0x846ca68bU;
+    key ^= key >> 16;
+    return key;
+}
+
+static uint32_t makeModelKey(uint16_t make, uint16_t model) {
+    return ((uint32_t)make << 16) | model;
+}
+
+// ---------------- String interning ----------------
+
+void stringTableInit(StringTable *table) {
+    table->strings = NULL;
+    table->count = 0;
+    table->capacity = 0;
+    table->bucketCount = 64;
+    table->buckets = malloc(sizeof(int32_t) * table->bucketCount);
+    if (table->buckets == NULL) {
+        // An empty table: lookups miss and the first intern retries the allocation
+        table->bucketCount = 0;
+        return;
+    }
+    for (int i = 0; i < table->bucketCount; i++) {
+        table->buckets[i] = -1;
+    }
+}
+
+void stringTableFree(StringTable *table) {
+    for (int i = 0; i < table->count; i++) {
+        free(table->strings[i]);
+    }
+    free(table->strings);
+    free(table->buckets);
+    memset(table, 0, sizeof(*table));
+}
+
+// Keeps the old buckets when the bigger array cannot be allocated
+static int stringTableRehash(StringTable *table) {
+    int newCount = table->bucketCount ? table->bucketCount * 2 : 64;
+    int32_t *buckets = malloc(sizeof(int32_t) * newCount);
+    if (buckets == NULL) return -1;
+    free(table->buckets);
+    table->buckets = buckets;
+    table->bucketCount = newCount;
+    for (int i = 0; i < table->bucketCount; i++) {
+        table->buckets[i] = -1;
+    }
+
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    for (int id = 0; id < table->count; id++) {
+        uint32_t slot = hashString(table->strings[id]) & mask;
+        while (table->buckets[slot] != -1) {
+            slot = (slot + 1) & mask;
+        }
+        table->buckets[slot] = id;
+    }
+    return 0;
+}
+
+// Return the symbol ID for a string, NO_SYMBOL if it was never interned
+uint16_t lookupSymbol(StringTable *table, const char *str) {
+    if (table->bucketCount == 0) return NO_SYMBOL;
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    uint32_t slot = hashString(str) & mask;
+
+    while (table->buckets[slot] != -1) {
+        if (strcmp(table->strings[table->buckets[slot]], str) == 0) {
+            return (uint16_t)table->buckets[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NO_SYMBOL;
+}
+
+// Return the existing symbol ID or store the string once and assign a new one
+uint16_t internString(StringTable *table, const char *str) {
+    uint16_t id = lookupSymbol(table, str);
+    if (id != NO_SYMBOL) return id;
+
+    if (table->count >= NO_SYMBOL) {
+        printf("Error: Symbol table full\n");
+        return NO_SYMBOL;
+    }
+    if ((table->count + 1) * 2 > table->bucketCount && stringTableRehash(table) != 0) {
+        printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+        return NO_SYMBOL;
+    }
+    if (table->count == table->capacity) {
+        int newCapacity = table->capacity ? table->capacity * 2 : 16;
+        char **strings = realloc(table->strings, sizeof(char *) * newCapacity);
+        if (strings == NULL) {
+            printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+            return NO_SYMBOL;
+        }
+        table->strings = strings;
+        table->capacity = newCapacity;
+    }
+    char *copy = strdup(str);
+    if (copy == NULL) {
+        printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+        return NO_SYMBOL;
+    }
+
+    id = (uint16_t)table->count++;
+    table->strings[id] = copy;
+
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    uint32_t slot = hashString(str) & mask;
+    while (table->buckets[slot] != -1) {
+        slot = (slot + 1) & mask;
+    }
+    table->buckets[slot] = id;
+    return id;
+}
+
+const char *symbolName(StringTable *table, uint16_t id) {
+    return id < table->count ? table->strings[id] : "?";
+}
+
+// ---------------- Composite (make, model) index ----------------
+
+static void indexInit(MakeModelIndex *index, int capacity) {
+    index->capacity = capacity;
+    index->count = 0;
+    index->keys = malloc(sizeof(uint32_t) * capacity);
+    index->heads = malloc(sizeof(int) * capacity);
+    for (int i = 0; i < capacity; i++) {
+        index->heads[i] = NO_VEHICLE;
+    }
+}
+
+static void indexFree(MakeModelIndex *index) {
+    free(index->keys);
+    free(index->heads);
+    memset(index, 0, sizeof(*index));
+}
+
+// Slot holding this key, or the empty slot where it would go
+static uint32_t indexProbe(MakeModelIndex *index, uint32_t key) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t slot = hashKey(key) & mask;
+    while (index->heads[slot] != NO_VEHICLE && index->keys[slot] != key) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+static void indexGrow(MakeModelIndex *index) {
+    MakeModelIndex bigger;
+    indexInit(&bigger, index->capacity * 2);
+    for (int i = 0; i < index->capacity; i++) {
+        if (index->heads[i] != NO_VEHICLE) {
+            uint32_t slot = indexProbe(&bigger, index->keys[i]);
+            bigger.keys[slot] = index->keys[i];
+            bigger.heads[slot] = index->heads[i];
+            bigger.count++;
+        }
+    }
+    indexFree(index);
+    *index = bigger;
+}
+
+// Link a vehicle at the head of its key's chain
+static void indexLink(VehicleFleet *fleet, int vehicleIndex) {
+    MakeModelIndex *index = &fleet->index;
+    if ((index->count + 1) * 2 > index->capacity) {
+        indexGrow(index);
+    }
+
+    Vehicle *v = &fleet->vehicles[vehicleIndex];
+    uint32_t key = makeModelKey(v->make, v->model);
+    uint32_t slot = indexProbe(index, key);
+
+    if (index->heads[slot] == NO_VEHICLE) {
+        index->keys[slot] = key;
+        index->count++;
+    }
+    v->nextSameKey = index->heads[slot];
+    index->heads[slot] = vehicleIndex;
+}
+
+// Replace one chain reference to 'from' with 'to' (used when a vehicle moves or leaves)
+static void indexRelink(VehicleFleet *fleet, uint32_t key, int from, int to) {
+    uint32_t slot = indexProbe(&fleet->index, key);
+    int *link = &fleet->index.heads[slot];
+    while (*link != from) {
+        link = &fleet->vehicles[*link].nextSameKey;
+    }
+    *link = (to == NO_VEHICLE) ? fleet->vehicles[from].nextSameKey : to;
+}
+
+// Drop an empty chain with backward-shift deletion so lookups never see a hole
+static void indexDropKey(MakeModelIndex *index, uint32_t key) {
+    uint32_t mask = (uint32_t)index->capacity - 1;
+    uint32_t hole = indexProbe(index, key);
+    uint32_t next = (hole + 1) & mask;
+
+    while (index->heads[next] != NO_VEHICLE) {
+        uint32_t home = hashKey(index->keys[next]) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            index->keys[hole] = index->keys[next];
+            index->heads[hole] = index->heads[next];
+            hole = next;
+        }
+        next = (next + 1) & mask;
+    }
+    index->heads[hole] = NO_VEHICLE;
+    index->count--;
+}
+
+// ---------------- Fleet ----------------
+
+void fleetInit(VehicleFleet *fleet) {
+    fleet->vehicles = NULL;
+    fleet->count = 0;
+    fleet->capacity = 0;
+    stringTableInit(&fleet->symbols);
+    indexInit(&fleet->index, 64);
+}
+
+void fleetFree(VehicleFleet *fleet) {
+    free(fleet->vehicles);
+    stringTableFree(&fleet->symbols);
+    indexFree(&fleet->index);
+    fleet->vehicles = NULL;
+    fleet->count = fleet->capacity = 0;
+}
+
+// Function to add a vehicle to the fleet, make/model are interned here
+int addVehicle(VehicleFleet *fleet, const char *make, const char *model, int year, float engine_capacity, int mileage, int seat) {
+    if (fleet->count == fleet->capacity) {
+        int newCapacity = fleet->capacity ? fleet->capacity * 2 : 16;
+        Vehicle *grown = realloc(fleet->vehicles, sizeof(Vehicle) * newCapacity);
+        if (grown == NULL) {
+            printf("Error: Fleet is full, cannot add vehicle\n");
+            return -1;
+        }
+        fleet->vehicles = grown;
+        fleet->capacity = newCapacity;
+    }
+
+    // Symbol table full (internString reported it): not linked, so lookups never see NO_SYMBOL
+    Vehicle *v = &fleet->vehicles[fleet->count];
+    v->make = internString(&fleet->symbols, make);
+    v->model = internString(&fleet->symbols, model);
+    if (v->make == NO_SYMBOL || v->model == NO_SYMBOL) return -1;
+    v->year = year;
+    v->engine_capacity = engine_capacity;
+    v->mileage = mileage;
+    v->seat = seat;
+    indexLink(fleet, fleet->count);
+    fleet->count++;
+    return 0;
+}
+
+// Function to print details of a single vehicle
+void printVehicle(VehicleFleet *fleet, const Vehicle *vehicle) {
+    printf("Make: %s\n", symbolName(&fleet->symbols, vehicle->make));
+    printf("Model: %s\n", symbolName(&fleet->symbols, vehicle->model));
+    printf("Year: %d\n", vehicle->year);
+    printf("Engine Capacity: %.2fL\n", vehicle->engine_capacity);
+    printf("Mileage: %d km\n", vehicle->mileage);
+    printf("Seat: %d \n", vehicle->seat);
+}
+
+// Function to display the entire fleet
+void displayFleet(VehicleFleet *fleet) {
+    for (int i = 0; i < fleet->count; i++) {
+        printVehicle(fleet, &fleet->vehicles[i]);
+        printf("----------------------\n");
+    }
+}
+
+// Integer hash probe on the (make, model) symbol pair, returns the newest matching vehicle
+int findVehicleBySymbols(VehicleFleet *fleet, uint16_t make, uint16_t model) {
+    if (make == NO_SYMBOL || model == NO_SYMBOL) return -1;
+    uint32_t slot = indexProbe(&fleet->index, makeModelKey(make, model));
+    return fleet->index.heads[slot] == NO_VEHICLE ? -1 : fleet->index.heads[slot];
+}
+
+// Function to search for a vehicle in the fleet by make and model
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model) {
+    return findVehicleBySymbols(fleet,
+                                lookupSymbol(&fleet->symbols, make),
+                                lookupSymbol(&fleet->symbols, model));
+}
+
+// Function to remove a vehicle from the fleet (last vehicle moves into the gap)
+int removeVehicle(VehicleFleet *fleet, char *make, char *model) {
+    int index = findVehicleIndex(fleet, make, model);
+    if (index == -1) {
+        return -1; // Vehicle not found
+    }
+
+    Vehicle *removed = &fleet->vehicles[index];
+    uint32_t key = makeModelKey(removed->make, removed->model);
+    indexRelink(fleet, key, index, NO_VEHICLE);
+    if (fleet->index.heads[indexProbe(&fleet->index, key)] == NO_VEHICLE) {
+        indexDropKey(&fleet->index, key);
+    }
+
+    int last = fleet->count - 1;
+    if (index != last) {
+        Vehicle *moved = &fleet->vehicles[last];
+        indexRelink(fleet, makeModelKey(moved->make, moved->model), last, index);
+        fleet->vehicles[index] = *moved;
+    }
+    fleet->count--;
+    return 0; // Vehicle removed successfully
+}
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Compare strcmp scan (original layout) with the interned index
+void runSearchBenchmark(int numVehicles, int numSearches) {
+    const char *makes[] = {"Toyota", "Ford", "Honda", "BMW", "Audi", "Kia", "Tesla", "Volvo"};
+    typedef struct {
+        char make[50];
+        char model[50];
+        int year;
+        float engine_capacity;
+        int mileage;
+        int seat;
+    } StringVehicle;
+
+    StringVehicle *plain = malloc(sizeof(StringVehicle) * numVehicles);
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+
+    for (int i = 0; i < numVehicles; i++) {
+        char model[50];
+        snprintf(model, sizeof(model), "Model-%d", i % 5000);
+        const char *make = makes[i % 8];
+        strcpy(plain[i].make, make);
+        strcpy(plain[i].model, model);
+        addVehicle(&fleet, make, model, 2020, 1.8, i, 4);
+    }
+
+    char (*queryMake)[50] = malloc(50 * numSearches);
+    char (*queryModel)[50] = malloc(50 * numSearches);
+    for (int q = 0; q < numSearches; q++) {
+        int pick = rand() % numVehicles;
+        strcpy(queryMake[q], plain[pick].make);
+        strcpy(queryModel[q], plain[pick].model);
+    }
+
+    struct timespec t0, t1;
+    long checksum = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int q = 0; q < numSearches; q++) {
+        for (int i = 0; i < numVehicles; i++) {
+            if (strcmp(plain[i].make, queryMake[q]) == 0 && strcmp(plain[i].model, queryModel[q]) == 0) {
+                checksum += i;
+                break;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double scanNs = elapsedNs(t0, t1) / numSearches;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int q = 0; q < numSearches; q++) {
+        checksum += findVehicleIndex(&fleet, queryMake[q], queryModel[q]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double indexNs = elapsedNs(t0, t1) / numSearches;
+
+    printf("%8d vehicles | strcmp scan %10.1f ns/search | interned index %6.1f ns/search | %zu -> %zu bytes/vehicle | %d symbols (checksum %ld)\n",
+           numVehicles, scanNs, indexNs, sizeof(StringVehicle), sizeof(Vehicle),
+           fleet.symbols.count, checksum);
+
+    free(queryMake);
+    free(queryModel);
+    free(plain);
+    fleetFree(&fleet);
+}
+
+int main() {
+    // Initialize fleet
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+
+    // Adding vehicles to the fleet
+    addVehicle(&fleet, "Toyota", "Corolla", 2020, 1.8, 15000, 4);
+    addVehicle(&fleet, "Ford", "Focus", 2019, 2.0, 20000, 3);
+    addVehicle(&fleet, "Honda", "Civic", 2021, 1.5, 5000, 2);
+
+    // Display the fleet
+    printf("Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+
+    // Searching for a vehicle in the fleet
+    char searchMake[] = "Ford";
+    char searchModel[] = "Focus";
+
+    int index = findVehicleIndex(&fleet, searchMake, searchModel);
+    if (index != -1) {
+        printf("\nFound vehicle: %s %s\n", searchMake, searchModel);
+        printVehicle(&fleet, &fleet.vehicles[index]);
+    } else {
+        printf("\nVehicle not found: %s %s\n", searchMake, searchModel);
+    }
+
+    // Remove a vehicle from the fleet
+    if (removeVehicle(&fleet, "Toyota", "Corolla") == 0) {
+        printf("\nVehicle removed successfully!\n");
+    } else {
+        printf("\nError: Vehicle not found for removal.\n");
+    }
+
+    // Display the updated fleet
+    printf("\nUpdated Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+    fleetFree(&fleet);
+
+    // strcmp scan vs interned (make, model) index
+    printf("\n---- Search Benchmark ----\n");
+    runSearchBenchmark(1000, 100000);
+    runSearchBenchmark(100000, 2000);
+    runSearchBenchmark(200000, 1000);
+
+    return 0;
+}
@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+#define MAX_SENSORS 5
+#define SENSOR_TYPE_COUNT 5
+#define KERNEL_BLOCK 16     // Sensors per kernel step (one AVX2 register of uint16_t)
+#define RNG_LANES 8         // 8 x 32-bit xorshift lanes = 16 random uint16_t per step
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// One column per sensor type: values, fault flags and owners in separate arrays
+typedef struct {
+    uint16_t *values;
+    uint8_t *is_faulty;       // 0 = Normal, 1 = Faulty
+    uint32_t *owner;          // Vehicle index that owns each sensor
+    int count;
+    int capacity;             // Always a multiple of KERNEL_BLOCK
+    uint32_t rng[RNG_LANES];  // Drift generator state for this column
+} SensorColumn;
+
+// Where a vehicle's sensor lives in the column store
+typedef struct {
+    uint8_t type;
+    uint32_t slot;
+} SensorRef;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorRef sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management (column storage mode)
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int capacity;
+    SensorColumn columns[SENSOR_TYPE_COUNT];
+} FleetManager;
+
+// Fault rule per type: faulty when value > threshold (faultAbove) or value < threshold
+typedef struct {
+    uint16_t threshold;
+    uint8_t faultAbove;
+} FaultRule;
+
+static const FaultRule faultRules[SENSOR_TYPE_COUNT] = {
+    {90, 1},   // TEMPERATURE_SENSOR: > 90
+    {180, 1},  // SPEED_SENSOR: > 180
+    {10, 0},   // FUEL_SENSOR: < 10
+    {20, 0},   // BRAKE_PRESSURE_SENSOR: < 20
+    {11, 0}    // BATTERY_VOLTAGE_SENSOR: < 11
+};
+
+// Kernel: apply drift (-2..+2, clamped at 0) and re-evaluate faults for a whole column
+typedef void (*ColumnKernel)(SensorColumn *column, uint16_t threshold, int faultAbove);
+
+// Global Fleet Object
+FleetManager fleet;
+ColumnKernel columnKernel;
+const char *columnKernelName;
+
+// Function Prototypes
+void fleetInit(int vehicleCapacity);
+void fleetFree(void);
+int addVehicle(char *id, uint8_t status);
+int addSensor(Vehicle *vehicle, SensorType type, uint16_t value);
+void assignRandomSensors(Vehicle *vehicle);
+void updateFleetSensors(void);
+void processFleet(void);
+void selectColumnKernel(void);
+void updateColumnScalar(SensorColumn *column, uint16_t threshold, int faultAbove);
+void printSensor(SensorType type, uint16_t value, uint8_t is_faulty);
+void runKernelBenchmark(int numSensors, int ticks);
+
+// ---------------- Column store ----------------
+
+static int columnReserve(SensorColumn *column, int capacity) {
+    if (capacity <= column->capacity) return 0;
+    capacity = (capacity + KERNEL_BLOCK - 1) / KERNEL_BLOCK * KERNEL_BLOCK;
+
+    uint16_t *values = realloc(column->values, sizeof(uint16_t) * capacity);
+    if (values == NULL) return -1;
+    column->values = values;
+    uint8_t *faulty = realloc(column->is_faulty, capacity);
+    if (faulty == NULL) return -1;
+    column->is_faulty = faulty;
+    uint32_t *owner = realloc(column->owner, sizeof(uint32_t) * capacity);
+    if (owner == NULL) return -1;
+    column->owner = owner;
+
+    // Padding past 'count' is processed by the kernels too, keep it defined
+    memset(column->values + column->capacity, 0, sizeof(uint16_t) * (capacity - column->capacity));
+    memset(column->is_faulty + column->capacity, 0, capacity - column->capacity);
+    column->capacity = capacity;
+    return 0;
+}
+
+void fleetInit(int vehicleCapacity) {
+    memset(&fleet, 0, sizeof(fleet));
+    fleet.vehicles = malloc(sizeof(Vehicle) * vehicleCapacity);
+    fleet.capacity = fleet.vehicles ? vehicleCapacity : 0;
+
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        for (int l = 0; l < RNG_LANES; l++) {
+            fleet.columns[t].rng[l] = 0x9E3779B9U * (uint32_t)(t * RNG_LANES + l + 1);
+        }
+    }
+}
+
+void fleetFree(void) {
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        free(fleet.columns[t].values);
+        free(fleet.columns[t].is_faulty);
+        free(fleet.columns[t].owner);
+    }
+    free(fleet.vehicles);
+    memset(&fleet, 0, sizeof(fleet));
+}
+
+// Function to Add a Vehicle
+int addVehicle(char *id, uint8_t status) {
+    if (fleet.count >= fleet.capacity) return -1;
+
+    Vehicle *v = &fleet.vehicles[fleet.count];
+    strncpy(v->id, id, sizeof(v->id) - 1);
+    v->id[sizeof(v->id) - 1] = '\0';
+    v->status = status;
+    v->sensor_count = 0;
+    return fleet.count++;
+}
+
+// Append a sensor to its type column and remember where it went
+int addSensor(Vehicle *vehicle, SensorType type, uint16_t value) {
+    if (vehicle->sensor_count >= MAX_SENSORS) return -1;
+
+    SensorColumn *column = &fleet.columns[type];
+    if (column->count == column->capacity && columnReserve(column, column->capacity ? column->capacity * 2 : 64) != 0) {
+        return -1;
+    }
+
+    uint32_t slot = (uint32_t)column->count++;
+    column->values[slot] = value;
+    column->is_faulty[slot] = 0;
+    column->owner[slot] = (uint32_t)(vehicle - fleet.vehicles);
+
+    vehicle->sensors[vehicle->sensor_count].type = (uint8_t)type;
+    vehicle->sensors[vehicle->sensor_count].slot = slot;
+    vehicle->sensor_count++;
+    return 0;
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    for (int i = 0; i < num_sensors; i++) {
+        addSensor(vehicle, (SensorType)(rand() % SENSOR_TYPE_COUNT), (rand() % 50) + 10);
+    }
+}
+
+// ---------------- Kernels ----------------
+// All kernels consume the same xorshift32 lane stream, so they give bit-identical results.
+
+static inline uint32_t xorshift32(uint32_t x) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static inline uint16_t driftValue(uint16_t value, uint16_t random) {
+    uint32_t v = value + ((random * 5U) >> 16);  // + 0..4
+    if (v > UINT16_MAX) v = UINT16_MAX;
+    return v < 2 ? 0 : (uint16_t)(v - 2);        // - 2, never below 0
+}
+
+void updateColumnScalar(SensorColumn *column, uint16_t threshold, int faultAbove) {
+    uint32_t rng[RNG_LANES];
+    memcpy(rng, column->rng, sizeof(rng));
+
+    for (int base = 0; base < column->count; base += KERNEL_BLOCK) {
+        for (int l = 0; l < RNG_LANES; l++) {
+            rng[l] = xorshift32(rng[l]);
+            uint16_t *v = &column->values[base + 2 * l];
+            v[0] = driftValue(v[0], (uint16_t)rng[l]);
+            v[1] = driftValue(v[1], (uint16_t)(rng[l] >> 16));
+        }
+        for (int i = base; i < base + KERNEL_BLOCK; i++) {
+            uint16_t v = column->values[i];
+            column->is_faulty[i] = faultAbove ? (v > threshold) : (v < threshold);
+        }
+    }
+    memcpy(column->rng, rng, sizeof(rng));
+}
+
+#ifdef HAVE_X86_SIMD
+static inline __m128i xorshift32x4(__m128i x) {
+    x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+    x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+    return _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+}
+
+// 8 sensors: drift + fault flag (0/1 per uint16_t lane)
+static inline __m128i driftAndCheck8(uint16_t *values, __m128i random, __m128i threshold, int faultAbove) {
+    const __m128i five = _mm_set1_epi16(5);
+    const __m128i two = _mm_set1_epi16(2);
+    const __m128i one = _mm_set1_epi16(1);
+
+    __m128i v = _mm_loadu_si128((__m128i *)values);
+    v = _mm_subs_epu16(_mm_adds_epu16(v, _mm_mulhi_epu16(random, five)), two);
+    _mm_storeu_si128((__m128i *)values, v);
+
+    // Saturating difference is non-zero exactly when the threshold is crossed
+    __m128i over = faultAbove ? _mm_subs_epu16(v, threshold) : _mm_subs_epu16(threshold, v);
+    return _mm_add_epi16(_mm_cmpeq_epi16(over, _mm_setzero_si128()), one);
+}
+
+static void updateColumnSSE2(SensorColumn *column, uint16_t threshold, int faultAbove) {
+    __m128i rngLo = _mm_loadu_si128((__m128i *)&column->rng[0]);
+    __m128i rngHi = _mm_loadu_si128((__m128i *)&column->rng[4]);
+    __m128i limit = _mm_set1_epi16((short)threshold);
+
+    for (int base = 0; base < column->count; base += KERNEL_BLOCK) {
+        rngLo = xorshift32x4(rngLo);
+        rngHi = xorshift32x4(rngHi);
+        __m128i faultLo = driftAndCheck8(&column->values[base], rngLo, limit, faultAbove);
+        __m128i faultHi = driftAndCheck8(&column->values[base + 8], rngHi, limit, faultAbove);
+        _mm_storeu_si128((__m128i *)&column->is_faulty[base], _mm_packus_epi16(faultLo, faultHi));
+    }
+    _mm_storeu_si128((__m128i *)&column->rng[0], rngLo);
+    _mm_storeu_si128((__m128i *)&column->rng[4], rngHi);
+}
+
+__attribute__((target("avx2")))
+static void updateColumnAVX2(SensorColumn *column, uint16_t threshold, int faultAbove) {
+    const __m256i five = _mm256_set1_epi16(5);
+    const __m256i two = _mm256_set1_epi16(2);
+    const __m256i one = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i rng = _mm256_loadu_si256((__m256i *)column->rng);
+    __m256i limit = _mm256_set1_epi16((short)threshold);
+
+    for (int base = 0; base < column->count; base += KERNEL_BLOCK) {
+        rng = _mm256_xor_si256(rng, _mm256_slli_epi32(rng, 13));
+        rng = _mm256_xor_si256(rng, _mm256_srli_epi32(rng, 17));
+        rng = _mm256_xor_si256(rng, _mm256_slli_epi32(rng, 5));
+
+        __m256i v = _mm256_loadu_si256((__m256i *)&column->values[base]);
+        v = _mm256_subs_epu16(_mm256_adds_epu16(v, _mm256_mulhi_epu16(rng, five)), two);
+        _mm256_storeu_si256((__m256i *)&column->values[base], v);
+
+        __m256i over = faultAbove ? _mm256_subs_epu16(v, limit) : _mm256_subs_epu16(limit, v);
+        __m256i fault = _mm256_add_epi16(_mm256_cmpeq_epi16(over, zero), one);
+        __m128i packed = _mm_packus_epi16(_mm256_castsi256_si128(fault), _mm256_extracti128_si256(fault, 1));
+        _mm_storeu_si128((__m128i *)&column->is_faulty[base], packed);
+    }
+    _mm256_storeu_si256((__m256i *)column->rng, rng);
+}
+#endif
+
+// Pick the widest kernel the CPU supports (SENSOR_KERNEL=scalar|sse2|avx2 overrides)
+void selectColumnKernel(void) {
+    const char *forced = getenv("SENSOR_KERNEL");
+    columnKernel = updateColumnScalar;
+    columnKernelName = "scalar";
+
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (forced == NULL || strcmp(forced, "sse2") == 0 || strcmp(forced, "avx2") == 0) {
+        columnKernel = updateColumnSSE2;
+        columnKernelName = "sse2";
+    }
+    if ((forced == NULL || strcmp(forced, "avx2") == 0) && __builtin_cpu_supports("avx2")) {
+        columnKernel = updateColumnAVX2;
+        columnKernelName = "avx2";
+    }
+#else
+    (void)forced;
+#endif
+}
+
+// Update Sensor Data in Real Time: one pass per type column
+void updateFleetSensors(void) {
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        columnKernel(&fleet.columns[t], faultRules[t].threshold, faultRules[t].faultAbove);
+    }
+}
+
+// ---------------- Output ----------------
+
+void printSensor(SensorType type, uint16_t value, uint8_t is_faulty) {
+    const char *flag = is_faulty ? "[FAULTY]" : "";
+    switch (type) {
+        case TEMPERATURE_SENSOR: printf("Temperature: %d°C %s\n", value, flag); break;
+        case SPEED_SENSOR: printf("Speed: %d km/h %s\n", value, flag); break;
+        case FUEL_SENSOR: printf("Fuel Level: %d%% %s\n", value, flag); break;
+        case BRAKE_PRESSURE_SENSOR: printf("Brake Pressure: %d bar %s\n", value, flag); break;
+        case BATTERY_VOLTAGE_SENSOR: printf("Battery Voltage: %dV %s\n", value, flag); break;
+    }
+}
+
+// Process the Entire Fleet
+void processFleet(void) {
+    updateFleetSensors();
+
+    for (int i = 0; i < fleet.count; i++) {
+        Vehicle *v = &fleet.vehicles[i];
+        printf("\nVehicle ID: %s\n", v->id);
+        for (int j = 0; j < v->sensor_count; j++) {
+            SensorColumn *column = &fleet.columns[v->sensors[j].type];
+            uint32_t slot = v->sensors[j].slot;
+            printSensor((SensorType)v->sensors[j].type, column->values[slot], column->is_faulty[slot]);
+        }
+    }
+}
+
+// ---------------- Benchmark ----------------
+
+static double elapsedMs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Array-of-structs reference: the original updateSensorData + checkSensorFault path
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty;
+} SensorData;
+
+static void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR: sensor->is_faulty = (sensor->value > 90) ? 1 : 0; break;
+        case SPEED_SENSOR: sensor->is_faulty = (sensor->value > 180) ? 1 : 0; break;
+        case FUEL_SENSOR: sensor->is_faulty = (sensor->value < 10) ? 1 : 0; break;
+        case BRAKE_PRESSURE_SENSOR: sensor->is_faulty = (sensor->value < 20) ? 1 : 0; break;
+        case BATTERY_VOLTAGE_SENSOR: sensor->is_faulty = (sensor->value < 11) ? 1 : 0; break;
+    }
+}
+
+static uint64_t fleetChecksum(void) {
+    uint64_t sum = 0;
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        for (int i = 0; i < fleet.columns[t].count; i++) {
+            sum = sum * 31 + fleet.columns[t].values[i] * 2 + fleet.columns[t].is_faulty[i];
+        }
+    }
+    return sum;
+}
+
+void runKernelBenchmark(int numSensors, int ticks) {
+    fleetInit(numSensors);
+    while (numSensors > 0) {
+        char id[10];
+        snprintf(id, sizeof(id), "VH%u", (unsigned)fleet.count % 10000000U);
+        int idx = addVehicle(id, 1);
+        int n = (rand() % MAX_SENSORS) + 1;
+        for (int i = 0; i < n && numSensors > 0; i++, numSensors--) {
+            addSensor(&fleet.vehicles[idx], (SensorType)(rand() % SENSOR_TYPE_COUNT), (rand() % 50) + 10);
+        }
+    }
+
+    // Snapshot so every kernel starts from the same state
+    SensorColumn snapshot[SENSOR_TYPE_COUNT];
+    int total = 0;
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        SensorColumn *c = &fleet.columns[t];
+        snapshot[t] = *c;
+        snapshot[t].values = malloc(sizeof(uint16_t) * c->capacity);
+        memcpy(snapshot[t].values, c->values, sizeof(uint16_t) * c->capacity);
+        total += c->count;
+    }
+
+    // Array-of-structs baseline with rand() per sensor
+    SensorData *aos = malloc(sizeof(SensorData) * total);
+    for (int t = 0, k = 0; t < SENSOR_TYPE_COUNT; t++) {
+        for (int i = 0; i < fleet.columns[t].count; i++, k++) {
+            aos[k] = (SensorData){(SensorType)t, fleet.columns[t].values[i], 0};
+        }
+    }
+    for (int k = total - 1; k > 0; k--) { // Mixed types, as stored per vehicle
+        int j = rand() % (k + 1);
+        SensorData tmp = aos[k]; aos[k] = aos[j]; aos[j] = tmp;
+    }
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int k = 0; k < total; k++) {
+            aos[k].value += (rand() % 5) - 2;
+            checkSensorFault(&aos[k]);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("%-8s %8d sensors | %7.3f ms/tick\n", "aos+rand", total, elapsedMs(t0, t1) / ticks);
+    free(aos);
+
+    ColumnKernel kernels[3] = {updateColumnScalar, NULL, NULL};
+    const char *names[3] = {"scalar", "sse2", "avx2"};
+#ifdef HAVE_X86_SIMD
+    kernels[1] = updateColumnSSE2;
+    if (__builtin_cpu_supports("avx2")) kernels[2] = updateColumnAVX2;
+#endif
+
+    for (int k = 0; k < 3; k++) {
+        if (kernels[k] == NULL) {
+            printf("%-8s not supported on this CPU\n", names[k]);
+            continue;
+        }
+        for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+            memcpy(fleet.columns[t].values, snapshot[t].values, sizeof(uint16_t) * snapshot[t].capacity);
+            memcpy(fleet.columns[t].rng, snapshot[t].rng, sizeof(snapshot[t].rng));
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int tick = 0; tick < ticks; tick++) {
+            for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+                kernels[k](&fleet.columns[t], faultRules[t].threshold, faultRules[t].faultAbove);
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        printf("%-8s %8d sensors | %7.3f ms/tick | checksum %016llx\n",
+               names[k], total, elapsedMs(t0, t1) / ticks, (unsigned long long)fleetChecksum());
+    }
+
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        free(snapshot[t].values);
+    }
+    fleetFree();
+}
+
+int main() {
+    srand(time(0)); // Seed random values
+    selectColumnKernel();
+
+    // Adding vehicles
+    fleetInit(5);
+    assignRandomSensors(&fleet.vehicles[addVehicle("VH123", 1)]);
+    assignRandomSensors(&fleet.vehicles[addVehicle("VH456", 1)]);
+
+    // Real-Time Simulation (a few ticks, then the throughput check)
+    printf("Sensor kernel: %s\n", columnKernelName);
+    for (int tick = 0; tick < 3; tick++) {
+        processFleet();
+    }
+    fleetFree();
+
+    printf("\n---- One Pass over 1M Sensors ----\n");
+    runKernelBenchmark(1000000, 50);
+
+    return 0;
+}
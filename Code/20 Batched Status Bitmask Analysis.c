@@ -0,0 +1,292 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SENSOR_COUNT 5
+
+// Sensor Types
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+// Compact status code, text is only looked up when a report is printed
+typedef enum {
+    STATUS_UNKNOWN,
+    STATUS_OK,
+    STATUS_WARN
+} SensorStatus;
+
+// Per-vehicle alert bits, one per sensor type
+#define ALERT_BIT(type) (1u << (type))
+#define ANALYZED_SENSORS (ALERT_BIT(TEMP_SENSOR) | ALERT_BIT(VOLTAGE_SENSOR) | ALERT_BIT(BRAKE_SENSOR) | ALERT_BIT(TIRE_SENSOR))
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    uint8_t status;   // SensorStatus
+} Sensor;
+
+// Diagnostic Info
+typedef struct {
+    float avgTemp;
+    float minVoltage;
+    int criticalSensors;
+} DiagnosticInfo;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[SENSOR_COUNT];
+    uint8_t alertMask;   // ALERT_BIT(type) set when that sensor is below its threshold
+    int healthStatus;
+} Vehicle;
+
+// Safety Module
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+// Warn when value < threshold (same rule as updateSensorStatus)
+static const float thresholds[SENSOR_COUNT] = {100, 12.0, 1, 30, 20};
+static const char *warnMessages[SENSOR_COUNT] = {"OVERHEAT", "LOW VOLTAGE", "BRAKE FAIL", "LOW PRESSURE", "OBSTACLE TOO CLOSE"};
+
+// Prototypes
+void initializeVehicle(Vehicle *v, const char *id);
+void simulateSensorInput(Vehicle *v);
+void analyzeSensorBatch(Vehicle *vehicles, DiagnosticInfo *diags, int count);
+void checkSafety(Vehicle *v, SafetyModule *safety);
+const char *sensorStatusText(const Sensor *s);
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety);
+void runBatchBenchmark(int numVehicles, int cycles);
+
+// Implementation
+
+void initializeVehicle(Vehicle *v, const char *id) {
+    strcpy(v->id, id);
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        v->sensors[i].type = i;
+        v->sensors[i].value = 0;
+        v->sensors[i].status = STATUS_UNKNOWN;
+    }
+    v->alertMask = 0;
+    v->healthStatus = 1;
+}
+
+void simulateSensorInput(Vehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+// Evaluate every threshold for a batch of vehicles without branches or string copies
+void analyzeSensorBatch(Vehicle *vehicles, DiagnosticInfo *diags, int count) {
+    for (int i = 0; i < count; i++) {
+        Vehicle *v = &vehicles[i];
+        unsigned mask = 0;
+
+        for (int t = 0; t < SENSOR_COUNT; t++) {
+            unsigned warn = v->sensors[t].value < thresholds[t];
+            mask |= warn << t;
+        }
+        // Distance only feeds the obstacle alert, its status stays Unknown as before
+        for (int t = 0; t < DISTANCE_SENSOR; t++) {
+            v->sensors[t].status = (uint8_t)(STATUS_OK + ((mask >> t) & 1u));
+        }
+
+        v->alertMask = (uint8_t)mask;
+        diags[i].avgTemp = v->sensors[TEMP_SENSOR].value;
+        diags[i].minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+        diags[i].criticalSensors = __builtin_popcount(mask & ANALYZED_SENSORS);
+    }
+}
+
+// Safety state is a bit test on the alert mask
+void checkSafety(Vehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->alertMask & ALERT_BIT(DISTANCE_SENSOR)) != 0;
+    safety->brakeFailure = (v->alertMask & ALERT_BIT(BRAKE_SENSOR)) != 0;
+    safety->tirePressureIssue = (v->alertMask & ALERT_BIT(TIRE_SENSOR)) != 0;
+}
+
+// Human-readable status, only resolved when printing
+const char *sensorStatusText(const Sensor *s) {
+    switch (s->status) {
+        case STATUS_OK: return "OK";
+        case STATUS_WARN: return warnMessages[s->type];
+        default: return "Unknown";
+    }
+}
+
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety) {
+    time_t now;
+    time(&now);
+
+    printf("\n--- Vehicle ID: %s ---\n", v->id);
+    printf("Time: %s", ctime(&now));
+    printf("Temp: %.1f (%s)\n", v->sensors[TEMP_SENSOR].value, sensorStatusText(&v->sensors[TEMP_SENSOR]));
+    printf("Voltage: %.1f (%s)\n", v->sensors[VOLTAGE_SENSOR].value, sensorStatusText(&v->sensors[VOLTAGE_SENSOR]));
+    printf("Brake: %s\n", sensorStatusText(&v->sensors[BRAKE_SENSOR]));
+    printf("Tire Pressure: %.1f (%s)\n", v->sensors[TIRE_SENSOR].value, sensorStatusText(&v->sensors[TIRE_SENSOR]));
+    printf("Distance: %.1fcm\n", v->sensors[DISTANCE_SENSOR].value);
+
+    if (safety->obstacleAlert)
+        printf("!!! ALERT: Obstacle too close\n");
+    if (safety->brakeFailure)
+        printf("!!! ALERT: Brake Failure\n");
+    if (safety->tirePressureIssue)
+        printf("!!! ALERT: Tire Pressure Issue\n");
+
+    printf("Health Score: %s\n", diag->criticalSensors > 0 ? "UNSAFE" : "SAFE");
+    printf("-------------------------\n");
+}
+
+// ---------------- Benchmark: string statuses vs bitmask batch ----------------
+
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} LegacySensor;
+
+typedef struct {
+    char id[10];
+    LegacySensor sensors[SENSOR_COUNT];
+    int healthStatus;
+} LegacyVehicle;
+
+static void legacyUpdateSensorStatus(LegacySensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+static void legacyAnalyzeSensors(LegacyVehicle *v, DiagnosticInfo *diag) {
+    diag->criticalSensors = 0;
+    legacyUpdateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    diag->avgTemp = v->sensors[TEMP_SENSOR].value;
+    legacyUpdateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    diag->minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+    legacyUpdateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    legacyUpdateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+}
+
+static void legacyCheckSafety(LegacyVehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+static double elapsedMs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+void runBatchBenchmark(int numVehicles, int cycles) {
+    Vehicle *fleet = malloc(sizeof(Vehicle) * numVehicles);
+    LegacyVehicle *legacy = malloc(sizeof(LegacyVehicle) * numVehicles);
+    DiagnosticInfo *diags = calloc(numVehicles, sizeof(DiagnosticInfo));
+    SafetyModule *safety = calloc(numVehicles, sizeof(SafetyModule));
+    SafetyModule legacySafety;
+    DiagnosticInfo legacyDiag;
+
+    for (int i = 0; i < numVehicles; i++) {
+        initializeVehicle(&fleet[i], "VH700");
+        simulateSensorInput(&fleet[i]);
+        strcpy(legacy[i].id, fleet[i].id);
+        for (int t = 0; t < SENSOR_COUNT; t++) {
+            legacy[i].sensors[t].type = t;
+            legacy[i].sensors[t].value = fleet[i].sensors[t].value;
+            strcpy(legacy[i].sensors[t].status, "Unknown");
+        }
+    }
+
+    struct timespec t0, t1;
+    long alerts = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int c = 0; c < cycles; c++) {
+        for (int i = 0; i < numVehicles; i++) {
+            legacyAnalyzeSensors(&legacy[i], &legacyDiag);
+            legacyCheckSafety(&legacy[i], &legacySafety);
+            alerts += legacySafety.brakeFailure + legacySafety.tirePressureIssue + legacySafety.obstacleAlert;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double legacyMs = elapsedMs(t0, t1) / cycles;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int c = 0; c < cycles; c++) {
+        analyzeSensorBatch(fleet, diags, numVehicles);
+        for (int i = 0; i < numVehicles; i++) {
+            checkSafety(&fleet[i], &safety[i]);
+            alerts -= safety[i].brakeFailure + safety[i].tirePressureIssue + safety[i].obstacleAlert;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double batchMs = elapsedMs(t0, t1) / cycles;
+
+    // Both paths must agree on every status string and safety flag
+    int mismatches = alerts != 0;
+    for (int i = 0; i < numVehicles; i++) {
+        legacyAnalyzeSensors(&legacy[i], &legacyDiag);
+        legacyCheckSafety(&legacy[i], &legacySafety);
+        for (int t = 0; t < DISTANCE_SENSOR; t++) {
+            mismatches += strcmp(legacy[i].sensors[t].status, sensorStatusText(&fleet[i].sensors[t])) != 0;
+        }
+        mismatches += memcmp(&legacySafety, &safety[i], sizeof(SafetyModule)) != 0;
+        mismatches += legacyDiag.criticalSensors != diags[i].criticalSensors;
+    }
+
+    printf("%8d vehicles | strcpy/strcmp %8.3f ms/cycle | bitmask batch %8.3f ms/cycle | %.1fx | mismatches %d\n",
+           numVehicles, legacyMs, batchMs, legacyMs / batchMs, mismatches);
+
+    free(fleet);
+    free(legacy);
+    free(diags);
+    free(safety);
+}
+
+// Main
+int main() {
+    srand(time(NULL));
+    Vehicle fleet[3];
+    DiagnosticInfo diags[3];
+    SafetyModule safety;
+    int numVehicles = sizeof(fleet) / sizeof(fleet[0]);
+
+    initializeVehicle(&fleet[0], "VH700");
+    initializeVehicle(&fleet[1], "VH701");
+    initializeVehicle(&fleet[2], "VH702");
+
+    for (int cycle = 0; cycle < 3; cycle++) {
+        for (int i = 0; i < numVehicles; i++) {
+            simulateSensorInput(&fleet[i]);
+        }
+        analyzeSensorBatch(fleet, diags, numVehicles);
+        for (int i = 0; i < numVehicles; i++) {
+            checkSafety(&fleet[i], &safety);
+            logHealthStatus(&fleet[i], &diags[i], &safety);
+        }
+        sleep(1);
+    }
+
+    printf("\n---- Analysis Benchmark ----\n");
+    runBatchBenchmark(1000, 1000);
+    runBatchBenchmark(100000, 20);
+    runBatchBenchmark(1000000, 5);
+
+    return 0;
+}
@@ -0,0 +1,482 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define MAX_SENSORS 3
+#define MAX_VEHICLES 2
+#define MAX_RULES 64
+#define MAX_CLASSES 8
+#define MAX_EDGES 4                      // Distinct thresholds per (class, sensor type)
+#define MAX_REGIONS (2 * MAX_EDGES + 1)  // Below/at/above every edge
+#define STATUS_NORMAL 0                  // Status ID 0 = "Normal", rule i = status ID i + 1
+
+// Sensor Types
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE,
+    SENSOR_TYPE_COUNT
+} SensorType;
+
+typedef enum {
+    SEVERITY_NORMAL,
+    SEVERITY_WARNING,
+    SEVERITY_CRITICAL
+} Severity;
+
+typedef enum {
+    OP_LESS,
+    OP_LESS_EQUAL,
+    OP_GREATER,
+    OP_GREATER_EQUAL
+} CompareOp;
+
+// One line of the rule file
+typedef struct {
+    int classId;
+    SensorType type;
+    CompareOp op;
+    float threshold;
+    Severity severity;
+    char message[32];
+} ThresholdRule;
+
+// Rules as loaded, plus the vehicle class names they refer to
+typedef struct {
+    ThresholdRule rules[MAX_RULES];
+    int ruleCount;
+    char classNames[MAX_CLASSES][16];
+    int classCount;
+} RuleSet;
+
+// Compiled row: sorted edges split the value axis into regions, each with a fixed status
+typedef struct {
+    float edges[MAX_EDGES];           // Unused edges are +INFINITY
+    uint8_t regionStatus[MAX_REGIONS];
+} DecisionRow;
+
+// Flat decision table indexed by [class][sensor type]
+typedef struct {
+    DecisionRow rows[MAX_CLASSES][SENSOR_TYPE_COUNT];
+    int edgeWidth;                    // 1, 2 or MAX_EDGES: edges the hot loop has to test
+    const RuleSet *rules;             // For status text and severity
+} DecisionTable;
+
+// Sensor Structure
+typedef struct {
+    SensorType type;
+    float value;
+    uint8_t status;    // Status ID from the decision table
+} Sensor;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    int classId;
+    Sensor sensors[MAX_SENSORS];
+} Vehicle;
+
+// Function Prototypes
+int loadRules(RuleSet *set, const char *path);
+void loadDefaultRules(RuleSet *set);
+int findClass(const RuleSet *set, const char *name);
+int compileRules(const RuleSet *set, DecisionTable *table);
+const char *statusText(const DecisionTable *table, uint8_t status);
+void initializeVehicle(Vehicle *vehicle, const char *id, int classId);
+void updateSensorData(Vehicle *vehicle);
+void analyzeVehicle(const DecisionTable *table, Vehicle *vehicle);
+void analyzeFleet(const DecisionTable *table, Vehicle *vehicles, int count);
+void performDiagnostics(const DecisionTable *table, Vehicle *vehicle);
+void logAlert(Vehicle *vehicle, const char *message);
+void runRuleBenchmark(const DecisionTable *table, int numVehicles, int cycles);
+
+static const char *sensorNames[SENSOR_TYPE_COUNT] = {"ENGINE_TEMP", "OIL_PRESSURE", "BATTERY_VOLTAGE"};
+static const char *severityNames[] = {"NORMAL", "WARNING", "CRITICAL"};
+static const char *opNames[] = {"<", "<=", ">", ">="};
+
+// ---------------- Loading ----------------
+
+static int lookupName(const char *names[], int count, const char *name) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(names[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+int findClass(const RuleSet *set, const char *name) {
+    for (int i = 0; i < set->classCount; i++) {
+        if (strcmp(set->classNames[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+static int addClass(RuleSet *set, const char *name) {
+    int id = findClass(set, name);
+    if (id != -1) return id;
+    if (set->classCount == MAX_CLASSES) return -1;
+
+    snprintf(set->classNames[set->classCount], sizeof(set->classNames[0]), "%s", name);
+    return set->classCount++;
+}
+
+// Load "class sensor op threshold severity message" lines. Returns rules loaded or -1.
+int loadRules(RuleSet *set, const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) return -1;
+
+    memset(set, 0, sizeof(*set));
+    addClass(set, "default"); // Class 0 is always the fallback
+
+    char line[256];
+    int lineNo = 0;
+    while (fgets(line, sizeof(line), file)) {
+        char className[16], sensor[32], op[4], severity[16], message[32];
+        float threshold;
+        lineNo++;
+
+        char *start = line + strspn(line, " \t");
+        if (*start == '#' || *start == '\n' || *start == '\0') continue;
+
+        if (sscanf(start, "%15s %31s %3s %f %15s %31[^\n]", className, sensor, op, &threshold, severity, message) != 6) {
+            printf("Error: %s:%d: expected 'class sensor op threshold severity message'\n", path, lineNo);
+            continue;
+        }
+
+        ThresholdRule rule;
+        rule.classId = addClass(set, className);
+        rule.type = lookupName(sensorNames, SENSOR_TYPE_COUNT, sensor);
+        rule.op = lookupName(opNames, 4, op);
+        rule.severity = lookupName(severityNames, 3, severity);
+        rule.threshold = threshold;
+        snprintf(rule.message, sizeof(rule.message), "%s", message);
+
+        if (rule.classId < 0 || (int)rule.type < 0 || (int)rule.op < 0 || (int)rule.severity < 0) {
+            printf("Error: %s:%d: unknown class, sensor, operator or severity\n", path, lineNo);
+            continue;
+        }
+        if (set->ruleCount == MAX_RULES) {
+            printf("Error: %s:%d: more than %d rules\n", path, lineNo, MAX_RULES);
+            break;
+        }
+        set->rules[set->ruleCount++] = rule;
+    }
+
+    fclose(file);
+    return set->ruleCount;
+}
+
+// The thresholds that used to be hard-coded in analyzeSensor
+void loadDefaultRules(RuleSet *set) {
+    memset(set, 0, sizeof(*set));
+    addClass(set, "default");
+    set->rules[set->ruleCount++] = (ThresholdRule){0, ENGINE_TEMP, OP_GREATER, 110, SEVERITY_WARNING, "Overheat"};
+    set->rules[set->ruleCount++] = (ThresholdRule){0, OIL_PRESSURE, OP_LESS, 25, SEVERITY_WARNING, "Low Pressure"};
+    set->rules[set->ruleCount++] = (ThresholdRule){0, BATTERY_VOLTAGE, OP_LESS, 11.5, SEVERITY_WARNING, "Low Battery"};
+}
+
+// ---------------- Compiling ----------------
+
+static int ruleMatches(const ThresholdRule *rule, float value) {
+    switch (rule->op) {
+        case OP_LESS: return value < rule->threshold;
+        case OP_LESS_EQUAL: return value <= rule->threshold;
+        case OP_GREATER: return value > rule->threshold;
+        case OP_GREATER_EQUAL: return value >= rule->threshold;
+    }
+    return 0;
+}
+
+static int compareFloats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// Region index for a value: two comparisons per edge (at or past it, strictly past it).
+// 'width' is a constant at every call site, so the loop unrolls away.
+static inline __attribute__((always_inline)) int regionOf(const DecisionRow *row, float value, int width) {
+    int region = 0;
+    for (int k = 0; k < width; k++) {
+        region += (value >= row->edges[k]) + (value > row->edges[k]);
+    }
+    return region;
+}
+
+// Build one row from the rules that apply to (class, type)
+static int compileRow(const RuleSet *set, int classId, SensorType type, DecisionRow *row) {
+    int active[MAX_RULES], activeCount = 0;
+    float edges[MAX_RULES];
+    int edgeCount = 0;
+
+    for (int i = 0; i < set->ruleCount; i++) {
+        if (set->rules[i].classId == classId && set->rules[i].type == type) {
+            active[activeCount++] = i;
+        }
+    }
+    // A class without rules for this sensor inherits the default class
+    if (activeCount == 0 && classId != 0) {
+        return compileRow(set, 0, type, row);
+    }
+
+    for (int i = 0; i < activeCount; i++) {
+        edges[edgeCount++] = set->rules[active[i]].threshold;
+    }
+    qsort(edges, edgeCount, sizeof(float), compareFloats);
+    int unique = 0;
+    for (int i = 0; i < edgeCount; i++) {
+        if (unique == 0 || edges[i] != edges[unique - 1]) edges[unique++] = edges[i];
+    }
+    if (unique > MAX_EDGES) {
+        printf("Error: %s %s has %d thresholds, at most %d supported\n",
+               set->classNames[classId], sensorNames[type], unique, MAX_EDGES);
+        return -1;
+    }
+
+    for (int k = 0; k < MAX_EDGES; k++) {
+        row->edges[k] = k < unique ? edges[k] : INFINITY;
+    }
+
+    // Evaluate the rules once per region using a representative value
+    for (int region = 0; region < MAX_REGIONS; region++) {
+        int k = region / 2;
+        float sample;
+        if (unique == 0) sample = 0;
+        else if (region % 2 == 1) sample = k < unique ? edges[k] : INFINITY;
+        else if (k == 0) sample = edges[0] - 1.0f;
+        else if (k >= unique) sample = edges[unique - 1] + 1.0f;
+        else sample = (edges[k - 1] + edges[k]) / 2.0f;
+
+        uint8_t status = STATUS_NORMAL;
+        Severity worst = SEVERITY_NORMAL;
+        for (int i = 0; i < activeCount; i++) {
+            const ThresholdRule *rule = &set->rules[active[i]];
+            if (ruleMatches(rule, sample) && rule->severity > worst) {
+                worst = rule->severity;
+                status = (uint8_t)(active[i] + 1);
+            }
+        }
+        row->regionStatus[region] = status;
+    }
+    return 0;
+}
+
+int compileRules(const RuleSet *set, DecisionTable *table) {
+    table->rules = set;
+    int widest = 0;
+    for (int c = 0; c < MAX_CLASSES; c++) {
+        for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+            int classId = c < set->classCount ? c : 0;
+            DecisionRow *row = &table->rows[c][t];
+            if (compileRow(set, classId, t, row) != 0) return -1;
+            for (int k = 0; k < MAX_EDGES; k++) {
+                if (row->edges[k] != INFINITY && k + 1 > widest) widest = k + 1;
+            }
+        }
+    }
+    table->edgeWidth = widest <= 1 ? 1 : widest <= 2 ? 2 : MAX_EDGES;
+    return 0;
+}
+
+const char *statusText(const DecisionTable *table, uint8_t status) {
+    return status == STATUS_NORMAL ? "Normal" : table->rules->rules[status - 1].message;
+}
+
+// ---------------- Diagnostics ----------------
+
+// Initialize Vehicle with Default Data
+void initializeVehicle(Vehicle *vehicle, const char *id, int classId) {
+    strcpy(vehicle->id, id);
+    vehicle->classId = classId;
+    vehicle->sensors[ENGINE_TEMP] = (Sensor){ENGINE_TEMP, 90.0, STATUS_NORMAL};
+    vehicle->sensors[OIL_PRESSURE] = (Sensor){OIL_PRESSURE, 40.0, STATUS_NORMAL};
+    vehicle->sensors[BATTERY_VOLTAGE] = (Sensor){BATTERY_VOLTAGE, 12.6, STATUS_NORMAL};
+}
+
+// Update Sensor Data (Simulation)
+void updateSensorData(Vehicle *vehicle) {
+    vehicle->sensors[ENGINE_TEMP].value = 80 + rand() % 40;         // 80 to 120
+    vehicle->sensors[OIL_PRESSURE].value = 20 + rand() % 40;        // 20 to 60
+    vehicle->sensors[BATTERY_VOLTAGE].value = 11 + ((rand() % 30) / 10.0); // 11.0 to 13.9
+}
+
+// Hot path: one row lookup and a fixed number of comparisons per sensor
+static inline __attribute__((always_inline)) void analyzeWithWidth(const DecisionTable *table, Vehicle *vehicles, int count, int width) {
+    for (int v = 0; v < count; v++) {
+        const DecisionRow *rows = table->rows[vehicles[v].classId];
+        for (int i = 0; i < MAX_SENSORS; i++) {
+            Sensor *s = &vehicles[v].sensors[i];
+            const DecisionRow *row = &rows[s->type];
+            s->status = row->regionStatus[regionOf(row, s->value, width)];
+        }
+    }
+}
+
+// Pick the unrolled loop once per batch, never per sensor
+void analyzeFleet(const DecisionTable *table, Vehicle *vehicles, int count) {
+    if (table->edgeWidth == 1) analyzeWithWidth(table, vehicles, count, 1);
+    else if (table->edgeWidth == 2) analyzeWithWidth(table, vehicles, count, 2);
+    else analyzeWithWidth(table, vehicles, count, MAX_EDGES);
+}
+
+void analyzeVehicle(const DecisionTable *table, Vehicle *vehicle) {
+    analyzeFleet(table, vehicle, 1);
+}
+
+// Diagnostics Function (uses the compiled table)
+void performDiagnostics(const DecisionTable *table, Vehicle *vehicle) {
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    analyzeVehicle(table, vehicle);
+
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                statusText(table, vehicle->sensors[i].status));
+
+        if (vehicle->sensors[i].status != STATUS_NORMAL) {
+            logAlert(vehicle, statusText(table, vehicle->sensors[i].status));
+        }
+    }
+}
+
+// Log Alert
+void logAlert(Vehicle *vehicle, const char *message) {
+    time_t now;
+    time(&now);
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+// ---------------- Benchmark ----------------
+
+// The hand-written switch from analyzeSensor, producing status IDs instead of strings
+static inline uint8_t handWrittenStatus(const Sensor *sensor) {
+    switch (sensor->type) {
+        case ENGINE_TEMP: return sensor->value > 110 ? 1 : STATUS_NORMAL;
+        case OIL_PRESSURE: return sensor->value < 25 ? 2 : STATUS_NORMAL;
+        case BATTERY_VOLTAGE: return sensor->value < 11.5 ? 3 : STATUS_NORMAL;
+        default: return STATUS_NORMAL;
+    }
+}
+
+// Original analyzeSensor with strcpy'd status strings
+static void legacyAnalyzeSensor(const Sensor *sensor, char status[20]) {
+    switch (sensor->type) {
+        case ENGINE_TEMP: strcpy(status, sensor->value > 110 ? "Overheat" : "Normal"); break;
+        case OIL_PRESSURE: strcpy(status, sensor->value < 25 ? "Low Pressure" : "Normal"); break;
+        case BATTERY_VOLTAGE: strcpy(status, sensor->value < 11.5 ? "Low Battery" : "Normal"); break;
+        default: break;
+    }
+}
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Compare the compiled table with the hand-written switch (same default rules)
+void runRuleBenchmark(const DecisionTable *table, int numVehicles, int cycles) {
+    Vehicle *fleet = malloc(sizeof(Vehicle) * numVehicles);
+    char (*legacyStatus)[MAX_SENSORS][20] = malloc(sizeof(*legacyStatus) * numVehicles);
+    for (int i = 0; i < numVehicles; i++) {
+        initializeVehicle(&fleet[i], "V100", 0);
+        updateSensorData(&fleet[i]);
+    }
+
+    struct timespec t0, t1;
+    long sensors = (long)numVehicles * MAX_SENSORS * cycles;
+    long checksum = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int c = 0; c < cycles; c++) {
+        for (int i = 0; i < numVehicles; i++) {
+            for (int j = 0; j < MAX_SENSORS; j++) {
+                legacyAnalyzeSensor(&fleet[i].sensors[j], legacyStatus[i][j]);
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double legacyNs = elapsedNs(t0, t1) / sensors;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int c = 0; c < cycles; c++) {
+        for (int i = 0; i < numVehicles; i++) {
+            for (int j = 0; j < MAX_SENSORS; j++) {
+                fleet[i].sensors[j].status = handWrittenStatus(&fleet[i].sensors[j]);
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double switchNs = elapsedNs(t0, t1) / sensors;
+    for (int i = 0; i < numVehicles; i++) {
+        for (int j = 0; j < MAX_SENSORS; j++) checksum += fleet[i].sensors[j].status;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int c = 0; c < cycles; c++) {
+        analyzeFleet(table, fleet, numVehicles);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double tableNs = elapsedNs(t0, t1) / sensors;
+
+    // With the default rules, the table must give the same answer as the switch
+    int mismatches = 0;
+    for (int i = 0; i < numVehicles; i++) {
+        for (int j = 0; j < MAX_SENSORS; j++) {
+            mismatches += strcmp(statusText(table, fleet[i].sensors[j].status), legacyStatus[i][j]) != 0;
+            checksum -= fleet[i].sensors[j].status;
+        }
+    }
+
+    printf("%8d vehicles | strcpy switch %5.2f ns/sensor | hand-written switch %5.2f ns/sensor | decision table %5.2f ns/sensor | mismatches %d (checksum delta %ld)\n",
+           numVehicles, legacyNs, switchNs, tableNs, mismatches, checksum);
+
+    free(legacyStatus);
+    free(fleet);
+}
+
+// Main Function
+int main(int argc, char *argv[]) {
+    srand(time(0));
+    const char *path = argc > 1 ? argv[1] : "sensor_rules.txt";
+
+    static RuleSet rules;
+    static DecisionTable table;
+    if (loadRules(&rules, path) <= 0) {
+        printf("No rules loaded from %s, using built-in defaults\n", path);
+        loadDefaultRules(&rules);
+    }
+    if (compileRules(&rules, &table) != 0) {
+        return 1;
+    }
+
+    printf("Loaded %d rules for %d vehicle classes\n", rules.ruleCount, rules.classCount);
+    for (int i = 0; i < rules.ruleCount; i++) {
+        ThresholdRule *r = &rules.rules[i];
+        printf("  %-8s %-16s %-2s %6.2f %-8s %s\n", rules.classNames[r->classId], sensorNames[r->type],
+               opNames[r->op], r->threshold, severityNames[r->severity], r->message);
+    }
+
+    Vehicle fleet[MAX_VEHICLES];
+    int truck = findClass(&rules, "truck");
+    initializeVehicle(&fleet[0], "V101", 0);
+    initializeVehicle(&fleet[1], "V102", truck != -1 ? truck : 0);
+
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        updateSensorData(&fleet[i]);
+        performDiagnostics(&table, &fleet[i]);
+    }
+
+    // Benchmark always runs on the built-in rules so it matches the hand-written switch
+    static RuleSet defaults;
+    static DecisionTable defaultTable;
+    loadDefaultRules(&defaults);
+    compileRules(&defaults, &defaultTable);
+
+    printf("\n---- Rule Evaluation Benchmark ----\n");
+    runRuleBenchmark(&defaultTable, 1000, 2000);
+    runRuleBenchmark(&defaultTable, 100000, 20);
+    runRuleBenchmark(&defaultTable, 1000000, 3);
+
+    return 0;
+}
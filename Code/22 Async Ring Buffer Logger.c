@@ -0,0 +1,468 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+
+// Build: gcc -O2 -pthread "22 Async Ring Buffer Logger.c"
+
+#define MAX_VEHICLES 5
+#define MAX_SENSORS 5
+#define LOG_RECORD_SIZE 256            // One pre-formatted vehicle block per ring slot
+#define LOG_BATCH_BYTES (256 * 1024)   // Flusher writes at most this much per write()
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management
+typedef struct {
+    Vehicle vehicles[MAX_VEHICLES];
+    uint8_t count;
+} FleetManager;
+
+// What a producer does when the ring is full
+typedef enum {
+    LOG_DROP,   // Count the record as dropped and return immediately
+    LOG_BLOCK   // Yield until the flusher frees a slot (never waits on disk directly)
+} LogFullPolicy;
+
+// Ring slot; 'sequence' tells producers and the flusher who owns it
+typedef struct {
+    _Atomic size_t sequence;
+    uint16_t length;
+    char data[LOG_RECORD_SIZE];
+} LogSlot;
+
+// Logger: persistent fd, lock-free bounded ring, background flusher thread
+typedef struct {
+    LogSlot *slots;
+    size_t mask;                      // Slot count - 1 (power of two)
+    _Atomic size_t enqueuePos;
+    size_t dequeuePos;                // Flusher only
+    LogFullPolicy policy;
+
+    int fd;
+    char path[256];
+    size_t fileBytes;
+    size_t rotateBytes;               // Rotate when the file would pass this size (0 = never)
+    int keepFiles;                    // Rotated files kept: path.1 .. path.N
+
+    pthread_t flusher;
+    atomic_int running;
+    char *batch;
+
+    // Statistics
+    atomic_ulong recordsLogged;
+    atomic_ulong recordsDropped;
+    atomic_ulong bytesWritten;
+    atomic_ulong writeCalls;
+    atomic_ulong rotations;
+} Logger;
+
+// Global Fleet Object
+FleetManager fleet;
+Logger sensorLog;
+
+// Function Prototypes
+int loggerOpen(Logger *log, const char *path, size_t ringRecords, size_t rotateBytes, int keepFiles, LogFullPolicy policy);
+void loggerClose(Logger *log);
+int logSensorData(Logger *log, Vehicle *vehicle);
+void addVehicle(char *id, uint8_t status);
+void assignRandomSensors(Vehicle *vehicle);
+void updateSensorData(Vehicle *vehicle);
+void checkSensorFault(SensorData *sensor);
+void processFleet();
+void runLoggerBenchmark(int records);
+
+// ---------------- Logger ----------------
+
+static int openLogFile(Logger *log) {
+    log->fd = open(log->path, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (log->fd < 0) return -1;
+
+    struct stat st;
+    log->fileBytes = fstat(log->fd, &st) == 0 ? (size_t)st.st_size : 0;
+    return 0;
+}
+
+// path -> path.1 -> path.2 ... oldest beyond keepFiles is overwritten
+static void rotateLogFile(Logger *log) {
+    char from[300], to[300];
+    close(log->fd);
+
+    for (int i = log->keepFiles - 1; i >= 1; i--) {
+        snprintf(from, sizeof(from), "%s.%d", log->path, i);
+        snprintf(to, sizeof(to), "%s.%d", log->path, i + 1);
+        rename(from, to);
+    }
+    snprintf(to, sizeof(to), "%s.1", log->path);
+    rename(log->path, to);
+
+    openLogFile(log);
+    atomic_fetch_add(&log->rotations, 1);
+}
+
+static void writeBatch(Logger *log, const char *data, size_t length) {
+    if (log->rotateBytes && log->fileBytes > 0 && log->fileBytes + length > log->rotateBytes) {
+        rotateLogFile(log);
+    }
+    if (log->fd < 0) return;
+
+    size_t done = 0;
+    while (done < length) {
+        ssize_t n = write(log->fd, data + done, length - done);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        done += (size_t)n;
+    }
+    log->fileBytes += done;
+    atomic_fetch_add(&log->bytesWritten, done);
+    atomic_fetch_add(&log->writeCalls, 1);
+}
+
+// Move every published record into the batch buffer, write when full or drained
+static size_t drainRing(Logger *log) {
+    size_t used = 0, drained = 0;
+
+    for (;;) {
+        LogSlot *slot = &log->slots[log->dequeuePos & log->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        if (seq != log->dequeuePos + 1) break; // Nothing published here yet
+
+        if (used + slot->length > LOG_BATCH_BYTES) {
+            writeBatch(log, log->batch, used);
+            used = 0;
+        }
+        memcpy(log->batch + used, slot->data, slot->length);
+        used += slot->length;
+
+        // Hand the slot back to producers for the next lap
+        atomic_store_explicit(&slot->sequence, log->dequeuePos + log->mask + 1, memory_order_release);
+        log->dequeuePos++;
+        drained++;
+    }
+    if (used > 0) {
+        writeBatch(log, log->batch, used);
+    }
+    return drained;
+}
+
+static void *flusherThread(void *arg) {
+    Logger *log = arg;
+    struct timespec idle = {0, 1000000}; // 1 ms
+
+    while (atomic_load(&log->running)) {
+        if (drainRing(log) == 0) {
+            nanosleep(&idle, NULL);
+        }
+    }
+    drainRing(log); // Whatever producers published before close
+    return NULL;
+}
+
+int loggerOpen(Logger *log, const char *path, size_t ringRecords, size_t rotateBytes, int keepFiles, LogFullPolicy policy) {
+    memset(log, 0, sizeof(*log));
+    size_t capacity = 2;
+    while (capacity < ringRecords) capacity <<= 1;
+
+    log->slots = aligned_alloc(64, sizeof(LogSlot) * capacity);
+    log->batch = malloc(LOG_BATCH_BYTES);
+    if (log->slots == NULL || log->batch == NULL) {
+        free(log->slots);
+        free(log->batch);
+        return -1;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&log->slots[i].sequence, i);
+    }
+    log->mask = capacity - 1;
+    log->policy = policy;
+    log->rotateBytes = rotateBytes;
+    log->keepFiles = keepFiles > 0 ? keepFiles : 1;
+    snprintf(log->path, sizeof(log->path), "%s", path);
+
+    if (openLogFile(log) != 0) {
+        printf("Error: Cannot open log file %s\n", path);
+        free(log->slots);
+        free(log->batch);
+        return -1;
+    }
+
+    atomic_store(&log->running, 1);
+    if (pthread_create(&log->flusher, NULL, flusherThread, log) != 0) {
+        close(log->fd);
+        free(log->slots);
+        free(log->batch);
+        return -1;
+    }
+    return 0;
+}
+
+void loggerClose(Logger *log) {
+    atomic_store(&log->running, 0);
+    pthread_join(log->flusher, NULL);
+    if (log->fd >= 0) close(log->fd);
+    free(log->slots);
+    free(log->batch);
+    log->slots = NULL;
+    log->batch = NULL;
+}
+
+// Claim a free slot (lock-free, multi-producer safe). NULL when full under LOG_DROP.
+static LogSlot *claimSlot(Logger *log, size_t *posOut) {
+    size_t pos = atomic_load_explicit(&log->enqueuePos, memory_order_relaxed);
+
+    for (;;) {
+        LogSlot *slot = &log->slots[pos & log->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&log->enqueuePos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                *posOut = pos;
+                return slot;
+            }
+        } else if (diff < 0) {
+            if (log->policy == LOG_DROP) return NULL;
+            sched_yield(); // Ring full: wait for the flusher, not for the disk
+            pos = atomic_load_explicit(&log->enqueuePos, memory_order_relaxed);
+        } else {
+            pos = atomic_load_explicit(&log->enqueuePos, memory_order_relaxed);
+        }
+    }
+}
+
+// ctime() is only called when the second changes
+static const char *cachedTimestamp(void) {
+    static _Thread_local time_t cachedSecond = -1;
+    static _Thread_local char text[32];
+    time_t now = time(NULL);
+
+    if (now != cachedSecond) {
+        ctime_r(&now, text);
+        cachedSecond = now;
+    }
+    return text;
+}
+
+// Log Sensor Data: format into a ring slot, the flusher does the I/O
+int logSensorData(Logger *log, Vehicle *vehicle) {
+    size_t pos;
+    LogSlot *slot = claimSlot(log, &pos);
+    if (slot == NULL) {
+        atomic_fetch_add_explicit(&log->recordsDropped, 1, memory_order_relaxed);
+        return -1;
+    }
+
+    int len = snprintf(slot->data, LOG_RECORD_SIZE, "\n[%s] Vehicle ID: %s\n", cachedTimestamp(), vehicle->id);
+    for (int i = 0; i < vehicle->sensor_count && len < LOG_RECORD_SIZE; i++) {
+        len += snprintf(slot->data + len, LOG_RECORD_SIZE - len, "Sensor Type: %d, Value: %d %s\n",
+                        vehicle->sensors[i].type,
+                        vehicle->sensors[i].value,
+                        vehicle->sensors[i].is_faulty ? "[FAULTY]" : "");
+    }
+    slot->length = (uint16_t)(len < LOG_RECORD_SIZE ? len : LOG_RECORD_SIZE - 1);
+
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+    atomic_fetch_add_explicit(&log->recordsLogged, 1, memory_order_relaxed);
+    return 0;
+}
+
+// ---------------- Fleet ----------------
+
+// Function to Add a Vehicle
+void addVehicle(char *id, uint8_t status) {
+    if (fleet.count < MAX_VEHICLES) {
+        strcpy(fleet.vehicles[fleet.count].id, id);
+        fleet.vehicles[fleet.count].status = status;
+        fleet.vehicles[fleet.count].sensor_count = 0; // Initialize with 0 sensors
+        fleet.count++;
+    }
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+// Update Sensor Data in Real Time
+void updateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Process the Entire Fleet (never touches the disk)
+void processFleet() {
+    for (int i = 0; i < fleet.count; i++) {
+        printf("\nVehicle ID: %s\n", fleet.vehicles[i].id);
+        updateSensorData(&fleet.vehicles[i]);
+
+        for (int j = 0; j < fleet.vehicles[i].sensor_count; j++) {
+            printf("Sensor Type %d: %d %s\n", fleet.vehicles[i].sensors[j].type,
+                   fleet.vehicles[i].sensors[j].value,
+                   fleet.vehicles[i].sensors[j].is_faulty ? "[FAULTY]" : "");
+        }
+
+        logSensorData(&sensorLog, &fleet.vehicles[i]); // Queued for the flusher
+    }
+}
+
+// ---------------- Benchmark ----------------
+
+// The original per-vehicle fopen/ctime/fprintf/fclose path
+static void legacyLogSensorData(const char *path, Vehicle *vehicle) {
+    FILE *logFile = fopen(path, "a");
+    if (logFile == NULL) return;
+
+    time_t now;
+    time(&now);
+    fprintf(logFile, "\n[%s] Vehicle ID: %s\n", ctime(&now), vehicle->id);
+
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        fprintf(logFile, "Sensor Type: %d, Value: %d %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].is_faulty ? "[FAULTY]" : "");
+    }
+    fclose(logFile);
+}
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+void runLoggerBenchmark(int records) {
+    const char *legacyPath = "sensor_log_bench_legacy.txt";
+    const char *asyncPath = "sensor_log_bench_async.txt";
+    Vehicle v;
+    strcpy(v.id, "VH999");
+    assignRandomSensors(&v);
+
+    struct timespec t0, t1;
+    int legacyRecords = records / 20;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < legacyRecords; i++) {
+        legacyLogSensorData(legacyPath, &v);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("fopen/fclose per call : %8.1f ns/record (%d records)\n", elapsedNs(t0, t1) / legacyRecords, legacyRecords);
+    unlink(legacyPath);
+
+    LogFullPolicy policies[] = {LOG_DROP, LOG_BLOCK};
+    for (int p = 0; p < 2; p++) {
+        Logger log;
+        if (loggerOpen(&log, asyncPath, 8192, 16 * 1024 * 1024, 2, policies[p]) != 0) return;
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int i = 0; i < records; i++) {
+            logSensorData(&log, &v);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double producerNs = elapsedNs(t0, t1) / records;
+        loggerClose(&log);
+
+        printf("async ring (%-5s)    : %8.1f ns/record producer side | logged %lu, dropped %lu, %lu write() calls, %.1f MB, %lu rotations\n",
+               policies[p] == LOG_DROP ? "drop" : "block", producerNs,
+               atomic_load(&log.recordsLogged), atomic_load(&log.recordsDropped),
+               atomic_load(&log.writeCalls), atomic_load(&log.bytesWritten) / (1024.0 * 1024.0),
+               atomic_load(&log.rotations));
+
+        char rotated[300];
+        for (int i = 1; i <= 2; i++) {
+            snprintf(rotated, sizeof(rotated), "%s.%d", asyncPath, i);
+            unlink(rotated);
+        }
+        unlink(asyncPath);
+    }
+}
+
+int main() {
+    fleet.count = 0;
+    srand(time(0)); // Seed random values
+
+    // 1 MB log files, keep 3 rotated ones, drop records rather than stall the loop
+    if (loggerOpen(&sensorLog, "sensor_log.txt", 4096, 1024 * 1024, 3, LOG_DROP) != 0) {
+        return 1;
+    }
+
+    // Adding vehicles
+    addVehicle("VH123", 1);
+    assignRandomSensors(&fleet.vehicles[0]);
+    addVehicle("VH456", 1);
+    assignRandomSensors(&fleet.vehicles[1]);
+
+    // Real-Time Simulation
+    for (int tick = 0; tick < 3; tick++) {
+        processFleet();
+        sleep(1);
+    }
+    loggerClose(&sensorLog);
+    printf("\nLogged %lu records, dropped %lu\n", atomic_load(&sensorLog.recordsLogged), atomic_load(&sensorLog.recordsDropped));
+
+    printf("\n---- Logger Benchmark ----\n");
+    runLoggerBenchmark(1000000);
+
+    return 0;
+}
@@ -0,0 +1,610 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define MAX_VEHICLES 5
+#define MAX_SENSORS 5
+#define BLOCK_ROWS 4096                       // Samples per column block
+#define SEGMENT_MAGIC 0x53454753u             // "SEGS"
+#define SEGMENT_VERSION 1
+#define VEHICLE_ID_NONE UINT32_MAX
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management
+typedef struct {
+    Vehicle vehicles[MAX_VEHICLES];
+    uint8_t count;
+} FleetManager;
+
+/*
+ * Segment file layout (little-endian, append-only):
+ *   SegmentHeader
+ *   repeated: BlockHeader, then the columns of that block back to back:
+ *     int64_t  timestamp[rows]   (seconds)
+ *     uint32_t vehicle[rows]     (index into the vehicle-ID table)
+ *     uint16_t value[rows]
+ *     uint8_t  sensorType[rows]
+ *     uint8_t  faulty[rows]
+ *   Every column starts naturally aligned because blocks are a multiple of 8 bytes long.
+ *   Vehicle-ID table (char[10] per vehicle) lives in a side file "<segment>.ids", appended
+ *   before the first block that refers to the new IDs.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t blockRows;
+    uint32_t reserved;
+} SegmentHeader;
+
+// Per-block min/max lets a query skip a block without touching its columns
+typedef struct {
+    uint32_t rows;
+    uint32_t faultyCount;
+    int64_t minTime, maxTime;
+    uint32_t minVehicle, maxVehicle;
+    uint16_t minValue, maxValue;
+    uint8_t typeMask;                   // Bit per sensor type present
+    uint8_t pad[3];
+} BlockHeader;
+
+// In-memory column buffers for the block being filled
+typedef struct {
+    int fd;
+    int idsFd;                          // Side file, appended before each block that needs the new IDs
+    BlockHeader header;
+    int64_t timestamp[BLOCK_ROWS];
+    uint32_t vehicle[BLOCK_ROWS];
+    uint8_t sensorType[BLOCK_ROWS];
+    uint16_t value[BLOCK_ROWS];
+    uint8_t faulty[BLOCK_ROWS];
+    char (*vehicleIds)[10];             // Vehicle-ID table
+    uint32_t vehicleCount;
+    uint32_t vehicleCapacity;
+    uint32_t idsWritten;                // Entries of vehicleIds already in the side file
+    uint32_t *idHash;                   // Open-addressing index into vehicleIds
+    uint32_t idHashCapacity;
+    uint64_t samplesWritten;
+    uint64_t blocksWritten;
+} SegmentWriter;
+
+// Read side: the whole segment mapped, columns addressed in place
+typedef struct {
+    const uint8_t *base;
+    size_t size;
+    char (*vehicleIds)[10];
+    uint32_t vehicleCount;
+} SegmentReader;
+
+// Query: every field is optional (anyVehicle, negative sensor type = any). A vehicle of
+// VEHICLE_ID_NONE without anyVehicle is a failed lookup and matches nothing.
+typedef struct {
+    int anyVehicle;
+    uint32_t vehicle;
+    int sensorType;
+    int onlyFaulty;
+    int64_t fromTime, toTime;
+} HistoryQuery;
+
+typedef struct {
+    uint64_t matches;
+    uint32_t blocksScanned;
+    uint32_t blocksSkipped;
+} QueryResult;
+
+// Global Fleet Object
+FleetManager fleet;
+
+// Function Prototypes
+int segmentOpen(SegmentWriter *w, const char *path);
+uint32_t segmentVehicleId(SegmentWriter *w, const char *id);
+void segmentAppend(SegmentWriter *w, int64_t timestamp, uint32_t vehicle, SensorType type, uint16_t value, uint8_t faulty);
+void segmentFlushBlock(SegmentWriter *w);
+void segmentClose(SegmentWriter *w);
+int readerOpen(SegmentReader *r, const char *path);
+void readerClose(SegmentReader *r);
+uint32_t readerFindVehicle(SegmentReader *r, const char *id);
+QueryResult runQuery(SegmentReader *r, const HistoryQuery *q, int printLimit);
+void addVehicle(char *id, uint8_t status);
+void assignRandomSensors(Vehicle *vehicle);
+void updateSensorData(Vehicle *vehicle);
+void checkSensorFault(SensorData *sensor);
+void logSensorData(SegmentWriter *w, Vehicle *vehicle, int64_t now);
+void runHistoryBenchmark(int vehicles, int ticks);
+
+// ---------------- Writer ----------------
+
+static void writeAll(int fd, const void *data, size_t length) {
+    const uint8_t *p = data;
+    while (length > 0) {
+        ssize_t n = write(fd, p, length);
+        if (n <= 0) return;
+        p += n;
+        length -= (size_t)n;
+    }
+}
+
+static void resetBlock(SegmentWriter *w) {
+    memset(&w->header, 0, sizeof(w->header));
+    w->header.minTime = INT64_MAX;
+    w->header.maxTime = INT64_MIN;
+    w->header.minVehicle = UINT32_MAX;
+    w->header.minValue = UINT16_MAX;
+}
+
+int segmentOpen(SegmentWriter *w, const char *path) {
+    w->fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (w->fd < 0) {
+        printf("Error: Cannot open segment %s\n", path);
+        return -1;
+    }
+
+    // A new segment gets a header; an existing one must have been written with our layout
+    struct stat st;
+    SegmentHeader header = {SEGMENT_MAGIC, SEGMENT_VERSION, BLOCK_ROWS, 0};
+    if (fstat(w->fd, &st) == 0 && st.st_size == 0) {
+        writeAll(w->fd, &header, sizeof(header));
+    } else if (pread(w->fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) || header.magic != SEGMENT_MAGIC ||
+               header.version != SEGMENT_VERSION || header.blockRows != BLOCK_ROWS) {
+        printf("Error: %s is not a sensor history segment with %d-row blocks\n", path, BLOCK_ROWS);
+        close(w->fd);
+        return -1;
+    }
+
+    char idsPath[300];
+    snprintf(idsPath, sizeof(idsPath), "%s.ids", path);
+    w->vehicleIds = NULL;
+    w->vehicleCount = w->vehicleCapacity = 0;
+    w->idHash = NULL;
+    w->idHashCapacity = 0;
+    w->samplesWritten = w->blocksWritten = 0;
+
+    // Continue the existing vehicle-ID table when appending to a segment
+    FILE *ids = fopen(idsPath, "rb");
+    if (ids != NULL) {
+        char id[10];
+        while (fread(id, sizeof(id), 1, ids) == 1) {
+            segmentVehicleId(w, id);
+        }
+        fclose(ids);
+    }
+    w->idsWritten = w->vehicleCount;
+    w->idsFd = open(idsPath, O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (w->idsFd < 0) {
+        printf("Error: Cannot open vehicle-ID table %s\n", idsPath);
+        close(w->fd);
+        free(w->vehicleIds);
+        free(w->idHash);
+        return -1;
+    }
+    resetBlock(w);
+    return 0;
+}
+
+static uint32_t hashVehicleId(const char *id) {
+    uint32_t h = 2166136261U;
+    for (int i = 0; i < 10 && id[i]; i++) {
+        h ^= (unsigned char)id[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static void rebuildIdHash(SegmentWriter *w) {
+    free(w->idHash);
+    w->idHashCapacity = w->idHashCapacity ? w->idHashCapacity * 2 : 64;
+    w->idHash = malloc(sizeof(uint32_t) * w->idHashCapacity);
+    for (uint32_t i = 0; i < w->idHashCapacity; i++) {
+        w->idHash[i] = VEHICLE_ID_NONE;
+    }
+    for (uint32_t v = 0; v < w->vehicleCount; v++) {
+        uint32_t slot = hashVehicleId(w->vehicleIds[v]) & (w->idHashCapacity - 1);
+        while (w->idHash[slot] != VEHICLE_ID_NONE) slot = (slot + 1) & (w->idHashCapacity - 1);
+        w->idHash[slot] = v;
+    }
+}
+
+// Vehicle string -> small integer used in the vehicle column
+uint32_t segmentVehicleId(SegmentWriter *w, const char *id) {
+    if ((w->vehicleCount + 1) * 2 > w->idHashCapacity) {
+        rebuildIdHash(w);
+    }
+
+    uint32_t mask = w->idHashCapacity - 1;
+    uint32_t slot = hashVehicleId(id) & mask;
+    while (w->idHash[slot] != VEHICLE_ID_NONE) {
+        if (strncmp(w->vehicleIds[w->idHash[slot]], id, 10) == 0) return w->idHash[slot];
+        slot = (slot + 1) & mask;
+    }
+
+    if (w->vehicleCount == w->vehicleCapacity) {
+        w->vehicleCapacity = w->vehicleCapacity ? w->vehicleCapacity * 2 : 16;
+        w->vehicleIds = realloc(w->vehicleIds, 10 * w->vehicleCapacity);
+    }
+    memset(w->vehicleIds[w->vehicleCount], 0, 10);
+    strncpy(w->vehicleIds[w->vehicleCount], id, 9);
+    w->idHash[slot] = w->vehicleCount;
+    return w->vehicleCount++;
+}
+
+// Append one sample to the open block: five stores and a few min/max updates
+void segmentAppend(SegmentWriter *w, int64_t timestamp, uint32_t vehicle, SensorType type, uint16_t value, uint8_t faulty) {
+    BlockHeader *h = &w->header;
+    uint32_t row = h->rows;
+
+    w->timestamp[row] = timestamp;
+    w->vehicle[row] = vehicle;
+    w->sensorType[row] = (uint8_t)type;
+    w->value[row] = value;
+    w->faulty[row] = faulty;
+
+    if (timestamp < h->minTime) h->minTime = timestamp;
+    if (timestamp > h->maxTime) h->maxTime = timestamp;
+    if (vehicle < h->minVehicle) h->minVehicle = vehicle;
+    if (vehicle > h->maxVehicle) h->maxVehicle = vehicle;
+    if (value < h->minValue) h->minValue = value;
+    if (value > h->maxValue) h->maxValue = value;
+    h->typeMask |= (uint8_t)(1u << type);
+    h->faultyCount += faulty;
+
+    if (++h->rows == BLOCK_ROWS) {
+        segmentFlushBlock(w);
+    }
+}
+
+void segmentFlushBlock(SegmentWriter *w) {
+    uint32_t rows = w->header.rows;
+    if (rows == 0) return;
+
+    // IDs first: a crash after this leaves extra IDs, never a block naming unknown vehicles
+    if (w->idsWritten < w->vehicleCount) {
+        writeAll(w->idsFd, w->vehicleIds[w->idsWritten], 10 * (size_t)(w->vehicleCount - w->idsWritten));
+        w->idsWritten = w->vehicleCount;
+    }
+    writeAll(w->fd, &w->header, sizeof(w->header));
+    writeAll(w->fd, w->timestamp, sizeof(int64_t) * rows);
+    writeAll(w->fd, w->vehicle, sizeof(uint32_t) * rows);
+    writeAll(w->fd, w->value, sizeof(uint16_t) * rows);
+    writeAll(w->fd, w->sensorType, rows);
+    writeAll(w->fd, w->faulty, rows);
+
+    w->samplesWritten += rows;
+    w->blocksWritten++;
+    resetBlock(w);
+}
+
+void segmentClose(SegmentWriter *w) {
+    segmentFlushBlock(w);
+    close(w->fd);
+    close(w->idsFd);
+    free(w->vehicleIds);
+    free(w->idHash);
+    w->vehicleIds = NULL;
+    w->idHash = NULL;
+}
+
+// ---------------- Reader ----------------
+
+int readerOpen(SegmentReader *r, const char *path) {
+    memset(r, 0, sizeof(*r));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(SegmentHeader)) {
+        close(fd);
+        return -1;
+    }
+    r->size = (size_t)st.st_size;
+    r->base = mmap(NULL, r->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (r->base == MAP_FAILED) return -1;
+
+    const SegmentHeader *header = (const SegmentHeader *)r->base;
+    if (header->magic != SEGMENT_MAGIC || header->version != SEGMENT_VERSION || header->blockRows == 0) {
+        printf("Error: %s is not a sensor history segment\n", path);
+        munmap((void *)r->base, r->size);
+        return -1;
+    }
+
+    char idsPath[300];
+    snprintf(idsPath, sizeof(idsPath), "%s.ids", path);
+    FILE *ids = fopen(idsPath, "rb");
+    if (ids != NULL) {
+        fseek(ids, 0, SEEK_END);
+        r->vehicleCount = (uint32_t)(ftell(ids) / 10);
+        rewind(ids);
+        r->vehicleIds = malloc(10 * (r->vehicleCount ? r->vehicleCount : 1));
+        r->vehicleCount = (uint32_t)fread(r->vehicleIds, 10, r->vehicleCount, ids);
+        fclose(ids);
+    }
+    return 0;
+}
+
+void readerClose(SegmentReader *r) {
+    if (r->base) munmap((void *)r->base, r->size);
+    free(r->vehicleIds);
+    memset(r, 0, sizeof(*r));
+}
+
+uint32_t readerFindVehicle(SegmentReader *r, const char *id) {
+    for (uint32_t i = 0; i < r->vehicleCount; i++) {
+        if (strncmp(r->vehicleIds[i], id, 10) == 0) return i;
+    }
+    return VEHICLE_ID_NONE;
+}
+
+static int blockCanMatch(const BlockHeader *h, const HistoryQuery *q) {
+    if (h->maxTime < q->fromTime || h->minTime > q->toTime) return 0;
+    if (!q->anyVehicle && (q->vehicle < h->minVehicle || q->vehicle > h->maxVehicle)) return 0;
+    if (q->sensorType >= 0 && !(h->typeMask & (1u << q->sensorType))) return 0;
+    if (q->onlyFaulty && h->faultyCount == 0) return 0;
+    return 1;
+}
+
+// Walk block headers, skip blocks by min/max, scan the columns of the rest in place
+QueryResult runQuery(SegmentReader *r, const HistoryQuery *q, int printLimit) {
+    QueryResult result = {0, 0, 0};
+    size_t offset = sizeof(SegmentHeader);
+    uint32_t blockRows = ((const SegmentHeader *)r->base)->blockRows;
+    if (!q->anyVehicle && q->vehicle == VEHICLE_ID_NONE) return result;   // Vehicle not in this segment
+
+    while (offset + sizeof(BlockHeader) <= r->size) {
+        const BlockHeader *h = (const BlockHeader *)(r->base + offset);
+        size_t rows = h->rows;
+        size_t blockBytes = sizeof(BlockHeader) + rows * (sizeof(int64_t) + sizeof(uint32_t) + 1 + sizeof(uint16_t) + 1);
+        if (rows == 0 || rows > blockRows || offset + blockBytes > r->size) break; // Truncated or corrupt tail
+
+        if (!blockCanMatch(h, q)) {
+            result.blocksSkipped++;
+            offset += blockBytes;
+            continue;
+        }
+        result.blocksScanned++;
+
+        const uint8_t *col = r->base + offset + sizeof(BlockHeader);
+        const int64_t *timestamp = (const int64_t *)col;
+        const uint32_t *vehicle = (const uint32_t *)(col + rows * sizeof(int64_t));
+        const uint16_t *value = (const uint16_t *)(col + rows * (sizeof(int64_t) + sizeof(uint32_t)));
+        const uint8_t *sensorType = (const uint8_t *)(value + rows);
+        const uint8_t *faulty = sensorType + rows;
+
+        for (size_t i = 0; i < rows; i++) {
+            int match = (q->anyVehicle || vehicle[i] == q->vehicle)
+                      & (q->sensorType < 0 || sensorType[i] == q->sensorType)
+                      & (!q->onlyFaulty || faulty[i])
+                      & (timestamp[i] >= q->fromTime) & (timestamp[i] <= q->toTime);
+            if (match) {
+                if (result.matches < (uint64_t)printLimit) {
+                    time_t t = (time_t)timestamp[i];
+                    char when[32];
+                    strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", localtime(&t));
+                    printf("  %s Vehicle %s Sensor Type: %d, Value: %d %s\n", when,
+                           vehicle[i] < r->vehicleCount ? r->vehicleIds[vehicle[i]] : "?",
+                           sensorType[i], value[i], faulty[i] ? "[FAULTY]" : "");
+                }
+                result.matches++;
+            }
+        }
+        offset += blockBytes;
+    }
+    return result;
+}
+
+// ---------------- Fleet ----------------
+
+// Function to Add a Vehicle
+void addVehicle(char *id, uint8_t status) {
+    if (fleet.count < MAX_VEHICLES) {
+        strcpy(fleet.vehicles[fleet.count].id, id);
+        fleet.vehicles[fleet.count].status = status;
+        fleet.vehicles[fleet.count].sensor_count = 0; // Initialize with 0 sensors
+        fleet.count++;
+    }
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+// Update Sensor Data in Real Time
+void updateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Log Sensor Data as binary column rows instead of text lines
+void logSensorData(SegmentWriter *w, Vehicle *vehicle, int64_t now) {
+    uint32_t vehicleId = segmentVehicleId(w, vehicle->id);
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        segmentAppend(w, now, vehicleId, vehicle->sensors[i].type,
+                      vehicle->sensors[i].value, vehicle->sensors[i].is_faulty);
+    }
+}
+
+// ---------------- Benchmark ----------------
+
+static double elapsedNs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+}
+
+// Write a synthetic day of history both ways, then query it
+void runHistoryBenchmark(int vehicles, int ticks) {
+    const char *textPath = "sensor_history_bench.txt";
+    const char *segmentPath = "sensor_history_bench.seg";
+    char idsPath[300];
+    snprintf(idsPath, sizeof(idsPath), "%s.ids", segmentPath);
+    unlink(textPath);
+    unlink(segmentPath);
+    unlink(idsPath);
+
+    Vehicle *fleetBench = malloc(sizeof(Vehicle) * vehicles);
+    for (int i = 0; i < vehicles; i++) {
+        snprintf(fleetBench[i].id, sizeof(fleetBench[i].id), "VH%u", (100U + (unsigned)i) % 10000000U);
+        assignRandomSensors(&fleetBench[i]);
+    }
+    int64_t start = (int64_t)time(NULL) - (int64_t)ticks * 60;
+    uint64_t samples = 0;
+    struct timespec t0, t1;
+
+    // Text path (one open file, fprintf per sample, as logSensorData writes it)
+    FILE *text = fopen(textPath, "w");
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        time_t now = (time_t)(start + tick * 60);
+        for (int i = 0; i < vehicles; i++) {
+            updateSensorData(&fleetBench[i]);
+            fprintf(text, "\n[%s] Vehicle ID: %s\n", ctime(&now), fleetBench[i].id);
+            for (int j = 0; j < fleetBench[i].sensor_count; j++) {
+                fprintf(text, "Sensor Type: %d, Value: %d %s\n", fleetBench[i].sensors[j].type,
+                        fleetBench[i].sensors[j].value, fleetBench[i].sensors[j].is_faulty ? "[FAULTY]" : "");
+            }
+            samples += fleetBench[i].sensor_count;
+        }
+    }
+    fclose(text);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double textNs = elapsedNs(t0, t1) / samples;
+
+    // Binary column segment; both loops update the sensors before logging them
+    static SegmentWriter writer;
+    segmentOpen(&writer, segmentPath);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < vehicles; i++) {
+            updateSensorData(&fleetBench[i]);
+            logSensorData(&writer, &fleetBench[i], start + tick * 60);
+        }
+    }
+    segmentClose(&writer);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double binaryNs = elapsedNs(t0, t1) / writer.samplesWritten;
+
+    struct stat textStat, segStat;
+    stat(textPath, &textStat);
+    stat(segmentPath, &segStat);
+    printf("text fprintf  : %6.1f ns/sample, %6.1f bytes/sample\n", textNs, (double)textStat.st_size / samples);
+    printf("binary column : %6.1f ns/sample, %6.1f bytes/sample (%lu blocks)\n", binaryNs,
+           (double)segStat.st_size / writer.samplesWritten, (unsigned long)writer.blocksWritten);
+
+    // "All FAULTY brake-pressure readings for VH456 in the last hour"
+    SegmentReader reader;
+    if (readerOpen(&reader, segmentPath) == 0) {
+        HistoryQuery q = {0, readerFindVehicle(&reader, "VH456"), BRAKE_PRESSURE_SENSOR, 1,
+                          start + (int64_t)ticks * 60 - 3600, INT64_MAX};
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        QueryResult result = runQuery(&reader, &q, 0);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        printf("query VH456 faulty brake pressure, last hour: %lu matches, %u blocks scanned, %u skipped, %.2f ms\n",
+               (unsigned long)result.matches, result.blocksScanned, result.blocksSkipped, elapsedNs(t0, t1) / 1e6);
+        readerClose(&reader);
+    }
+
+    free(fleetBench);
+    unlink(textPath);
+    unlink(segmentPath);
+    unlink(idsPath);
+}
+
+int main() {
+    fleet.count = 0;
+    srand(time(0)); // Seed random values
+
+    static SegmentWriter history;
+    if (segmentOpen(&history, "sensor_history.seg") != 0) {
+        return 1;
+    }
+
+    // Adding vehicles
+    addVehicle("VH123", 1);
+    assignRandomSensors(&fleet.vehicles[0]);
+    addVehicle("VH456", 1);
+    assignRandomSensors(&fleet.vehicles[1]);
+
+    // Simulated ticks, one minute apart
+    int64_t now = (int64_t)time(NULL) - 10 * 60;
+    for (int tick = 0; tick < 10; tick++, now += 60) {
+        for (int i = 0; i < fleet.count; i++) {
+            updateSensorData(&fleet.vehicles[i]);
+            logSensorData(&history, &fleet.vehicles[i], now);
+        }
+    }
+    segmentClose(&history);
+
+    // Read it back through mmap
+    SegmentReader reader;
+    if (readerOpen(&reader, "sensor_history.seg") == 0) {
+        HistoryQuery q = {0, readerFindVehicle(&reader, "VH456"), -1, 0, (int64_t)time(NULL) - 3600, INT64_MAX};
+        printf("History for VH456 (last hour):\n");
+        QueryResult result = runQuery(&reader, &q, 20);
+        printf("%lu samples\n", (unsigned long)result.matches);
+        q.vehicle = readerFindVehicle(&reader, "VH999");
+        printf("History for VH999 (not in the segment): %lu samples\n", (unsigned long)runQuery(&reader, &q, 0).matches);
+        readerClose(&reader);
+    }
+
+    printf("\n---- History Benchmark (100k vehicles x 60 ticks) ----\n");
+    runHistoryBenchmark(100000, 60);
+
+    return 0;
+}
@@ -0,0 +1,510 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/uio.h>
+
+// Build: gcc -O2 -pthread "24 Parallel Fleet Tick with Work Stealing.c"
+
+#define MAX_SENSORS 5
+#define CHUNK_VEHICLES 256      // Unit of work handed to (and stolen between) workers
+#define MAX_WORKERS 64
+#define IOV_BATCH 512           // writev() entries per call
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int capacity;
+} FleetManager;
+
+// Growable text buffer owned by one worker
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+} OutputBuffer;
+
+// Where a chunk's output landed, so it can be emitted in chunk order
+typedef struct {
+    int worker;
+    size_t consoleOffset, consoleLength;
+    size_t logOffset, logLength;
+} ChunkOutput;
+
+// Per-worker queue: a contiguous range of chunks claimed with fetch_add by owner and thieves alike
+typedef struct {
+    _Alignas(64) atomic_int next;
+    int end;
+} ChunkQueue;
+
+typedef struct TickEngine TickEngine;
+
+typedef struct {
+    TickEngine *engine;
+    int index;
+    pthread_t thread;
+    OutputBuffer console;
+    OutputBuffer log;
+    long chunksRun;
+    long chunksStolen;
+} Worker;
+
+// Fixed worker pool that runs one fleet tick at a time
+struct TickEngine {
+    FleetManager *fleet;
+    int workerCount;
+    Worker workers[MAX_WORKERS];
+    ChunkQueue queues[MAX_WORKERS];
+    ChunkOutput *chunks;
+    int chunkCapacity;
+    int chunkCount;
+    uint64_t seed;
+    uint64_t tick;
+    time_t pinnedTime;              // Nonzero: stamp every tick with this instead of the clock
+    char tickStamp[32];             // ctime() of the current tick, shared by all workers
+    int stopping;
+    pthread_mutex_t launchLock;     // Held by engineStart until the barriers match the started threads
+    pthread_barrier_t startBarrier;
+    pthread_barrier_t endBarrier;
+};
+
+// Function Prototypes
+void fleetInit(FleetManager *fleet, int capacity);
+void addVehicle(FleetManager *fleet, const char *id, uint8_t status);
+void assignRandomSensors(Vehicle *vehicle, uint64_t *rng);
+void updateSensorData(Vehicle *vehicle, uint64_t *rng, Worker *worker);
+void checkSensorFault(SensorData *sensor);
+void processVehicle(Vehicle *vehicle, uint64_t *rng, Worker *worker);
+int engineStart(TickEngine *engine, FleetManager *fleet, int workers, uint64_t seed);
+void engineStop(TickEngine *engine);
+void processFleet(TickEngine *engine);
+int emitTickOutput(TickEngine *engine, int consoleFd, int logFd);
+uint64_t tickOutputChecksum(TickEngine *engine);
+void runScalingBenchmark(int numVehicles, int ticks, int maxWorkers);
+
+// ---------------- Helpers ----------------
+
+// splitmix64: one independent stream per (seed, tick, chunk) keeps runs reproducible
+static inline uint64_t nextRandom(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void appendf(OutputBuffer *out, const char *fmt, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, fmt);
+        size_t room = out->capacity - out->length;
+        int n = vsnprintf(out->data + out->length, room, fmt, args);
+        va_end(args);
+        if (n < 0) return;
+        if ((size_t)n < room) {
+            out->length += (size_t)n;
+            return;
+        }
+        size_t newCapacity = out->capacity ? out->capacity * 2 : 64 * 1024;
+        while (newCapacity - out->length <= (size_t)n) newCapacity *= 2;
+        char *grown = realloc(out->data, newCapacity);
+        if (grown == NULL) return;
+        out->data = grown;
+        out->capacity = newCapacity;
+    }
+}
+
+// ---------------- Fleet ----------------
+
+void fleetInit(FleetManager *fleet, int capacity) {
+    fleet->vehicles = malloc(sizeof(Vehicle) * capacity);
+    fleet->count = 0;
+    fleet->capacity = fleet->vehicles ? capacity : 0;
+}
+
+// Function to Add a Vehicle
+void addVehicle(FleetManager *fleet, const char *id, uint8_t status) {
+    if (fleet->count < fleet->capacity) {
+        Vehicle *v = &fleet->vehicles[fleet->count];
+        snprintf(v->id, sizeof(v->id), "%s", id);
+        v->status = status;
+        v->sensor_count = 0; // Initialize with 0 sensors
+        fleet->count++;
+    }
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle, uint64_t *rng) {
+    int num_sensors = (nextRandom(rng) % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(nextRandom(rng) % MAX_SENSORS);
+        vehicle->sensors[i].value = (nextRandom(rng) % 50) + 10; // 10-59
+        vehicle->sensors[i].is_faulty = 0;
+    }
+}
+
+// Update Sensor Data in Real Time and Randomly Add More Sensors
+void updateSensorData(Vehicle *vehicle, uint64_t *rng, Worker *worker) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (int)(nextRandom(rng) % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]);
+    }
+
+    if (vehicle->sensor_count < MAX_SENSORS && nextRandom(rng) % 10 < 3) { // 30% chance
+        int new_index = vehicle->sensor_count;
+        vehicle->sensors[new_index].type = (SensorType)(nextRandom(rng) % MAX_SENSORS);
+        vehicle->sensors[new_index].value = (nextRandom(rng) % 50) + 10;
+        vehicle->sensors[new_index].is_faulty = 0;
+        vehicle->sensor_count++;
+        appendf(&worker->console, "🚗 Vehicle %s added new sensor type %d!\n", vehicle->id, vehicle->sensors[new_index].type);
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+static const char *sensorFormats[] = {
+    "Temperature: %d°C %s\n",
+    "Speed: %d km/h %s\n",
+    "Fuel Level: %d%% %s\n",
+    "Brake Pressure: %d bar %s\n",
+    "Battery Voltage: %dV %s\n"
+};
+
+// Same output as the single-threaded processFleet, written to the worker's buffers
+void processVehicle(Vehicle *vehicle, uint64_t *rng, Worker *worker) {
+    appendf(&worker->console, "\nVehicle ID: %s\n", vehicle->id);
+    updateSensorData(vehicle, rng, worker);
+
+    for (int j = 0; j < vehicle->sensor_count; j++) {
+        SensorData *s = &vehicle->sensors[j];
+        appendf(&worker->console, sensorFormats[s->type], s->value, s->is_faulty ? "[FAULTY]" : "");
+        appendf(&worker->console, "Sending Sensor Type %d with Value %d to CAN Bus...\n", s->type, s->value);
+    }
+
+    appendf(&worker->log, "\n[%s] Vehicle ID: %s\n", worker->engine->tickStamp, vehicle->id);
+    for (int j = 0; j < vehicle->sensor_count; j++) {
+        appendf(&worker->log, "Sensor Type: %d, Value: %d %s\n", vehicle->sensors[j].type,
+                vehicle->sensors[j].value, vehicle->sensors[j].is_faulty ? "[FAULTY]" : "");
+    }
+}
+
+// ---------------- Tick engine ----------------
+
+static void runChunk(Worker *worker, int chunk) {
+    TickEngine *engine = worker->engine;
+    FleetManager *fleet = engine->fleet;
+    ChunkOutput *out = &engine->chunks[chunk];
+    uint64_t rng = engine->seed ^ (engine->tick * 0xD1B54A32D192ED03ULL) ^ ((uint64_t)chunk << 32);
+
+    out->worker = worker->index;
+    out->consoleOffset = worker->console.length;
+    out->logOffset = worker->log.length;
+
+    int first = chunk * CHUNK_VEHICLES;
+    int last = first + CHUNK_VEHICLES < fleet->count ? first + CHUNK_VEHICLES : fleet->count;
+    for (int i = first; i < last; i++) {
+        processVehicle(&fleet->vehicles[i], &rng, worker);
+    }
+
+    out->consoleLength = worker->console.length - out->consoleOffset;
+    out->logLength = worker->log.length - out->logOffset;
+    worker->chunksRun++;
+}
+
+// Own queue first, then steal from the others round-robin
+static void runTick(Worker *worker) {
+    TickEngine *engine = worker->engine;
+    worker->console.length = 0;
+    worker->log.length = 0;
+
+    for (int k = 0; k < engine->workerCount; k++) {
+        int victim = (worker->index + k) % engine->workerCount;
+        ChunkQueue *queue = &engine->queues[victim];
+        for (;;) {
+            int chunk = atomic_fetch_add_explicit(&queue->next, 1, memory_order_relaxed);
+            if (chunk >= queue->end) break;
+            runChunk(worker, chunk);
+            if (victim != worker->index) worker->chunksStolen++;
+        }
+    }
+}
+
+static void *workerThread(void *arg) {
+    Worker *worker = arg;
+    TickEngine *engine = worker->engine;
+
+    pthread_mutex_lock(&engine->launchLock);
+    pthread_mutex_unlock(&engine->launchLock);
+    for (;;) {
+        pthread_barrier_wait(&engine->startBarrier);
+        if (engine->stopping) break;
+        runTick(worker);
+        pthread_barrier_wait(&engine->endBarrier);
+    }
+    return NULL;
+}
+
+int engineStart(TickEngine *engine, FleetManager *fleet, int workers, uint64_t seed) {
+    memset(engine, 0, sizeof(*engine));
+    engine->fleet = fleet;
+    engine->workerCount = workers < 1 ? 1 : workers > MAX_WORKERS ? MAX_WORKERS : workers;
+    engine->seed = seed;
+
+    // Worker 0 is the calling thread, the rest are pool threads. They wait on launchLock
+    // so the barriers can be sized to however many actually started.
+    int requested = engine->workerCount;
+    pthread_mutex_init(&engine->launchLock, NULL);
+    pthread_mutex_lock(&engine->launchLock);
+    for (int w = 0; w < requested; w++) {
+        engine->workers[w].engine = engine;
+        engine->workers[w].index = w;
+        if (w > 0 && pthread_create(&engine->workers[w].thread, NULL, workerThread, &engine->workers[w]) != 0) {
+            printf("Error: Cannot start worker %d, running with %d\n", w, w);
+            engine->workerCount = w;
+            break;
+        }
+    }
+    pthread_barrier_init(&engine->startBarrier, NULL, engine->workerCount);
+    pthread_barrier_init(&engine->endBarrier, NULL, engine->workerCount);
+    pthread_mutex_unlock(&engine->launchLock);
+    return engine->workerCount == requested ? 0 : -1;
+}
+
+void engineStop(TickEngine *engine) {
+    engine->stopping = 1;
+    pthread_barrier_wait(&engine->startBarrier);
+    for (int w = 1; w < engine->workerCount; w++) {
+        pthread_join(engine->workers[w].thread, NULL);
+    }
+    for (int w = 0; w < engine->workerCount; w++) {
+        free(engine->workers[w].console.data);
+        free(engine->workers[w].log.data);
+    }
+    pthread_barrier_destroy(&engine->startBarrier);
+    pthread_barrier_destroy(&engine->endBarrier);
+    pthread_mutex_destroy(&engine->launchLock);
+    free(engine->chunks);
+}
+
+// Process the Entire Fleet: split into chunks, one contiguous range per worker
+void processFleet(TickEngine *engine) {
+    int chunkCount = (engine->fleet->count + CHUNK_VEHICLES - 1) / CHUNK_VEHICLES;
+    if (chunkCount > engine->chunkCapacity) {
+        engine->chunks = realloc(engine->chunks, sizeof(ChunkOutput) * chunkCount);
+        engine->chunkCapacity = chunkCount;
+    }
+    engine->chunkCount = chunkCount;
+
+    // Same record header as logSensorData (11), formatted once per tick
+    time_t now = engine->pinnedTime ? engine->pinnedTime : time(NULL);
+    ctime_r(&now, engine->tickStamp);
+
+    for (int w = 0; w < engine->workerCount; w++) {
+        int begin = (int)((long)chunkCount * w / engine->workerCount);
+        atomic_store(&engine->queues[w].next, begin);
+        engine->queues[w].end = (int)((long)chunkCount * (w + 1) / engine->workerCount);
+    }
+
+    pthread_barrier_wait(&engine->startBarrier);
+    runTick(&engine->workers[0]);
+    pthread_barrier_wait(&engine->endBarrier);
+    engine->tick++;
+}
+
+// Write both streams in chunk order with writev
+int emitTickOutput(TickEngine *engine, int consoleFd, int logFd) {
+    struct iovec iov[IOV_BATCH];
+
+    for (int stream = 0; stream < 2; stream++) {
+        int fd = stream == 0 ? consoleFd : logFd;
+        int used = 0;
+        if (fd < 0) continue;
+        for (int c = 0; c < engine->chunkCount; c++) {
+            ChunkOutput *out = &engine->chunks[c];
+            Worker *w = &engine->workers[out->worker];
+            size_t length = stream == 0 ? out->consoleLength : out->logLength;
+            if (length == 0) continue;
+            iov[used].iov_base = stream == 0 ? w->console.data + out->consoleOffset : w->log.data + out->logOffset;
+            iov[used].iov_len = length;
+            if (++used == IOV_BATCH) {
+                if (writev(fd, iov, used) < 0) return -1;
+                used = 0;
+            }
+        }
+        if (used > 0 && writev(fd, iov, used) < 0) return -1;
+    }
+    return 0;
+}
+
+// FNV-1a over both streams in emit order; only the benchmark's determinism check needs it
+uint64_t tickOutputChecksum(TickEngine *engine) {
+    uint64_t checksum = 1469598103934665603ULL;
+    for (int stream = 0; stream < 2; stream++) {
+        for (int c = 0; c < engine->chunkCount; c++) {
+            ChunkOutput *out = &engine->chunks[c];
+            Worker *w = &engine->workers[out->worker];
+            const char *base = stream == 0 ? w->console.data + out->consoleOffset : w->log.data + out->logOffset;
+            size_t length = stream == 0 ? out->consoleLength : out->logLength;
+            for (size_t i = 0; i < length; i++) {
+                checksum = (checksum ^ (unsigned char)base[i]) * 1099511628211ULL;
+            }
+        }
+    }
+    return checksum;
+}
+
+// ---------------- Benchmark ----------------
+
+static double elapsedMs(struct timespec start, struct timespec end) {
+    return (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+static void buildFleet(FleetManager *fleet, int numVehicles, uint64_t seed) {
+    uint64_t rng = seed;
+    char id[10];
+    fleetInit(fleet, numVehicles);
+    for (int i = 0; i < numVehicles; i++) {
+        snprintf(id, sizeof(id), "VH%u", (unsigned)i % 10000000U);
+        addVehicle(fleet, id, 1);
+        assignRandomSensors(&fleet->vehicles[i], &rng);
+    }
+}
+
+// Same synthetic fleet at 1, 2, 4 ... cores; output must be identical at every width
+void runScalingBenchmark(int numVehicles, int ticks, int maxWorkers) {
+    int devNull = open("/dev/null", O_WRONLY);
+    double baseMs = 0;
+
+    for (int workers = 1; ; workers *= 2) {
+        if (workers > maxWorkers) workers = maxWorkers;
+
+        FleetManager fleet;
+        TickEngine *engine = malloc(sizeof(TickEngine));
+        buildFleet(&fleet, numVehicles, 42);
+        engineStart(engine, &fleet, workers, 42);
+        engine->pinnedTime = 1700000000;   // Wall clock would break the cross-width output check
+
+        uint64_t checksum = 0;
+        long stolen = 0;
+        double processMs = 0, emitMs = 0;
+        struct timespec t0, t1, t2;
+        for (int tick = 0; tick < ticks; tick++) {
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            processFleet(engine);
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            emitTickOutput(engine, devNull, devNull);
+            clock_gettime(CLOCK_MONOTONIC, &t2);
+            processMs += elapsedMs(t0, t1);
+            emitMs += elapsedMs(t1, t2);
+            // Serial and byte-at-a-time, so kept out of both timed regions
+            checksum ^= tickOutputChecksum(engine) + tick;
+        }
+        for (int w = 0; w < engine->workerCount; w++) stolen += engine->workers[w].chunksStolen;
+
+        processMs /= ticks;
+        emitMs /= ticks;
+        if (workers == 1) baseMs = processMs;
+        printf("%3d workers | process %8.1f ms/tick | %6.2fx | %9.0f vehicles/s | emit %6.2f ms/tick | chunks stolen %ld | output %016llx\n",
+               engine->workerCount, processMs, baseMs / processMs, numVehicles / (processMs / 1e3), emitMs, stolen,
+               (unsigned long long)checksum);
+
+        engineStop(engine);
+        free(engine);
+        free(fleet.vehicles);
+        if (workers >= maxWorkers) break;
+    }
+    close(devNull);
+}
+
+int main(int argc, char *argv[]) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int benchVehicles = argc > 1 ? atoi(argv[1]) : 1000000;
+    int maxWorkers = argc > 2 ? atoi(argv[2]) : (int)cores;
+
+    // Small demo fleet, output identical to the single-threaded loop's shape
+    FleetManager fleet;
+    TickEngine *engine = malloc(sizeof(TickEngine));
+    uint64_t seed = (uint64_t)time(0);
+    uint64_t rng = seed;
+
+    fleetInit(&fleet, 5);
+    addVehicle(&fleet, "VH123", 1);
+    assignRandomSensors(&fleet.vehicles[0], &rng);
+    addVehicle(&fleet, "VH456", 1);
+    assignRandomSensors(&fleet.vehicles[1], &rng);
+
+    int logFd = open("sensor_log.txt", O_WRONLY | O_CREAT | O_APPEND, 0644);
+    if (engineStart(engine, &fleet, (int)cores, seed) != 0) {
+        printf("Error: Tick engine could not start %ld workers\n", cores);
+        engineStop(engine);
+        free(engine);
+        free(fleet.vehicles);
+        if (logFd >= 0) close(logFd);
+        return 1;
+    }
+    for (int tick = 0; tick < 3; tick++) {
+        processFleet(engine);
+        emitTickOutput(engine, STDOUT_FILENO, logFd);
+    }
+    engineStop(engine);
+    free(engine);
+    free(fleet.vehicles);
+    if (logFd >= 0) close(logFd);
+
+    printf("\n---- Tick Scaling (%d vehicles, %ld cores) ----\n", benchVehicles, cores);
+    runScalingBenchmark(benchVehicles, 5, maxWorkers > 0 ? maxWorkers : 1);
+
+    return 0;
+}
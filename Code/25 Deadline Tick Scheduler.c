@@ -0,0 +1,312 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <errno.h>
+#include <math.h>
+
+// Build: gcc -O2 "25 Deadline Tick Scheduler.c" -lm
+
+#define MAX_VEHICLES 5
+#define MAX_SENSORS 5
+#define MAX_TASKS 8
+#define NSEC_PER_SEC 1000000000LL
+#define JITTER_BUCKETS 64       // Log2 buckets of lateness in ns
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management
+typedef struct {
+    Vehicle vehicles[MAX_VEHICLES];
+    uint8_t count;
+} FleetManager;
+
+// What to do when a task finishes after its next deadline has already passed
+typedef enum {
+    OVERRUN_CATCH_UP,   // Run the missed ticks back to back until on schedule again
+    OVERRUN_SKIP        // Drop the missed ticks and realign to the next future deadline
+} OverrunPolicy;
+
+// Tick timing statistics for one task
+typedef struct {
+    uint64_t ticks;
+    uint64_t overruns;          // Ticks that finished after the following deadline
+    uint64_t skipped;           // Deadlines dropped under OVERRUN_SKIP
+    int64_t maxLatenessNs;      // Worst start time past the deadline
+    double meanLatenessNs;      // Welford running mean/variance of lateness
+    double m2LatenessNs;
+    int64_t maxRunNs;
+    uint64_t latenessBuckets[JITTER_BUCKETS];
+} TickStats;
+
+typedef void (*TaskFunction)(void *context);
+
+// A periodic task driven by absolute deadlines
+typedef struct {
+    const char *name;
+    TaskFunction run;
+    void *context;
+    int64_t periodNs;
+    int64_t nextDeadlineNs;
+    OverrunPolicy policy;
+    TickStats stats;
+} PeriodicTask;
+
+typedef struct {
+    PeriodicTask tasks[MAX_TASKS];
+    int taskCount;
+} TickScheduler;
+
+// Global Fleet Object
+FleetManager fleet;
+
+// Function Prototypes
+int64_t monotonicNowNs(void);
+void schedulerInit(TickScheduler *s);
+int schedulerAddTask(TickScheduler *s, const char *name, TaskFunction run, void *context, int64_t periodNs, OverrunPolicy policy);
+void schedulerRunFor(TickScheduler *s, int64_t durationNs);
+void printTickStats(const PeriodicTask *task);
+void addVehicle(char *id, uint8_t status);
+void assignRandomSensors(Vehicle *vehicle);
+void updateSensorData(Vehicle *vehicle);
+void checkSensorFault(SensorData *sensor);
+void processFleet(void *context);
+
+// ---------------- Scheduler ----------------
+
+int64_t monotonicNowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+}
+
+// Sleep until an absolute CLOCK_MONOTONIC time, so work time never shifts the period
+static void sleepUntil(int64_t deadlineNs) {
+    struct timespec ts = {deadlineNs / NSEC_PER_SEC, deadlineNs % NSEC_PER_SEC};
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+    }
+}
+
+void schedulerInit(TickScheduler *s) {
+    memset(s, 0, sizeof(*s));
+}
+
+// Periods down to 1 ms are supported
+int schedulerAddTask(TickScheduler *s, const char *name, TaskFunction run, void *context, int64_t periodNs, OverrunPolicy policy) {
+    if (s->taskCount == MAX_TASKS || periodNs < NSEC_PER_SEC / 1000) {
+        printf("Error: Cannot schedule task %s\n", name);
+        return -1;
+    }
+    PeriodicTask *t = &s->tasks[s->taskCount++];
+    memset(t, 0, sizeof(*t));
+    t->name = name;
+    t->run = run;
+    t->context = context;
+    t->periodNs = periodNs;
+    t->policy = policy;
+    t->nextDeadlineNs = monotonicNowNs() + periodNs;
+    return 0;
+}
+
+static void recordTick(TickStats *st, int64_t latenessNs, int64_t runNs) {
+    st->ticks++;
+    double delta = latenessNs - st->meanLatenessNs;
+    st->meanLatenessNs += delta / st->ticks;
+    st->m2LatenessNs += delta * (latenessNs - st->meanLatenessNs);
+    if (latenessNs > st->maxLatenessNs) st->maxLatenessNs = latenessNs;
+    if (runNs > st->maxRunNs) st->maxRunNs = runNs;
+
+    int bucket = latenessNs > 0 ? 63 - __builtin_clzll((uint64_t)latenessNs) : 0;
+    st->latenessBuckets[bucket]++;
+}
+
+// Run the earliest-deadline task each time; returns after durationNs
+void schedulerRunFor(TickScheduler *s, int64_t durationNs) {
+    int64_t endNs = monotonicNowNs() + durationNs;
+
+    for (;;) {
+        PeriodicTask *next = NULL;
+        for (int i = 0; i < s->taskCount; i++) {
+            if (next == NULL || s->tasks[i].nextDeadlineNs < next->nextDeadlineNs) {
+                next = &s->tasks[i];
+            }
+        }
+        if (next == NULL || next->nextDeadlineNs > endNs) break;
+
+        sleepUntil(next->nextDeadlineNs);
+        int64_t startNs = monotonicNowNs();
+        next->run(next->context);
+        int64_t finishNs = monotonicNowNs();
+        recordTick(&next->stats, startNs - next->nextDeadlineNs, finishNs - startNs);
+
+        // Advance by whole periods from the deadline, never from "now"
+        next->nextDeadlineNs += next->periodNs;
+        if (finishNs > next->nextDeadlineNs) {
+            next->stats.overruns++;
+            if (next->policy == OVERRUN_SKIP) {
+                int64_t missed = (finishNs - next->nextDeadlineNs) / next->periodNs + 1;
+                next->nextDeadlineNs += missed * next->periodNs;
+                next->stats.skipped += (uint64_t)missed;
+            }
+        }
+    }
+}
+
+// Percentile from the log2 histogram (upper bound of the bucket)
+static int64_t latencyPercentile(const TickStats *st, double p) {
+    uint64_t target = (uint64_t)ceil(st->ticks * p), seen = 0;
+    for (int b = 0; b < JITTER_BUCKETS; b++) {
+        seen += st->latenessBuckets[b];
+        if (seen >= target && seen > 0) return (int64_t)1 << (b + 1);
+    }
+    return 0;
+}
+
+void printTickStats(const PeriodicTask *task) {
+    const TickStats *st = &task->stats;
+    double stddev = st->ticks > 1 ? sqrt(st->m2LatenessNs / (st->ticks - 1)) : 0;
+    printf("%-12s %6.1f Hz | ticks %6lu | overruns %4lu | skipped %4lu | jitter mean %7.1f us, sd %7.1f us, p99 < %7.1f us, max %7.1f us | max run %7.1f us\n",
+           task->name, (double)NSEC_PER_SEC / task->periodNs,
+           (unsigned long)st->ticks, (unsigned long)st->overruns, (unsigned long)st->skipped,
+           st->meanLatenessNs / 1e3, stddev / 1e3, latencyPercentile(st, 0.99) / 1e3,
+           st->maxLatenessNs / 1e3, st->maxRunNs / 1e3);
+}
+
+// ---------------- Fleet ----------------
+
+// Function to Add a Vehicle
+void addVehicle(char *id, uint8_t status) {
+    if (fleet.count < MAX_VEHICLES) {
+        strcpy(fleet.vehicles[fleet.count].id, id);
+        fleet.vehicles[fleet.count].status = status;
+        fleet.vehicles[fleet.count].sensor_count = 0; // Initialize with 0 sensors
+        fleet.count++;
+    }
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+// Update Sensor Data in Real Time
+void updateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Process the Entire Fleet (quiet: printing every 10 ms would dominate the tick)
+void processFleet(void *context) {
+    long *faults = context;
+    for (int i = 0; i < fleet.count; i++) {
+        updateSensorData(&fleet.vehicles[i]);
+        for (int j = 0; j < fleet.vehicles[i].sensor_count; j++) {
+            *faults += fleet.vehicles[i].sensors[j].is_faulty;
+        }
+    }
+}
+
+// Print a one-line fleet summary at a slower rate
+static void reportFleet(void *context) {
+    long *faults = context;
+    printf("[report] %d vehicles, %ld faulty sensor readings so far\n", fleet.count, *faults);
+}
+
+// Burn CPU for a while to simulate a heavy tick (every 25th call overruns 10 ms)
+static void heavyTask(void *context) {
+    long *calls = context;
+    int64_t busyNs = (++*calls % 25 == 0) ? 25000000 : 2000000;
+    int64_t until = monotonicNowNs() + busyNs;
+    while (monotonicNowNs() < until) {
+    }
+}
+
+int main() {
+    fleet.count = 0;
+    srand(time(0)); // Seed random values
+
+    // Adding vehicles
+    addVehicle("VH123", 1);
+    assignRandomSensors(&fleet.vehicles[0]);
+    addVehicle("VH456", 1);
+    assignRandomSensors(&fleet.vehicles[1]);
+
+    // Real-Time Simulation: 100 Hz sampling, 10 Hz load task, 1 Hz report
+    long faults = 0, heavyCalls = 0;
+    TickScheduler scheduler;
+    schedulerInit(&scheduler);
+    schedulerAddTask(&scheduler, "processFleet", processFleet, &faults, NSEC_PER_SEC / 100, OVERRUN_CATCH_UP);
+    schedulerAddTask(&scheduler, "heavyTask", heavyTask, &heavyCalls, NSEC_PER_SEC / 10, OVERRUN_SKIP);
+    schedulerAddTask(&scheduler, "report", reportFleet, &faults, NSEC_PER_SEC, OVERRUN_SKIP);
+
+    schedulerRunFor(&scheduler, 5 * NSEC_PER_SEC);
+
+    printf("\n---- Tick Jitter ----\n");
+    for (int i = 0; i < scheduler.taskCount; i++) {
+        printTickStats(&scheduler.tasks[i]);
+    }
+
+    // 1 kHz task on its own to show the scheduler holds millisecond periods
+    long unused = 0;
+    TickScheduler fast;
+    schedulerInit(&fast);
+    schedulerAddTask(&fast, "processFleet", processFleet, &unused, NSEC_PER_SEC / 1000, OVERRUN_CATCH_UP);
+    schedulerRunFor(&fast, 2 * NSEC_PER_SEC);
+    printTickStats(&fast.tasks[0]);
+
+    return 0;
+}
@@ -0,0 +1,693 @@
+#define _GNU_SOURCE   // sendmmsg
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <linux/futex.h>
+
+// Build: gcc -O2 -pthread "26 Batched CAN Encoder with SPSC Queue.c"
+// Usage: ./a.out [shm|file|vcan] [file path or interface name]
+
+#define MAX_VEHICLES 5
+#define MAX_SENSORS 5
+#define CAN_BASE_ID 0x100          // Extended 29-bit id = CAN_BASE_ID + vehicle index
+#define SAMPLES_PER_FRAME 3        // 3 x 20-bit samples + 4-bit header = 64 bits
+#define TX_RING_FRAMES 4096        // Must be a power of two
+#define TX_BURST 64                // Frames handed to the sink per call
+#define TX_IDLE_SPINS 64           // Empty polls (each a sched_yield) before the transmitter parks
+#define SHM_RING_FRAMES 8192       // Must be a power of two
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fleet Management
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+} FleetManager;
+
+// Where the transmitter thread puts frames; one of shm ring, file or SocketCAN
+typedef struct CanSink CanSink;
+struct CanSink {
+    const char *name;
+    int (*send)(CanSink *sink, const struct can_frame *frames, int count);
+    void (*close)(CanSink *sink);
+    int fd;
+    void *state;
+};
+
+// Shared-memory bus stand-in: the newest SHM_RING_FRAMES frames, readable by another process
+typedef struct {
+    _Atomic uint64_t head;     // Total frames ever written; slot = head % SHM_RING_FRAMES
+    uint32_t capacity;
+    uint32_t frameSize;
+    struct can_frame frames[SHM_RING_FRAMES];
+} ShmCanRing;
+
+// Lock-free single-producer/single-consumer ring; head and tail on their own cache lines
+typedef struct {
+    _Alignas(64) _Atomic size_t head;    // Written by the producer only
+    size_t cachedTail;                   // Producer's last view of tail
+    _Alignas(64) _Atomic size_t tail;    // Written by the transmitter only
+    size_t highWater;                    // Deepest queue the transmitter has seen
+    _Alignas(64) struct can_frame frames[TX_RING_FRAMES];
+} CanTxRing;
+
+// Transmit path: ring + transmitter thread + sink
+typedef struct {
+    CanTxRing ring;
+    CanSink *sink;
+    pthread_t thread;
+    atomic_int running;
+    _Alignas(64) atomic_int sleeping;    // Transmitter parked on this futex word
+    atomic_ulong framesSent;
+    atomic_ulong sinkCalls;
+    atomic_ulong sinkErrors;
+    unsigned long framesDropped;         // Producer side, ring full
+} CanTransmitter;
+
+// Global Fleet Object
+FleetManager fleet;
+
+// Function Prototypes
+void addVehicle(Vehicle *vehicle, int index, uint8_t status);
+void assignRandomSensors(Vehicle *vehicle);
+void updateSensorData(Vehicle *vehicle);
+void checkSensorFault(SensorData *sensor);
+int encodeVehicleFrames(const Vehicle *vehicle, int vehicleIndex, struct can_frame *out);
+int decodeFrame(const struct can_frame *frame, int *vehicleIndex, SensorData *out);
+int transmitterStart(CanTransmitter *tx, CanSink *sink);
+void transmitterStop(CanTransmitter *tx);
+int pushFrames(CanTransmitter *tx, const struct can_frame *frames, int count);
+int sendToCANBus(CanTransmitter *tx, const struct can_frame *frames, int count);
+CanSink *openShmSink(const char *name);
+CanSink *openFileSink(const char *path);
+CanSink *openSocketCanSink(const char *interface);
+void processFleet(CanTransmitter *tx);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ---------------- Frame Encoding ----------------
+
+// Payload layout (little-endian 64-bit word):
+//   bits 0-1  : number of samples in this frame (1..3)
+//   bits 2-3  : frame index within the vehicle's tick (0..1)
+//   bits 4+20k: sample k = value (16) | type (3) | faulty (1)
+static inline uint64_t packSample(const SensorData *s) {
+    return (uint64_t)s->value | ((uint64_t)(s->type & 7) << 16) | ((uint64_t)(s->is_faulty & 1) << 19);
+}
+
+// Packs all sensors of one vehicle; returns the number of frames written to out
+int encodeVehicleFrames(const Vehicle *vehicle, int vehicleIndex, struct can_frame *out) {
+    int frames = 0;
+    for (int first = 0; first < vehicle->sensor_count; first += SAMPLES_PER_FRAME) {
+        int n = vehicle->sensor_count - first;
+        if (n > SAMPLES_PER_FRAME) n = SAMPLES_PER_FRAME;
+
+        uint64_t word = (uint64_t)n | ((uint64_t)frames << 2);
+        for (int k = 0; k < n; k++) {
+            word |= packSample(&vehicle->sensors[first + k]) << (4 + 20 * k);
+        }
+
+        struct can_frame *f = &out[frames++];
+        memset(f, 0, sizeof(*f));
+        // An 11-bit standard id runs out after 1791 vehicles, so every frame is extended
+        f->can_id = ((canid_t)(CAN_BASE_ID + vehicleIndex) & CAN_EFF_MASK) | CAN_EFF_FLAG;
+        f->can_dlc = (uint8_t)((4 + 20 * n + 7) / 8); // Only send the bytes that carry data
+        for (int b = 0; b < 8; b++) f->data[b] = (uint8_t)(word >> (8 * b));
+    }
+    return frames;
+}
+
+// Inverse of encodeVehicleFrames for one frame; returns the number of samples
+int decodeFrame(const struct can_frame *frame, int *vehicleIndex, SensorData *out) {
+    uint64_t word = 0;
+    for (int b = 0; b < frame->can_dlc; b++) word |= (uint64_t)frame->data[b] << (8 * b);
+
+    canid_t id = frame->can_id & CAN_EFF_FLAG ? frame->can_id & CAN_EFF_MASK : frame->can_id & CAN_SFF_MASK;
+    *vehicleIndex = (int)id - CAN_BASE_ID;
+    int n = word & 3;
+    for (int k = 0; k < n; k++) {
+        uint64_t s = word >> (4 + 20 * k);
+        out[k].value = (uint16_t)s;
+        out[k].type = (SensorType)((s >> 16) & 7);
+        out[k].is_faulty = (s >> 19) & 1;
+    }
+    return n;
+}
+
+// ---------------- Sinks ----------------
+
+static int shmSend(CanSink *sink, const struct can_frame *frames, int count) {
+    ShmCanRing *ring = sink->state;
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    for (int i = 0; i < count; i++) {
+        ring->frames[(head + i) & (SHM_RING_FRAMES - 1)] = frames[i];
+    }
+    atomic_store_explicit(&ring->head, head + count, memory_order_release);
+    return count;
+}
+
+static void shmClose(CanSink *sink) {
+    munmap(sink->state, sizeof(ShmCanRing));
+    shm_unlink(sink->name);
+    free(sink);
+}
+
+CanSink *openShmSink(const char *name) {
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, sizeof(ShmCanRing)) != 0) {
+        printf("Error: Cannot create shared memory %s\n", name);
+        if (fd >= 0) close(fd);
+        return NULL;
+    }
+    void *map = mmap(NULL, sizeof(ShmCanRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        printf("Error: Cannot map shared memory %s\n", name);
+        shm_unlink(name);
+        return NULL;
+    }
+
+    ShmCanRing *ring = map;
+    atomic_init(&ring->head, 0);
+    ring->capacity = SHM_RING_FRAMES;
+    ring->frameSize = sizeof(struct can_frame);
+
+    CanSink *sink = calloc(1, sizeof(CanSink));
+    if (sink == NULL) {
+        printf("Error: Out of memory for CAN sink\n");
+        munmap(map, sizeof(ShmCanRing));
+        shm_unlink(name);
+        return NULL;
+    }
+    sink->name = name;
+    sink->send = shmSend;
+    sink->close = shmClose;
+    sink->fd = -1;
+    sink->state = ring;
+    return sink;
+}
+
+// Raw struct can_frame records, one write() per burst
+static int fileSend(CanSink *sink, const struct can_frame *frames, int count) {
+    size_t bytes = (size_t)count * sizeof(struct can_frame);
+    const char *p = (const char *)frames;
+    while (bytes > 0) {
+        ssize_t n = write(sink->fd, p, bytes);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        bytes -= (size_t)n;
+    }
+    return count;
+}
+
+static void fdClose(CanSink *sink) {
+    close(sink->fd);
+    free(sink);
+}
+
+CanSink *openFileSink(const char *path) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        printf("Error: Cannot open %s\n", path);
+        return NULL;
+    }
+    CanSink *sink = calloc(1, sizeof(CanSink));
+    if (sink == NULL) {
+        printf("Error: Out of memory for CAN sink\n");
+        close(fd);
+        return NULL;
+    }
+    sink->name = path;
+    sink->send = fileSend;
+    sink->close = fdClose;
+    sink->fd = fd;
+    return sink;
+}
+
+// SocketCAN: sendmmsg pushes the whole burst in one system call
+static int socketCanSend(CanSink *sink, const struct can_frame *frames, int count) {
+    struct mmsghdr msgs[TX_BURST];
+    struct iovec iov[TX_BURST];
+    memset(msgs, 0, sizeof(struct mmsghdr) * count);
+    for (int i = 0; i < count; i++) {
+        iov[i].iov_base = (void *)&frames[i];
+        iov[i].iov_len = sizeof(struct can_frame);
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    int sent = 0;
+    while (sent < count) {
+        int n = sendmmsg(sink->fd, msgs + sent, count - sent, 0);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return sent > 0 ? sent : -1;
+        }
+        sent += n;
+    }
+    return sent;
+}
+
+CanSink *openSocketCanSink(const char *interface) {
+    int fd = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+    if (fd < 0) {
+        printf("Error: SocketCAN is not available\n");
+        return NULL;
+    }
+    struct ifreq ifr;
+    memset(&ifr, 0, sizeof(ifr));
+    snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", interface);
+    struct sockaddr_can addr;
+    memset(&addr, 0, sizeof(addr));
+    if (ioctl(fd, SIOCGIFINDEX, &ifr) < 0) {
+        printf("Error: No CAN interface %s (try: ip link add dev %s type vcan && ip link set up %s)\n",
+               interface, interface, interface);
+        close(fd);
+        return NULL;
+    }
+    addr.can_family = AF_CAN;
+    addr.can_ifindex = ifr.ifr_ifindex;
+    if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        printf("Error: Cannot bind to %s\n", interface);
+        close(fd);
+        return NULL;
+    }
+    CanSink *sink = calloc(1, sizeof(CanSink));
+    if (sink == NULL) {
+        printf("Error: Out of memory for CAN sink\n");
+        close(fd);
+        return NULL;
+    }
+    sink->name = interface;
+    sink->send = socketCanSend;
+    sink->close = fdClose;
+    sink->fd = fd;
+    return sink;
+}
+
+// ---------------- Transmit Queue ----------------
+
+static void futexWait(atomic_int *word, int expected) {
+    syscall(SYS_futex, (int *)word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+}
+
+static void futexWake(atomic_int *word) {
+    syscall(SYS_futex, (int *)word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+// Producer side: push frames and publish them with a single store. Returns how many
+// fit; the caller decides whether the rest are retried or dropped.
+int pushFrames(CanTransmitter *tx, const struct can_frame *frames, int count) {
+    CanTxRing *r = &tx->ring;
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+
+    if (head + count - r->cachedTail > TX_RING_FRAMES) {
+        r->cachedTail = atomic_load_explicit(&r->tail, memory_order_acquire);
+    }
+    size_t space = TX_RING_FRAMES - (head - r->cachedTail);
+    int n = count < (int)space ? count : (int)space;
+
+    for (int i = 0; i < n; i++) {
+        r->frames[(head + i) & (TX_RING_FRAMES - 1)] = frames[i];
+    }
+    atomic_store_explicit(&r->head, head + n, memory_order_release);
+
+    // Pairs with the fence in transmitterThread: either it sees these frames or we see it asleep
+    if (n > 0) {
+        atomic_thread_fence(memory_order_seq_cst);
+        if (atomic_load_explicit(&tx->sleeping, memory_order_relaxed) && atomic_exchange(&tx->sleeping, 0)) {
+            futexWake(&tx->sleeping);
+        }
+    }
+    return n;
+}
+
+// Push a tick's frames; what does not fit is counted as dropped so the
+// processing loop never waits on the bus.
+int sendToCANBus(CanTransmitter *tx, const struct can_frame *frames, int count) {
+    int n = pushFrames(tx, frames, count);
+    tx->framesDropped += (unsigned long)(count - n);
+    return n;
+}
+
+// Drains the ring in bursts of up to TX_BURST contiguous frames. When idle it yields
+// for a while, then parks on the sleeping futex until a push or transmitterStop wakes it.
+static void *transmitterThread(void *arg) {
+    CanTransmitter *tx = arg;
+    CanTxRing *r = &tx->ring;
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    int idle = 0;
+
+    for (;;) {
+        size_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+        if (head == tail) {
+            if (!atomic_load(&tx->running)) break;
+            if (++idle < TX_IDLE_SPINS) {
+                sched_yield();
+                continue;
+            }
+            atomic_store_explicit(&tx->sleeping, 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_seq_cst);
+            if (atomic_load_explicit(&r->head, memory_order_acquire) == tail && atomic_load(&tx->running)) {
+                futexWait(&tx->sleeping, 1);
+            }
+            atomic_store_explicit(&tx->sleeping, 0, memory_order_relaxed);
+            idle = 0;
+            continue;
+        }
+        idle = 0;
+
+        // head - tail is the true depth here; the producer's cached tail can be stale
+        size_t slot = tail & (TX_RING_FRAMES - 1);
+        size_t n = head - tail;
+        if (n > r->highWater) r->highWater = n;
+        if (n > TX_BURST) n = TX_BURST;
+        if (n > TX_RING_FRAMES - slot) n = TX_RING_FRAMES - slot; // Stop at the wrap
+
+        int sent = tx->sink->send(tx->sink, &r->frames[slot], (int)n);
+        atomic_fetch_add_explicit(&tx->sinkCalls, 1, memory_order_relaxed);
+        if (sent < 0) {
+            atomic_fetch_add_explicit(&tx->sinkErrors, 1, memory_order_relaxed);
+        } else {
+            atomic_fetch_add_explicit(&tx->framesSent, (unsigned long)sent, memory_order_relaxed);
+        }
+
+        tail += n;
+        atomic_store_explicit(&r->tail, tail, memory_order_release);
+    }
+    return NULL;
+}
+
+int transmitterStart(CanTransmitter *tx, CanSink *sink) {
+    memset(tx, 0, sizeof(*tx));
+    tx->sink = sink;
+    atomic_store(&tx->running, 1);
+    if (pthread_create(&tx->thread, NULL, transmitterThread, tx) != 0) {
+        printf("Error: Cannot start CAN transmitter thread\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Stops after every queued frame has reached the sink
+void transmitterStop(CanTransmitter *tx) {
+    atomic_store(&tx->running, 0);
+    atomic_store(&tx->sleeping, 0);
+    futexWake(&tx->sleeping);
+    pthread_join(tx->thread, NULL);
+}
+
+// ---------------- Fleet ----------------
+
+void addVehicle(Vehicle *vehicle, int index, uint8_t status) {
+    snprintf(vehicle->id, sizeof(vehicle->id), "VH%u", (unsigned)index % 10000000U);
+    vehicle->status = status;
+    vehicle->sensor_count = 0; // Initialize with 0 sensors
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+// Update Sensor Data in Real Time
+void updateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Process the Entire Fleet: frames are encoded per vehicle and queued, never printed
+void processFleet(CanTransmitter *tx) {
+    struct can_frame frames[(MAX_SENSORS + SAMPLES_PER_FRAME - 1) / SAMPLES_PER_FRAME];
+    for (int i = 0; i < fleet.count; i++) {
+        updateSensorData(&fleet.vehicles[i]);
+        int n = encodeVehicleFrames(&fleet.vehicles[i], i, frames);
+        sendToCANBus(tx, frames, n);
+    }
+}
+
+// Old path from 11: one printf per sensor inside the loop
+static void legacySendToCANBus(FILE *out, SensorData *sensor) {
+    fprintf(out, "Sending Sensor Type %d with Value %d to CAN Bus...\n", sensor->type, sensor->value);
+}
+
+static void printTransmitterStats(const char *label, CanTransmitter *tx, double ms) {
+    unsigned long sent = atomic_load(&tx->framesSent);
+    printf("%-22s %9lu frames in %8.2f ms = %10.0f frames/s | sink calls %6lu (%.1f frames/call) | queue high-water %4zu/%d | dropped %lu | errors %lu\n",
+           label, sent, ms, sent / (ms / 1e3), atomic_load(&tx->sinkCalls),
+           atomic_load(&tx->sinkCalls) ? (double)sent / atomic_load(&tx->sinkCalls) : 0.0,
+           tx->ring.highWater, TX_RING_FRAMES, tx->framesDropped, atomic_load(&tx->sinkErrors));
+}
+
+// Round-trip the shm ring: the newest frames a consumer can read must decode to the fleet's final state
+static void verifyShmRing(CanSink *sink) {
+    ShmCanRing *ring = sink->state;
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    struct can_frame *expected = malloc(sizeof(struct can_frame) * 2 * fleet.count);
+    int *owner = malloc(sizeof(int) * 2 * fleet.count);
+    int total = 0;
+    for (int i = 0; i < fleet.count; i++) {
+        int n = encodeVehicleFrames(&fleet.vehicles[i], i, expected + total);
+        for (int f = 0; f < n; f++) owner[total + f] = i;
+        total += n;
+    }
+
+    int check = total < SHM_RING_FRAMES ? total : SHM_RING_FRAMES;
+    int mismatches = 0;
+    for (int k = 0; k < check; k++) {
+        const struct can_frame *got = &ring->frames[(head - check + k) & (SHM_RING_FRAMES - 1)];
+        const struct can_frame *want = &expected[total - check + k];
+        SensorData a[SAMPLES_PER_FRAME], b[SAMPLES_PER_FRAME];
+        int va, vb;
+        int na = decodeFrame(got, &va, a), nb = decodeFrame(want, &vb, b);
+        // Compared with the vehicle that produced the frame, not just with a re-encode
+        if (na != nb || va != owner[total - check + k]) {
+            mismatches++;
+            continue;
+        }
+        for (int j = 0; j < na; j++) {
+            if (a[j].value != b[j].value || a[j].type != b[j].type || a[j].is_faulty != b[j].is_faulty) mismatches++;
+        }
+    }
+    printf("Shared-memory ring: %lu frames written, last %d decoded against fleet state, %d mismatches\n",
+           (unsigned long)head, check, mismatches);
+    free(expected);
+    free(owner);
+}
+
+// Every vehicle index in the fleet must survive the trip through can_id
+static int verifyVehicleIds(void) {
+    int wrong = 0;
+    struct can_frame frames[2];
+    for (int i = 0; i < fleet.count; i++) {
+        int n = encodeVehicleFrames(&fleet.vehicles[i], i, frames);
+        for (int f = 0; f < n; f++) {
+            SensorData samples[SAMPLES_PER_FRAME];
+            int index;
+            decodeFrame(&frames[f], &index, samples);
+            if (index != i) wrong++;
+        }
+    }
+    printf("Vehicle ids: %d vehicles encoded and decoded, %d wrong\n", fleet.count, wrong);
+    return wrong;
+}
+
+static CanSink *openSinkFromArgs(int argc, char *argv[]) {
+    const char *kind = argc > 1 ? argv[1] : "shm";
+    if (strcmp(kind, "file") == 0) return openFileSink(argc > 2 ? argv[2] : "can_frames.bin");
+    if (strcmp(kind, "vcan") == 0) return openSocketCanSink(argc > 2 ? argv[2] : "vcan0");
+    return openShmSink("/fleet_can_ring");
+}
+
+int main(int argc, char *argv[]) {
+    srand(time(0)); // Seed random values
+
+    // Demo: 2 vehicles, a few ticks, decode what went on the bus
+    fleet.vehicles = calloc(MAX_VEHICLES, sizeof(Vehicle));
+    if (fleet.vehicles == NULL) {
+        printf("Error: Out of memory for the fleet\n");
+        return 1;
+    }
+    fleet.count = 2;
+    for (int i = 0; i < fleet.count; i++) {
+        addVehicle(&fleet.vehicles[i], 123 + i * 333, 1);
+        assignRandomSensors(&fleet.vehicles[i]);
+    }
+
+    CanSink *sink = openSinkFromArgs(argc, argv);
+    if (sink == NULL) {
+        free(fleet.vehicles);
+        return 1;
+    }
+
+    CanTransmitter *tx = aligned_alloc(64, sizeof(CanTransmitter));
+    if (tx == NULL || transmitterStart(tx, sink) != 0) {
+        if (tx == NULL) printf("Error: Out of memory for the CAN transmitter\n");
+        sink->close(sink);
+        free(tx);
+        free(fleet.vehicles);
+        return 1;
+    }
+    for (int tick = 0; tick < 3; tick++) {
+        processFleet(tx);
+    }
+    transmitterStop(tx);
+
+    for (int i = 0; i < fleet.count; i++) {
+        struct can_frame frames[2];
+        int n = encodeVehicleFrames(&fleet.vehicles[i], i, frames);
+        printf("Vehicle %s: %d sensors -> %d frame(s):", fleet.vehicles[i].id, fleet.vehicles[i].sensor_count, n);
+        for (int f = 0; f < n; f++) {
+            printf(" %08X#", frames[f].can_id & CAN_EFF_MASK);
+            for (int b = 0; b < frames[f].can_dlc; b++) printf("%02X", frames[f].data[b]);
+        }
+        printf("\n");
+    }
+    printf("Sent %lu frames to %s, queue high-water %zu\n", atomic_load(&tx->framesSent), sink->name, tx->ring.highWater);
+    if (sink->send == shmSend) verifyShmRing(sink);
+    free(fleet.vehicles);
+
+    // Benchmark: large fleet, back-to-back ticks, transmitter running concurrently
+    int vehicles = 100000, ticks = 20;
+    fleet.vehicles = calloc(vehicles, sizeof(Vehicle));
+    if (fleet.vehicles == NULL) {
+        printf("Error: Out of memory for %d vehicles\n", vehicles);
+        sink->close(sink);
+        free(tx);
+        return 1;
+    }
+    fleet.count = vehicles;
+    long sensors = 0;
+    for (int i = 0; i < vehicles; i++) {
+        addVehicle(&fleet.vehicles[i], i, 1);
+        assignRandomSensors(&fleet.vehicles[i]);
+        sensors += fleet.vehicles[i].sensor_count;
+    }
+    printf("\n---- Transmit Benchmark: %d vehicles, %ld sensors, %d ticks ----\n", vehicles, sensors, ticks);
+    verifyVehicleIds();
+
+    // Legacy printf-per-sensor path to /dev/null
+    FILE *devNull = fopen("/dev/null", "w");
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < fleet.count; i++) {
+            updateSensorData(&fleet.vehicles[i]);
+            for (int j = 0; j < fleet.vehicles[i].sensor_count; j++) {
+                legacySendToCANBus(devNull, &fleet.vehicles[i].sensors[j]);
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    fclose(devNull);
+    double legacyMs = elapsedMs(t0, t1);
+    printf("%-22s %9ld msgs   in %8.2f ms = %10.0f msgs/s\n", "printf per sensor", sensors * ticks, legacyMs,
+           sensors * ticks / (legacyMs / 1e3));
+
+    // Batched encoder; the producer retries frames that did not fit, so every sample is
+    // sent and the dropped counter stays a real loss count. Retries are back-pressure.
+    long producerWaits = 0;
+    if (transmitterStart(tx, sink) != 0) {
+        sink->close(sink);
+        free(tx);
+        free(fleet.vehicles);
+        return 1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        struct can_frame frames[2];
+        for (int i = 0; i < fleet.count; i++) {
+            updateSensorData(&fleet.vehicles[i]);
+            int n = encodeVehicleFrames(&fleet.vehicles[i], i, frames);
+            int queued = 0;
+            while ((queued += pushFrames(tx, frames + queued, n - queued)) < n) {
+                producerWaits++;
+                sched_yield();
+            }
+        }
+    }
+    transmitterStop(tx);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printTransmitterStats(sink->name, tx, elapsedMs(t0, t1));
+    printf("Producer waited on a full queue %ld times\n", producerWaits);
+    printf("Samples per frame: %.2f\n", (double)sensors * ticks / atomic_load(&tx->framesSent));
+
+    if (sink->send == shmSend) verifyShmRing(sink);
+    sink->close(sink);
+    free(tx);
+    free(fleet.vehicles);
+    return 0;
+}
@@ -0,0 +1,561 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_SIMD 1
+#endif
+
+// Build: gcc -O2 -pthread "27 Deterministic Fleet Load Generator.c"
+// Usage: ./a.out [profile] [seed] [vehicles] [threads] [ticks]
+
+#define MAX_SENSORS 5
+#define SENSOR_TYPE_COUNT 5
+#define MAX_THREADS 64
+#define CHUNK_VEHICLES 4096   // Unit of work and of random stream ownership
+#define RNG_LANES 4           // 4 x 64-bit xoshiro256** lanes = 16 drift values per step
+#define DRIFT_BLOCK 16
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Fault rule per type: faulty when value > threshold (faultAbove) or value < threshold
+typedef struct {
+    uint16_t threshold;
+    uint8_t faultAbove;
+} FaultRule;
+
+static const FaultRule faultRules[SENSOR_TYPE_COUNT] = {
+    {90, 1},   // TEMPERATURE_SENSOR: > 90
+    {180, 1},  // SPEED_SENSOR: > 180
+    {10, 0},   // FUEL_SENSOR: < 10
+    {20, 0},   // BRAKE_PRESSURE_SENSOR: < 20
+    {11, 0}    // BATTERY_VOLTAGE_SENSOR: < 11
+};
+
+// ---------------- Profiles ----------------
+
+typedef enum {
+    DIST_UNIFORM,   // a..b inclusive
+    DIST_NORMAL     // mean a, b = 3 standard deviations
+} DistKind;
+
+typedef struct {
+    DistKind kind;
+    uint16_t a, b;
+} ValueDist;
+
+// Everything that shapes a synthetic fleet; same profile + seed = same fleet
+typedef struct {
+    const char *name;
+    int vehicleCount;
+    uint8_t minSensors, maxSensors;
+    uint16_t typeWeight[SENSOR_TYPE_COUNT];  // Sensor mix, relative weights
+    uint16_t faultPerMille;                  // Sensors created already in their fault range
+    uint8_t driftMax;                        // Per-tick drift is -driftMax..+driftMax
+    ValueDist values[SENSOR_TYPE_COUNT];
+} FleetProfile;
+
+static const FleetProfile fleetProfiles[] = {
+    // Same numbers as assignRandomSensors/updateSensorData in 10-11
+    {"legacy", 1000, 1, 5, {1, 1, 1, 1, 1}, 0, 2,
+     {{DIST_UNIFORM, 10, 59}, {DIST_UNIFORM, 10, 59}, {DIST_UNIFORM, 10, 59}, {DIST_UNIFORM, 10, 59}, {DIST_UNIFORM, 10, 59}}},
+    {"city", 100000, 3, 5, {4, 4, 3, 2, 3}, 5, 2,
+     {{DIST_NORMAL, 70, 15}, {DIST_NORMAL, 40, 40}, {DIST_UNIFORM, 5, 100}, {DIST_NORMAL, 60, 30}, {DIST_NORMAL, 13, 2}}},
+    {"long-haul", 250000, 5, 5, {2, 3, 3, 4, 1}, 2, 3,
+     {{DIST_NORMAL, 80, 12}, {DIST_NORMAL, 90, 30}, {DIST_UNIFORM, 10, 100}, {DIST_NORMAL, 80, 40}, {DIST_NORMAL, 24, 3}}},
+    {"stress", 1000000, 1, 5, {1, 1, 1, 1, 1}, 50, 4,
+     {{DIST_UNIFORM, 0, 200}, {DIST_UNIFORM, 0, 250}, {DIST_UNIFORM, 0, 100}, {DIST_UNIFORM, 0, 120}, {DIST_UNIFORM, 0, 30}}},
+};
+#define PROFILE_COUNT ((int)(sizeof(fleetProfiles) / sizeof(fleetProfiles[0])))
+
+// ---------------- Generators ----------------
+
+// Single xoshiro256** stream, used while building the fleet
+typedef struct {
+    uint64_t s[4];
+} Xoshiro;
+
+// Four interleaved xoshiro256** streams, laid out for one 256-bit register per state word
+typedef struct {
+    uint64_t s[4][RNG_LANES];
+} LaneRng;
+
+// Per-chunk state: which vehicles it owns and the drift stream that belongs to it.
+// Streams follow chunks, not threads, so the thread count never changes the output.
+typedef struct {
+    int firstVehicle;
+    int vehicleCount;
+    int sensorCount;
+    LaneRng drift;
+} FleetChunk;
+
+typedef struct {
+    const FleetProfile *profile;
+    uint64_t seed;
+    Vehicle *vehicles;
+    int count;
+    long sensorCount;
+    FleetChunk *chunks;
+    int chunkCount;
+} SyntheticFleet;
+
+// Drift kernel: fill out[count] (count a multiple of DRIFT_BLOCK) with -driftMax..+driftMax
+typedef void (*DriftKernel)(LaneRng *rng, int8_t *out, int count, int driftMax);
+
+DriftKernel driftKernel;
+const char *driftKernelName;
+
+// Function Prototypes
+const FleetProfile *findProfile(const char *name);
+int generateFleet(SyntheticFleet *fleet, const FleetProfile *profile, int vehicleCount, uint64_t seed, int threads);
+void freeFleet(SyntheticFleet *fleet);
+void runTicks(SyntheticFleet *fleet, int ticks, int threads);
+uint64_t fleetChecksum(const SyntheticFleet *fleet);
+void selectDriftKernel(void);
+void generateDriftScalar(LaneRng *rng, int8_t *out, int count, int driftMax);
+void updateSensorData(Vehicle *vehicle, const int8_t *drift);
+void checkSensorFault(SensorData *sensor);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+static inline uint64_t splitmix64(uint64_t *x) {
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static inline uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Seeds are derived from (run seed, chunk, purpose) so any chunk can be rebuilt on its own
+static void xoshiroSeed(Xoshiro *rng, uint64_t seed, uint64_t chunk, uint64_t purpose) {
+    uint64_t x = seed ^ (chunk * 0xD1B54A32D192ED03ULL) ^ (purpose << 56);
+    for (int i = 0; i < 4; i++) rng->s[i] = splitmix64(&x);
+}
+
+static inline uint64_t xoshiroNext(Xoshiro *rng) {
+    uint64_t *s = rng->s;
+    uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+    return result;
+}
+
+// 0..n-1 by multiply-high (no division, no rejection loop)
+static inline uint32_t uniformBelow(Xoshiro *rng, uint32_t n) {
+    return (uint32_t)(((xoshiroNext(rng) >> 32) * n) >> 32);
+}
+
+static void laneRngSeed(LaneRng *rng, uint64_t seed, uint64_t chunk) {
+    for (int l = 0; l < RNG_LANES; l++) {
+        Xoshiro one;
+        xoshiroSeed(&one, seed, chunk, 1 + l);
+        for (int w = 0; w < 4; w++) rng->s[w][l] = one.s[w];
+    }
+}
+
+// Integer-only draws keep replays bit-identical across compilers and libm versions
+static uint16_t drawValue(Xoshiro *rng, const ValueDist *dist) {
+    int64_t v;
+    if (dist->kind == DIST_UNIFORM) {
+        v = dist->a + uniformBelow(rng, (uint32_t)(dist->b - dist->a) + 1);
+    } else {
+        // Irwin-Hall: sum of four 16-bit uniforms, sd = 65536 * sqrt(4/12) ~= 37837
+        uint64_t r = xoshiroNext(rng);
+        int64_t sum = (int64_t)(r & 0xFFFF) + ((r >> 16) & 0xFFFF) + ((r >> 32) & 0xFFFF) + (r >> 48);
+        v = dist->a + (sum - 131070) * dist->b / (3 * 37837);
+    }
+    return (uint16_t)(v < 0 ? 0 : v > UINT16_MAX ? UINT16_MAX : v);
+}
+
+// A value inside the fault range of this sensor type
+static uint16_t drawFaultyValue(Xoshiro *rng, SensorType type) {
+    const FaultRule *rule = &faultRules[type];
+    return rule->faultAbove ? (uint16_t)(rule->threshold + 1 + uniformBelow(rng, 20))
+                            : (uint16_t)uniformBelow(rng, rule->threshold);
+}
+
+// ---------------- Drift Kernels ----------------
+
+// Each 64-bit output gives four 16-bit uniforms; (u * span) >> 16 maps them to 0..span-1
+void generateDriftScalar(LaneRng *rng, int8_t *out, int count, int driftMax) {
+    uint32_t span = 2 * driftMax + 1;
+    uint64_t (*s)[RNG_LANES] = rng->s;
+
+    for (int base = 0; base < count; base += DRIFT_BLOCK) {
+        for (int l = 0; l < RNG_LANES; l++) {
+            uint64_t r = rotl64(s[1][l] * 5, 7) * 9;
+            uint64_t t = s[1][l] << 17;
+            s[2][l] ^= s[0][l];
+            s[3][l] ^= s[1][l];
+            s[1][l] ^= s[2][l];
+            s[0][l] ^= s[3][l];
+            s[2][l] ^= t;
+            s[3][l] = rotl64(s[3][l], 45);
+
+            for (int k = 0; k < 4; k++) {
+                uint32_t u = (uint16_t)(r >> (16 * k));
+                out[base + 4 * l + k] = (int8_t)((int)((u * span) >> 16) - driftMax);
+            }
+        }
+    }
+}
+
+#ifdef HAVE_X86_SIMD
+__attribute__((target("avx2")))
+static inline __m256i rotl64x4(__m256i x, int k) {
+    return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+}
+
+// Same streams as the scalar kernel; x*5 and x*9 become shift-adds (AVX2 has no 64-bit multiply)
+__attribute__((target("avx2")))
+static void generateDriftAVX2(LaneRng *rng, int8_t *out, int count, int driftMax) {
+    __m256i s0 = _mm256_loadu_si256((__m256i *)rng->s[0]);
+    __m256i s1 = _mm256_loadu_si256((__m256i *)rng->s[1]);
+    __m256i s2 = _mm256_loadu_si256((__m256i *)rng->s[2]);
+    __m256i s3 = _mm256_loadu_si256((__m256i *)rng->s[3]);
+    const __m256i span = _mm256_set1_epi16((short)(2 * driftMax + 1));
+    const __m256i offset = _mm256_set1_epi16((short)driftMax);
+
+    for (int base = 0; base < count; base += DRIFT_BLOCK) {
+        __m256i x5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+        __m256i r = rotl64x4(x5, 7);
+        r = _mm256_add_epi64(_mm256_slli_epi64(r, 3), r);
+
+        __m256i t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = rotl64x4(s3, 45);
+
+        __m256i drift = _mm256_sub_epi16(_mm256_mulhi_epu16(r, span), offset);
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(drift, drift), 0x08);
+        _mm_storeu_si128((__m128i *)&out[base], _mm256_castsi256_si128(packed));
+    }
+    _mm256_storeu_si256((__m256i *)rng->s[0], s0);
+    _mm256_storeu_si256((__m256i *)rng->s[1], s1);
+    _mm256_storeu_si256((__m256i *)rng->s[2], s2);
+    _mm256_storeu_si256((__m256i *)rng->s[3], s3);
+}
+#endif
+
+// Pick the widest kernel the CPU supports (LOADGEN_KERNEL=scalar|avx2 overrides)
+void selectDriftKernel(void) {
+    const char *forced = getenv("LOADGEN_KERNEL");
+    driftKernel = generateDriftScalar;
+    driftKernelName = "scalar";
+
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if ((forced == NULL || strcmp(forced, "avx2") == 0) && __builtin_cpu_supports("avx2")) {
+        driftKernel = generateDriftAVX2;
+        driftKernelName = "avx2";
+    }
+#else
+    (void)forced;
+#endif
+}
+
+// ---------------- Fleet ----------------
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    const FaultRule *rule = &faultRules[sensor->type];
+    sensor->is_faulty = rule->faultAbove ? (sensor->value > rule->threshold) : (sensor->value < rule->threshold);
+}
+
+// Update Sensor Data from a pre-generated drift batch (clamped at 0 instead of wrapping)
+void updateSensorData(Vehicle *vehicle, const int8_t *drift) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int v = vehicle->sensors[i].value + drift[i];
+        vehicle->sensors[i].value = (uint16_t)(v < 0 ? 0 : v > UINT16_MAX ? UINT16_MAX : v);
+        checkSensorFault(&vehicle->sensors[i]);
+    }
+}
+
+// Assign sensors from the profile; the replacement for rand()-based assignRandomSensors
+static void assignProfileSensors(Vehicle *vehicle, const FleetProfile *p, Xoshiro *rng, uint32_t totalWeight) {
+    vehicle->sensor_count = p->minSensors + uniformBelow(rng, p->maxSensors - p->minSensors + 1);
+
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        uint32_t pick = uniformBelow(rng, totalWeight);
+        int type = 0;
+        while (pick >= p->typeWeight[type]) pick -= p->typeWeight[type++];
+
+        SensorData *s = &vehicle->sensors[i];
+        s->type = (SensorType)type;
+        s->value = uniformBelow(rng, 1000) < p->faultPerMille ? drawFaultyValue(rng, s->type)
+                                                               : drawValue(rng, &p->values[type]);
+        checkSensorFault(s);
+    }
+}
+
+typedef struct {
+    SyntheticFleet *fleet;
+    int thread, threads;
+    int ticks;       // 0 = build the chunk, otherwise run this many ticks
+} WorkerArgs;
+
+// Chunks are dealt round-robin; every chunk only touches its own vehicles and stream
+static void *chunkWorker(void *arg) {
+    WorkerArgs *w = arg;
+    SyntheticFleet *fleet = w->fleet;
+    const FleetProfile *p = fleet->profile;
+    int8_t drift[CHUNK_VEHICLES * MAX_SENSORS + DRIFT_BLOCK];
+
+    uint32_t totalWeight = 0;
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) totalWeight += p->typeWeight[t];
+
+    for (int c = w->thread; c < fleet->chunkCount; c += w->threads) {
+        FleetChunk *chunk = &fleet->chunks[c];
+        Vehicle *vehicles = &fleet->vehicles[chunk->firstVehicle];
+
+        if (w->ticks == 0) {
+            Xoshiro rng;
+            xoshiroSeed(&rng, fleet->seed, c, 0);
+            laneRngSeed(&chunk->drift, fleet->seed, c);
+            chunk->sensorCount = 0;
+            for (int i = 0; i < chunk->vehicleCount; i++) {
+                unsigned index = (unsigned)(chunk->firstVehicle + i);
+                snprintf(vehicles[i].id, sizeof(vehicles[i].id), "VH%u", index % 10000000U);
+                vehicles[i].status = 1;
+                assignProfileSensors(&vehicles[i], p, &rng, totalWeight);
+                chunk->sensorCount += vehicles[i].sensor_count;
+            }
+            continue;
+        }
+
+        int padded = (chunk->sensorCount + DRIFT_BLOCK - 1) / DRIFT_BLOCK * DRIFT_BLOCK;
+        for (int tick = 0; tick < w->ticks; tick++) {
+            driftKernel(&chunk->drift, drift, padded, p->driftMax);
+            const int8_t *d = drift;
+            for (int i = 0; i < chunk->vehicleCount; i++) {
+                updateSensorData(&vehicles[i], d);
+                d += vehicles[i].sensor_count;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void runWorkers(SyntheticFleet *fleet, int threads, int ticks) {
+    pthread_t ids[MAX_THREADS];
+    WorkerArgs args[MAX_THREADS];
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    for (int t = 0; t < threads; t++) {
+        args[t] = (WorkerArgs){fleet, t, threads, ticks};
+        if (t > 0 && pthread_create(&ids[t], NULL, chunkWorker, &args[t]) != 0) {
+            printf("Error: Cannot start worker %d, running its chunks inline\n", t);
+            ids[t] = 0;
+        }
+    }
+    chunkWorker(&args[0]);
+    for (int t = 1; t < threads; t++) {
+        if (ids[t]) pthread_join(ids[t], NULL);
+        else chunkWorker(&args[t]);
+    }
+}
+
+int generateFleet(SyntheticFleet *fleet, const FleetProfile *profile, int vehicleCount, uint64_t seed, int threads) {
+    memset(fleet, 0, sizeof(*fleet));
+    fleet->profile = profile;
+    fleet->seed = seed;
+    fleet->count = vehicleCount;
+    fleet->chunkCount = (vehicleCount + CHUNK_VEHICLES - 1) / CHUNK_VEHICLES;
+    fleet->vehicles = calloc(vehicleCount, sizeof(Vehicle));
+    fleet->chunks = aligned_alloc(64, sizeof(FleetChunk) * (fleet->chunkCount + 1));
+    if (fleet->vehicles == NULL || fleet->chunks == NULL) {
+        printf("Error: Cannot allocate %d vehicles\n", vehicleCount);
+        freeFleet(fleet);
+        return -1;
+    }
+
+    for (int c = 0; c < fleet->chunkCount; c++) {
+        fleet->chunks[c].firstVehicle = c * CHUNK_VEHICLES;
+        fleet->chunks[c].vehicleCount = vehicleCount - c * CHUNK_VEHICLES < CHUNK_VEHICLES
+                                            ? vehicleCount - c * CHUNK_VEHICLES : CHUNK_VEHICLES;
+    }
+    runWorkers(fleet, threads, 0);
+    for (int c = 0; c < fleet->chunkCount; c++) fleet->sensorCount += fleet->chunks[c].sensorCount;
+    return 0;
+}
+
+void freeFleet(SyntheticFleet *fleet) {
+    free(fleet->vehicles);
+    free(fleet->chunks);
+    memset(fleet, 0, sizeof(*fleet));
+}
+
+void runTicks(SyntheticFleet *fleet, int ticks, int threads) {
+    if (ticks > 0) runWorkers(fleet, threads, ticks);
+}
+
+// FNV-1a over every id, type, value and fault flag; equal checksums = identical runs
+uint64_t fleetChecksum(const SyntheticFleet *fleet) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (int i = 0; i < fleet->count; i++) {
+        const Vehicle *v = &fleet->vehicles[i];
+        for (const char *c = v->id; *c; c++) h = (h ^ (uint8_t)*c) * 0x100000001B3ULL;
+        for (int j = 0; j < v->sensor_count; j++) {
+            uint64_t word = (uint64_t)v->sensors[j].type | ((uint64_t)v->sensors[j].value << 8) |
+                            ((uint64_t)v->sensors[j].is_faulty << 24);
+            h = (h ^ word) * 0x100000001B3ULL;
+        }
+    }
+    return h;
+}
+
+const FleetProfile *findProfile(const char *name) {
+    for (int i = 0; i < PROFILE_COUNT; i++) {
+        if (strcmp(fleetProfiles[i].name, name) == 0) return &fleetProfiles[i];
+    }
+    printf("Error: Unknown profile %s\n", name);
+    return NULL;
+}
+
+static void printFleetSummary(const SyntheticFleet *fleet) {
+    long perType[SENSOR_TYPE_COUNT] = {0}, faulty = 0;
+    for (int i = 0; i < fleet->count; i++) {
+        for (int j = 0; j < fleet->vehicles[i].sensor_count; j++) {
+            perType[fleet->vehicles[i].sensors[j].type]++;
+            faulty += fleet->vehicles[i].sensors[j].is_faulty;
+        }
+    }
+    printf("Profile %s: %d vehicles, %ld sensors (temp %ld, speed %ld, fuel %ld, brake %ld, battery %ld), %.2f%% faulty\n",
+           fleet->profile->name, fleet->count, fleet->sensorCount, perType[0], perType[1], perType[2], perType[3],
+           perType[4], 100.0 * faulty / (fleet->sensorCount ? fleet->sensorCount : 1));
+}
+
+// ---------------- Legacy rand() path (10-11) ----------------
+
+static void legacyAssignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+static void legacyUpdateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const FleetProfile *profile = findProfile(argc > 1 ? argv[1] : "stress");
+    if (profile == NULL) return 1;
+    uint64_t seed = argc > 2 ? strtoull(argv[2], NULL, 0) : 20240601;
+    int vehicles = argc > 3 ? atoi(argv[3]) : profile->vehicleCount;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 4 ? atoi(argv[4]) : (cpus > 1 ? (int)cpus : 4);
+    int ticks = argc > 5 ? atoi(argv[5]) : 20;
+    selectDriftKernel();
+
+    // Generation + ticks, timed
+    SyntheticFleet fleet;
+    struct timespec t0, t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (generateFleet(&fleet, profile, vehicles, seed, threads) != 0) return 1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    runTicks(&fleet, ticks, threads);
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    uint64_t checksum = fleetChecksum(&fleet);
+
+    printFleetSummary(&fleet);
+    double genMs = elapsedMs(t0, t1), tickMs = elapsedMs(t1, t2);
+    printf("Seed %llu, %d threads, drift kernel %s\n", (unsigned long long)seed, threads, driftKernelName);
+    printf("Generate: %8.2f ms (%6.1f M sensors/s) | %d ticks: %8.2f ms (%6.1f M sensor updates/s)\n",
+           genMs, fleet.sensorCount / genMs / 1e3, ticks, tickMs, fleet.sensorCount * (double)ticks / tickMs / 1e3);
+    printf("Replay checksum: %016llx\n", (unsigned long long)checksum);
+
+    // Replay with 1 thread and the other kernel; the checksum must not move
+    printf("\n---- Replay Check ----\n");
+    DriftKernel chosen = driftKernel;
+    const char *chosenName = driftKernelName;
+    int replayThreads[] = {1, threads > 1 ? threads : 3};
+    DriftKernel replayKernels[] = {generateDriftScalar, chosen};
+    const char *replayNames[] = {"scalar", chosenName};
+    int mismatches = 0;
+    for (int r = 0; r < 2; r++) {
+        driftKernel = replayKernels[r];
+        SyntheticFleet replay;
+        if (generateFleet(&replay, profile, vehicles, seed, replayThreads[r]) != 0) return 1;
+        runTicks(&replay, ticks, replayThreads[r]);
+        uint64_t again = fleetChecksum(&replay);
+        printf("%d thread(s), %-6s kernel: %016llx %s\n", replayThreads[r], replayNames[r],
+               (unsigned long long)again, again == checksum ? "identical" : "MISMATCH");
+        mismatches += again != checksum;
+        freeFleet(&replay);
+    }
+    driftKernel = chosen;
+    freeFleet(&fleet);
+
+    // Old rand() path over the same number of vehicles, single threaded
+    printf("\n---- rand() Baseline ----\n");
+    Vehicle *legacy = calloc(vehicles, sizeof(Vehicle));
+    long legacySensors = 0;
+    srand(1);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < vehicles; i++) {
+        legacyAssignRandomSensors(&legacy[i]);
+        legacySensors += legacy[i].sensor_count;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < vehicles; i++) legacyUpdateSensorData(&legacy[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    genMs = elapsedMs(t0, t1);
+    tickMs = elapsedMs(t1, t2);
+    printf("Generate: %8.2f ms (%6.1f M sensors/s) | %d ticks: %8.2f ms (%6.1f M sensor updates/s)\n",
+           genMs, legacySensors / genMs / 1e3, ticks, tickMs, legacySensors * (double)ticks / tickMs / 1e3);
+    free(legacy);
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,827 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Build: gcc -O2 "28 Fleet Hot Path Benchmark Suite.c"
+// Usage: ./a.out [--sizes 10,1000,...] [--filter text] [--min-ms N] [--json path]
+//
+// Each case is a copy of the original function from the numbered program it names,
+// renamed only where two programs used the same identifier.
+
+#define DEFAULT_MIN_MS 50
+#define KEY_COUNT 1024          // Random lookup keys cycled through by search cases
+#define MAX_RESULTS 128
+
+// ---------------- Allocation Counting ----------------
+
+// glibc exports its allocator under __libc_* names, so the benchmark can interpose
+// malloc/calloc/realloc/free and count every call, including those made inside
+// fopen() and friends.
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static unsigned long allocCount;
+static unsigned long allocBytes;
+
+void *malloc(size_t size) {
+    allocCount++;
+    allocBytes += size;
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size) {
+    allocCount++;
+    allocBytes += count * size;
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size) {
+    allocCount++;
+    allocBytes += size;
+    return __libc_realloc(ptr, size);
+}
+
+void free(void *ptr) {
+    __libc_free(ptr);
+}
+#define ALLOC_COUNTING 1
+#else
+static unsigned long allocCount;
+static unsigned long allocBytes;
+#define ALLOC_COUNTING 0
+#endif
+
+// ---------------- 01: Device lookup ----------------
+
+typedef struct {
+    int id;
+    char name[20];
+    void (*action)(int);       // Main action function pointer
+    void (*timedAction)(int);  // Timed action function pointer
+    int runtimeHours;          // Assigned runtime in hours
+} Device;
+
+void turnOn(int id) { printf("Device %d: Turned ON\n", id); }
+void runFor10Hours(int id) { printf("Device %d is running for 10 hours.\n", id); }
+
+// Function to find a device by ID
+Device* findDeviceByID(Device devices[], int numDevices, int id) {
+    for (int i = 0; i < numDevices; i++) {
+        if (devices[i].id == id) {
+            return &devices[i];
+        }
+    }
+    return NULL;
+}
+
+// ---------------- 08: Make/model search and removal ----------------
+
+typedef struct {
+    char make[50];
+    char model[50];
+    int year;
+    float engine_capacity;
+    int mileage;
+    int seat;
+} FleetVehicle;
+
+// Same layout as 08 with heap storage so the fleet can reach 10^7 entries
+typedef struct {
+    FleetVehicle *vehicles;
+    int count;
+    int capacity;
+} VehicleFleet;
+
+// Function to add a vehicle to the fleet
+void addVehicle(VehicleFleet *fleet, FleetVehicle vehicle) {
+    if (fleet->count < fleet->capacity) {
+        fleet->vehicles[fleet->count++] = vehicle;
+    } else {
+        printf("Error: Fleet is full, cannot add vehicle\n");
+    }
+}
+
+// Function to search for a vehicle in the fleet by make and model
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model) {
+    for (int i = 0; i < fleet->count; i++) {
+        if (strcmp(fleet->vehicles[i].make, make) == 0 && strcmp(fleet->vehicles[i].model, model) == 0) {
+            return i; // Return the index of the found vehicle
+        }
+    }
+    return -1; // Return -1 if not found
+}
+
+// Function to remove a vehicle from the fleet
+int removeVehicle(VehicleFleet *fleet, char *make, char *model) {
+    int index = findVehicleIndex(fleet, make, model);
+    if (index == -1) {
+        return -1; // Vehicle not found
+    }
+
+    // Shift the remaining vehicles to fill the gap
+    for (int i = index; i < fleet->count - 1; i++) {
+        fleet->vehicles[i] = fleet->vehicles[i + 1];
+    }
+    fleet->count--;
+    return 0; // Vehicle removed successfully
+}
+
+// ---------------- 11: Real-time sensor update and logging ----------------
+
+#define MAX_SENSORS 5
+
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} RtSensorType;
+
+typedef struct {
+    RtSensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} RtVehicle;
+
+static const char *benchLogPath = "/tmp/fleet_bench_sensor_log.txt";
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Update Sensor Data in Real Time and Randomly Add More Sensors
+void updateSensorData(RtVehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+
+    // Randomly add a new sensor if vehicle has space
+    if (vehicle->sensor_count < MAX_SENSORS) {
+        int add_new_sensor = rand() % 10; // 30% chance to add a new sensor
+        if (add_new_sensor < 3) {
+            int new_index = vehicle->sensor_count;
+            vehicle->sensors[new_index].type = (RtSensorType)(rand() % MAX_SENSORS); // Random sensor type
+            vehicle->sensors[new_index].value = (rand() % 50) + 10; // Assign random value
+            vehicle->sensors[new_index].is_faulty = 0; // Initially not faulty
+            vehicle->sensor_count++;
+            printf("🚗 Vehicle %s added new sensor type %d!\n", vehicle->id, vehicle->sensors[new_index].type);
+        }
+    }
+}
+
+// Log Sensor Data to File (path moved out of the working directory)
+void logSensorData(RtVehicle *vehicle) {
+    FILE *logFile = fopen(benchLogPath, "a");
+    if (logFile == NULL) return;
+
+    time_t now;
+    time(&now);
+    fprintf(logFile, "\n[%s] Vehicle ID: %s\n", ctime(&now), vehicle->id);
+
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        fprintf(logFile, "Sensor Type: %d, Value: %d %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].is_faulty ? "[FAULTY]" : "");
+    }
+    fclose(logFile);
+}
+
+// ---------------- 12/13: Sensor analysis and safety ----------------
+
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} DiagSensorType;
+
+typedef struct {
+    DiagSensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+typedef struct {
+    float avgTemp;
+    float minVoltage;
+    int criticalSensors;
+} DiagnosticInfo;
+
+typedef struct {
+    char id[10];
+    Sensor sensors[5];
+    int healthStatus;
+} DiagVehicle;
+
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+typedef void (*SensorAnalysisFunction)(Sensor *, DiagnosticInfo *, int *);
+
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+void simulateSensorInput(DiagVehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+// 12: direct calls
+void analyzeSensorsDirect(DiagVehicle *v, DiagnosticInfo *diag) {
+    diag->avgTemp = 0;
+    diag->minVoltage = 99;
+    diag->criticalSensors = 0;
+
+    updateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    diag->avgTemp = v->sensors[TEMP_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    diag->minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+}
+
+// 13: function-pointer table
+void analyzeTempSensor(Sensor *s, DiagnosticInfo *diag, int *criticalCount) {
+    updateSensorStatus(s, s->value, "OK", "OVERHEAT", 100, criticalCount);
+    diag->avgTemp = s->value;
+}
+
+void analyzeVoltageSensor(Sensor *s, DiagnosticInfo *diag, int *criticalCount) {
+    updateSensorStatus(s, s->value, "OK", "LOW VOLTAGE", 12.0, criticalCount);
+    diag->minVoltage = s->value;
+}
+
+void analyzeBrakeSensor(Sensor *s, DiagnosticInfo *diag, int *criticalCount) {
+    (void)diag;
+    updateSensorStatus(s, s->value, "OK", "BRAKE FAIL", 1, criticalCount);
+}
+
+void analyzeTireSensor(Sensor *s, DiagnosticInfo *diag, int *criticalCount) {
+    (void)diag;
+    updateSensorStatus(s, s->value, "OK", "LOW PRESSURE", 30, criticalCount);
+}
+
+void analyzeDistanceSensor(Sensor *s, DiagnosticInfo *diag, int *criticalCount) {
+    (void)diag;
+    updateSensorStatus(s, s->value, "OK", "OBSTACLE TOO CLOSE", 20, criticalCount);
+}
+
+SensorAnalysisFunction analysisFunctions[] = {
+    analyzeTempSensor,
+    analyzeVoltageSensor,
+    analyzeBrakeSensor,
+    analyzeTireSensor,
+    analyzeDistanceSensor
+};
+
+void analyzeSensorsTable(DiagVehicle *v, DiagnosticInfo *diag, SensorAnalysisFunction functions[]) {
+    diag->avgTemp = 0;
+    diag->minVoltage = 99;
+    diag->criticalSensors = 0;
+
+    // Call each analysis function using function pointers
+    for (int i = 0; i < 5; i++) {
+        functions[i](&v->sensors[i], diag, &diag->criticalSensors);
+    }
+}
+
+void checkSafety(DiagVehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+// ---------------- 14: Diagnostics with alerts ----------------
+
+#define ALERT_SENSORS 3
+
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE
+} AlertSensorType;
+
+typedef struct {
+    AlertSensorType type;
+    float value;
+    char status[20];
+} AlertSensor;
+
+typedef struct {
+    char id[10];
+    AlertSensor sensors[ALERT_SENSORS];
+} AlertVehicle;
+
+// Log Alert
+void logAlert(AlertVehicle *vehicle, const char *message) {
+    time_t now;
+    time(&now);
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+// Analyze One Sensor
+void analyzeSensor(AlertSensor *sensor) {
+    switch (sensor->type) {
+        case ENGINE_TEMP:
+            if (sensor->value > 110)
+                strcpy(sensor->status, "Overheat");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case OIL_PRESSURE:
+            if (sensor->value < 25)
+                strcpy(sensor->status, "Low Pressure");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case BATTERY_VOLTAGE:
+            if (sensor->value < 11.5)
+                strcpy(sensor->status, "Low Battery");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+    }
+}
+
+// Diagnostics Function (uses analyzeSensor inside)
+void performDiagnostics(AlertVehicle *vehicle) {
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    for (int i = 0; i < ALERT_SENSORS; i++) {
+        analyzeSensor(&vehicle->sensors[i]);
+
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].status);
+
+        if (strcmp(vehicle->sensors[i].status, "Normal") != 0) {
+            logAlert(vehicle, vehicle->sensors[i].status);
+        }
+    }
+}
+
+// ---------------- Harness ----------------
+
+// A case builds a fleet of 'size' items once, then runs 'ops' operations on it.
+// itemsPerOp turns ops/sec into items/sec (elements scanned, sensors analysed, ...).
+typedef struct {
+    const char *name;
+    size_t bytesPerItem;
+    void *(*setup)(int size);
+    void (*run)(void *state, long ops);
+    void (*teardown)(void *state);
+    double (*itemsPerOp)(int size);
+    int quietStdout;         // Case prints on every op; send stdout to /dev/null while timing
+} BenchCase;
+
+typedef struct {
+    const char *name;
+    int size;
+    long ops;
+    double nsPerOp;
+    double itemsPerSec;
+    double allocsPerOp;
+    double allocBytesPerOp;
+    int skipped;
+} BenchResult;
+
+typedef struct {
+    int size;
+    long cursor;
+    int keys[KEY_COUNT];
+    void *items;
+    VehicleFleet fleet;
+} BenchState;
+
+static uint64_t benchRng = 0x2545F4914F6CDD1DULL;
+
+static uint32_t nextRandom(void) {
+    benchRng ^= benchRng << 13;
+    benchRng ^= benchRng >> 7;
+    benchRng ^= benchRng << 17;
+    return (uint32_t)(benchRng >> 32);
+}
+
+static double elapsedNs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec);
+}
+
+static BenchState *newState(int size, size_t itemSize) {
+    BenchState *s = calloc(1, sizeof(BenchState));
+    if (s == NULL) {
+        printf("Error: Out of memory for benchmark state\n");
+        return NULL;
+    }
+    s->size = size;
+    s->items = itemSize ? malloc(itemSize * size) : NULL;
+    if (itemSize && s->items == NULL) {
+        printf("Error: Out of memory for %d benchmark items\n", size);
+        free(s);
+        return NULL;
+    }
+    for (int k = 0; k < KEY_COUNT; k++) s->keys[k] = (int)(nextRandom() % size);
+    return s;
+}
+
+static void freeState(void *state) {
+    BenchState *s = state;
+    free(s->items);
+    free(s->fleet.vehicles);
+    free(s);
+}
+
+static double itemsScanned(int size) { return (size + 1) / 2.0; }
+static double itemsWholeFleet(int size) { return size; }
+static double itemsFiveSensors(int size) { (void)size; return 5; }
+static double itemsThreeSensors(int size) { (void)size; return ALERT_SENSORS; }
+
+// findDeviceByID: ids are spread out so they are not equal to the index
+static void *setupDevices(int size) {
+    BenchState *s = newState(size, sizeof(Device));
+    if (s == NULL) return NULL;
+    Device *devices = s->items;
+    for (int i = 0; i < size; i++) {
+        devices[i] = (Device){i * 7 + 101, "", turnOn, runFor10Hours, 10};
+        snprintf(devices[i].name, sizeof(devices[i].name), "Device %d", i);
+    }
+    for (int k = 0; k < KEY_COUNT; k++) s->keys[k] = s->keys[k] * 7 + 101;
+    return s;
+}
+
+static void runFindDevice(void *state, long ops) {
+    BenchState *s = state;
+    long found = 0;
+    for (long op = 0; op < ops; op++) {
+        found += findDeviceByID(s->items, s->size, s->keys[op & (KEY_COUNT - 1)]) != NULL;
+    }
+    if (found != ops) printf("Error: findDeviceByID missed %ld keys\n", ops - found);
+}
+
+// findVehicleIndex / removeVehicle: 64 models per make, like a real fleet's repeated makes
+static void makeFleetVehicle(FleetVehicle *v, int i) {
+    memset(v, 0, sizeof(*v));
+    snprintf(v->make, sizeof(v->make), "Make%d", i / 64);
+    snprintf(v->model, sizeof(v->model), "Model%d", i);
+    v->year = 2000 + i % 25;
+    v->engine_capacity = 1.0f + (i % 30) / 10.0f;
+    v->mileage = i % 200000;
+    v->seat = 2 + i % 6;
+}
+
+static void *setupFleet(int size) {
+    BenchState *s = newState(size, 0);
+    if (s == NULL) return NULL;
+    s->fleet.vehicles = malloc(sizeof(FleetVehicle) * size);
+    if (s->fleet.vehicles == NULL) {
+        printf("Error: Out of memory for %d fleet vehicles\n", size);
+        free(s);
+        return NULL;
+    }
+    s->fleet.capacity = size;
+    for (int i = 0; i < size; i++) {
+        FleetVehicle v;
+        makeFleetVehicle(&v, i);
+        addVehicle(&s->fleet, v);
+    }
+    return s;
+}
+
+static void runFindVehicle(void *state, long ops) {
+    BenchState *s = state;
+    long found = 0;
+    for (long op = 0; op < ops; op++) {
+        FleetVehicle key;
+        makeFleetVehicle(&key, s->keys[op & (KEY_COUNT - 1)]);
+        found += findVehicleIndex(&s->fleet, key.make, key.model) >= 0;
+    }
+    if (found != ops) printf("Error: findVehicleIndex missed %ld keys\n", ops - found);
+}
+
+// One op = remove a vehicle and append it again, so the fleet size stays fixed
+static void runRemoveVehicle(void *state, long ops) {
+    BenchState *s = state;
+    for (long op = 0; op < ops; op++) {
+        FleetVehicle key;
+        makeFleetVehicle(&key, s->keys[op & (KEY_COUNT - 1)]);
+        if (removeVehicle(&s->fleet, key.make, key.model) != 0) {
+            printf("Error: removeVehicle missed %s %s\n", key.make, key.model);
+            return;
+        }
+        addVehicle(&s->fleet, key);
+    }
+}
+
+// updateSensorData + checkSensorFault: full vehicles, so the "add sensor" branch never prints
+static void *setupRtFleet(int size) {
+    BenchState *s = newState(size, sizeof(RtVehicle));
+    if (s == NULL) return NULL;
+    RtVehicle *vehicles = s->items;
+    for (int i = 0; i < size; i++) {
+        memset(&vehicles[i], 0, sizeof(RtVehicle));
+        snprintf(vehicles[i].id, sizeof(vehicles[i].id), "VH%u", (unsigned)i % 10000000U);
+        vehicles[i].sensor_count = MAX_SENSORS;
+        vehicles[i].status = 1;
+        for (int j = 0; j < MAX_SENSORS; j++) {
+            vehicles[i].sensors[j].type = (RtSensorType)(rand() % MAX_SENSORS);
+            vehicles[i].sensors[j].value = (rand() % 50) + 10;
+        }
+    }
+    return s;
+}
+
+static void runUpdateSensors(void *state, long ops) {
+    BenchState *s = state;
+    RtVehicle *vehicles = s->items;
+    for (long op = 0; op < ops; op++) {
+        updateSensorData(&vehicles[s->cursor]);
+        if (++s->cursor == s->size) s->cursor = 0;
+    }
+}
+
+static void runLogSensorData(void *state, long ops) {
+    BenchState *s = state;
+    RtVehicle *vehicles = s->items;
+    for (long op = 0; op < ops; op++) {
+        logSensorData(&vehicles[s->cursor]);
+        if (++s->cursor == s->size) s->cursor = 0;
+    }
+}
+
+static void teardownLog(void *state) {
+    unlink(benchLogPath);
+    freeState(state);
+}
+
+// analyzeSensors + checkSafety (12 direct, 13 table)
+static void *setupDiagFleet(int size) {
+    BenchState *s = newState(size, sizeof(DiagVehicle));
+    if (s == NULL) return NULL;
+    DiagVehicle *vehicles = s->items;
+    for (int i = 0; i < size; i++) {
+        snprintf(vehicles[i].id, sizeof(vehicles[i].id), "VH%u", (unsigned)i % 10000000U);
+        for (int j = 0; j < 5; j++) {
+            vehicles[i].sensors[j].type = (DiagSensorType)j;
+            strcpy(vehicles[i].sensors[j].status, "Unknown");
+        }
+        vehicles[i].healthStatus = 1;
+        simulateSensorInput(&vehicles[i]);
+    }
+    return s;
+}
+
+static void runAnalyzeDirect(void *state, long ops) {
+    BenchState *s = state;
+    DiagVehicle *vehicles = s->items;
+    DiagnosticInfo diag;
+    SafetyModule safety;
+    long alerts = 0;
+    for (long op = 0; op < ops; op++) {
+        analyzeSensorsDirect(&vehicles[s->cursor], &diag);
+        checkSafety(&vehicles[s->cursor], &safety);
+        alerts += safety.obstacleAlert + safety.brakeFailure + safety.tirePressureIssue;
+        if (++s->cursor == s->size) s->cursor = 0;
+    }
+    __asm__ volatile("" : : "r"(alerts));
+}
+
+static void runAnalyzeTable(void *state, long ops) {
+    BenchState *s = state;
+    DiagVehicle *vehicles = s->items;
+    DiagnosticInfo diag;
+    SafetyModule safety;
+    long alerts = 0;
+    for (long op = 0; op < ops; op++) {
+        analyzeSensorsTable(&vehicles[s->cursor], &diag, analysisFunctions);
+        checkSafety(&vehicles[s->cursor], &safety);
+        alerts += safety.obstacleAlert + safety.brakeFailure + safety.tirePressureIssue;
+        if (++s->cursor == s->size) s->cursor = 0;
+    }
+    __asm__ volatile("" : : "r"(alerts));
+}
+
+// performDiagnostics: same value ranges as updateSensorData in 14
+static void *setupAlertFleet(int size) {
+    BenchState *s = newState(size, sizeof(AlertVehicle));
+    if (s == NULL) return NULL;
+    AlertVehicle *vehicles = s->items;
+    for (int i = 0; i < size; i++) {
+        snprintf(vehicles[i].id, sizeof(vehicles[i].id), "V%u", (unsigned)i % 100000000U);
+        vehicles[i].sensors[ENGINE_TEMP] = (AlertSensor){ENGINE_TEMP, 80 + rand() % 40, "Normal"};
+        vehicles[i].sensors[OIL_PRESSURE] = (AlertSensor){OIL_PRESSURE, 20 + rand() % 40, "Normal"};
+        vehicles[i].sensors[BATTERY_VOLTAGE] = (AlertSensor){BATTERY_VOLTAGE, 11 + ((rand() % 30) / 10.0), "Normal"};
+    }
+    return s;
+}
+
+static void runDiagnostics(void *state, long ops) {
+    BenchState *s = state;
+    AlertVehicle *vehicles = s->items;
+    for (long op = 0; op < ops; op++) {
+        performDiagnostics(&vehicles[s->cursor]);
+        if (++s->cursor == s->size) s->cursor = 0;
+    }
+}
+
+static const BenchCase benchCases[] = {
+    {"findDeviceByID", sizeof(Device), setupDevices, runFindDevice, freeState, itemsScanned, 0},
+    {"findVehicleIndex", sizeof(FleetVehicle), setupFleet, runFindVehicle, freeState, itemsScanned, 0},
+    {"removeVehicle", sizeof(FleetVehicle), setupFleet, runRemoveVehicle, freeState, itemsWholeFleet, 0},
+    {"updateSensorData+checkSensorFault", sizeof(RtVehicle), setupRtFleet, runUpdateSensors, freeState, itemsFiveSensors, 0},
+    {"analyzeSensors+checkSafety/direct", sizeof(DiagVehicle), setupDiagFleet, runAnalyzeDirect, freeState, itemsFiveSensors, 0},
+    {"analyzeSensors+checkSafety/fnptr", sizeof(DiagVehicle), setupDiagFleet, runAnalyzeTable, freeState, itemsFiveSensors, 0},
+    {"performDiagnostics", sizeof(AlertVehicle), setupAlertFleet, runDiagnostics, freeState, itemsThreeSensors, 1},
+    {"logSensorData", sizeof(RtVehicle), setupRtFleet, runLogSensorData, teardownLog, itemsFiveSensors, 0},
+};
+#define CASE_COUNT ((int)(sizeof(benchCases) / sizeof(benchCases[0])))
+
+// Time 'ops' operations with counters reset; stdout optionally parked on /dev/null
+static double timeOps(const BenchCase *bc, void *state, long ops, unsigned long *allocs, unsigned long *bytes) {
+    int savedStdout = -1;
+    if (bc->quietStdout) {
+        fflush(stdout);
+        savedStdout = dup(STDOUT_FILENO);
+        int devNull = open("/dev/null", O_WRONLY);
+        dup2(devNull, STDOUT_FILENO);
+        close(devNull);
+    }
+
+    struct timespec t0, t1;
+    unsigned long allocs0 = allocCount, bytes0 = allocBytes;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    bc->run(state, ops);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    *allocs = allocCount - allocs0;
+    *bytes = allocBytes - bytes0;
+
+    if (savedStdout >= 0) {
+        fflush(stdout);
+        dup2(savedStdout, STDOUT_FILENO);
+        close(savedStdout);
+    }
+    return elapsedNs(t0, t1);
+}
+
+// Doubles the op count until one timed run lasts at least minMs, then reports that run
+static BenchResult runCase(const BenchCase *bc, int size, double minMs, size_t memoryBudget) {
+    BenchResult r = {bc->name, size, 0, 0, 0, 0, 0, 0};
+    if ((double)bc->bytesPerItem * size > (double)memoryBudget) {
+        r.skipped = 1;
+        return r;
+    }
+    void *state = bc->setup(size);
+    if (state == NULL) {
+        r.skipped = 1;
+        return r;
+    }
+
+    unsigned long allocs = 0, bytes = 0;
+    long ops = 1;
+    double ns = timeOps(bc, state, ops, &allocs, &bytes);
+    while (ns < minMs * 1e6) {
+        long next = ns > 0 ? (long)(ops * (minMs * 1e6 / ns) * 1.2) : ops * 100;
+        if (next > ops * 100) next = ops * 100;
+        if (next <= ops) next = ops * 2;
+        ops = next;
+        ns = timeOps(bc, state, ops, &allocs, &bytes);
+    }
+    bc->teardown(state);
+
+    r.ops = ops;
+    r.nsPerOp = ns / ops;
+    r.itemsPerSec = bc->itemsPerOp(size) * ops / (ns / 1e9);
+    r.allocsPerOp = (double)allocs / ops;
+    r.allocBytesPerOp = (double)bytes / ops;
+    return r;
+}
+
+static void writeJson(const char *path, const BenchResult *results, int count, double minMs) {
+    FILE *out = fopen(path, "w");
+    if (out == NULL) {
+        printf("Error: Cannot write %s\n", path);
+        return;
+    }
+    time_t now = time(NULL);
+    char stamp[32];
+    strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+    fprintf(out, "{\n  \"suite\": \"fleet-hot-paths\",\n  \"timestamp\": \"%s\",\n", stamp);
+    fprintf(out, "  \"cpus\": %ld,\n  \"min_ms\": %.0f,\n  \"alloc_counting\": %s,\n  \"results\": [\n",
+            sysconf(_SC_NPROCESSORS_ONLN), minMs, ALLOC_COUNTING ? "true" : "false");
+    for (int i = 0; i < count; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "    {\"case\": \"%s\", \"size\": %d, ", r->name, r->size);
+        if (r->skipped) {
+            fprintf(out, "\"skipped\": true}");
+        } else {
+            fprintf(out, "\"ops\": %ld, \"ns_per_op\": %.3f, \"items_per_sec\": %.1f, \"allocs_per_op\": %.4f, \"alloc_bytes_per_op\": %.1f}",
+                    r->ops, r->nsPerOp, r->itemsPerSec, r->allocsPerOp, r->allocBytesPerOp);
+        }
+        fprintf(out, "%s\n", i + 1 < count ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    fclose(out);
+    printf("\nResults written to %s\n", path);
+}
+
+static int parseSizes(const char *list, int *sizes, int max) {
+    int count = 0;
+    while (*list && count < max) {
+        char *end;
+        double v = strtod(list, &end);  // Accepts 1e6 as well as 1000000
+        if (end == list) break;
+        if (v >= 1) sizes[count++] = (int)v;
+        list = *end == ',' ? end + 1 : end;
+    }
+    return count;
+}
+
+int main(int argc, char *argv[]) {
+    int sizes[16] = {10, 100, 1000, 10000, 100000, 1000000, 10000000};
+    int sizeCount = 7;
+    const char *filter = NULL;
+    const char *jsonPath = "bench_results.json";
+    double minMs = DEFAULT_MIN_MS;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--sizes") == 0) sizeCount = parseSizes(argv[i + 1], sizes, 16);
+        else if (strcmp(argv[i], "--filter") == 0) filter = argv[i + 1];
+        else if (strcmp(argv[i], "--min-ms") == 0) minMs = atof(argv[i + 1]);
+        else if (strcmp(argv[i], "--json") == 0) jsonPath = argv[i + 1];
+        else printf("Error: Unknown option %s\n", argv[i]);
+    }
+
+    // Skip sizes whose fleet would not fit in half of physical memory
+    size_t memoryBudget = (size_t)sysconf(_SC_PHYS_PAGES) * (size_t)sysconf(_SC_PAGESIZE) / 2;
+    srand(1);
+
+    BenchResult results[MAX_RESULTS];
+    int resultCount = 0;
+    printf("%-36s %10s %12s %14s %16s %10s\n", "case", "size", "ops", "ns/op", "items/s", "allocs/op");
+    for (int c = 0; c < CASE_COUNT; c++) {
+        if (filter && strstr(benchCases[c].name, filter) == NULL) continue;
+        for (int s = 0; s < sizeCount && resultCount < MAX_RESULTS; s++) {
+            BenchResult r = runCase(&benchCases[c], sizes[s], minMs, memoryBudget);
+            results[resultCount++] = r;
+            if (r.skipped) {
+                printf("%-36s %10d %12s\n", r.name, r.size, "skipped");
+            } else {
+                printf("%-36s %10d %12ld %14.1f %16.0f %10.2f\n", r.name, r.size, r.ops, r.nsPerOp, r.itemsPerSec, r.allocsPerOp);
+            }
+            fflush(stdout);
+        }
+    }
+    writeJson(jsonPath, results, resultCount, minMs);
+    return 0;
+}
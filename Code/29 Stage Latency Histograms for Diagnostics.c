@@ -0,0 +1,601 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+// Build: gcc -O2 "29 Stage Latency Histograms for Diagnostics.c"
+// Usage: ./a.out [ticks]   run the 12 loop with stats (kill -USR1 <pid> dumps them to stderr)
+//        ./a.out --read    print the live stats page of a running instance
+
+#define STATS_SHM_NAME "/fleet_diag_stats"
+#define STATS_MAGIC 0x53544147U   // "STAG"
+#define MAX_STAT_THREADS 8
+#define SUB_BUCKET_BITS 4         // 16 linear sub-buckets per power of two (~6% resolution)
+#define SUB_BUCKETS (1 << SUB_BUCKET_BITS)
+#define HIST_BUCKETS ((64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS)
+#define SLOW_TICK_SLOTS 16        // Stage breakdowns kept for the most recent slow ticks
+#define STAGE_SAMPLE_EVERY 16     // Power of two; stages are timed on 1 tick in this many
+#define SLOW_CAPTURE_TICKS 16     // Ticks timed stage by stage after a slow one
+#define SLOW_TICK_NS 10000        // Default slow-tick threshold, FLEET_SLOW_TICK_NS overrides
+
+// Sensor Types
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Diagnostic Info
+typedef struct {
+    float avgTemp;
+    float minVoltage;
+    int criticalSensors;
+} DiagnosticInfo;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[5];
+    int healthStatus;
+} Vehicle;
+
+// Safety Module
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+// Pipeline stages of one tick, in loop order
+typedef enum {
+    STAGE_SIMULATE,
+    STAGE_ANALYZE,
+    STAGE_SAFETY,
+    STAGE_LOG,
+    STAGE_TICK,        // Whole tick, stages plus glue
+    STAGE_COUNT
+} Stage;
+
+static const char *stageNames[STAGE_COUNT] = {"simulateSensorInput", "analyzeSensors", "checkSafety", "logHealthStatus", "tick"};
+
+// Log-linear histogram of clock ticks. Each thread writes only its own histograms,
+// with plain relaxed stores, so readers in other processes never block the writer.
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic uint64_t total;
+    _Atomic uint64_t min;
+    _Atomic uint64_t max;
+    _Atomic uint64_t buckets[HIST_BUCKETS];
+} LatencyHistogram;
+
+// Per-stage clock ticks of one tick that ran over the slow-tick threshold. Ticks whose
+// stages were not timed keep only the STAGE_TICK total.
+typedef struct {
+    _Atomic uint64_t tick;
+    _Atomic uint32_t stagesTimed;
+    _Atomic uint64_t stages[STAGE_COUNT];
+} SlowTick;
+
+typedef struct {
+    _Atomic uint32_t active;
+    int32_t pid;
+    _Atomic uint64_t ticks;
+    _Atomic uint64_t sensorsEvaluated;
+    _Atomic uint64_t alertsRaised;
+    _Atomic uint64_t bytesLogged;
+    LatencyHistogram stages[STAGE_COUNT];
+    _Atomic uint64_t slowTicks;
+    SlowTick slow[SLOW_TICK_SLOTS];     // Ring, slot slowTicks % SLOW_TICK_SLOTS is written next
+} ThreadStats;
+
+// The shared-memory stats page; ticksPerNs converts histogram units to nanoseconds
+typedef struct {
+    uint32_t magic;
+    uint32_t threadSlots;
+    double ticksPerNs;
+    uint64_t slowTickNs;
+    _Atomic uint32_t threadsRegistered;
+    ThreadStats threads[MAX_STAT_THREADS];
+} StatsPage;
+
+// Prototypes
+void initializeVehicle(Vehicle *v, const char *id);
+void simulateSensorInput(Vehicle *v);
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag);
+void checkSafety(Vehicle *v, SafetyModule *safety);
+int logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety);
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount);
+int statsOpen(void);
+void statsClose(void);
+ThreadStats *statsRegisterThread(void);
+void statsDump(int fd, const StatsPage *page);
+
+StatsPage *statsPage;
+static _Thread_local ThreadStats *threadStats;
+static volatile sig_atomic_t dumpRequested;
+int statsEnabled = 1;
+static uint64_t slowTickClocks;   // SLOW_TICK_NS in stageClock units, set by statsOpen
+
+// ---------------- Clock ----------------
+
+// TSC when available (cheapest steady clock), CLOCK_MONOTONIC otherwise
+static inline uint64_t stageClock(void) {
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+static uint64_t monotonicNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Clock ticks per nanosecond, measured against CLOCK_MONOTONIC over ~20 ms
+static double calibrateStageClock(void) {
+#ifdef HAVE_TSC
+    uint64_t ns0 = monotonicNs(), c0 = stageClock();
+    while (monotonicNs() - ns0 < 20000000ULL) {
+    }
+    uint64_t ns1 = monotonicNs(), c1 = stageClock();
+    return (double)(c1 - c0) / (double)(ns1 - ns0);
+#else
+    return 1.0;
+#endif
+}
+
+// ---------------- Histograms ----------------
+
+static inline int bucketIndex(uint64_t v) {
+    if (v < SUB_BUCKETS) return (int)v;
+    int magnitude = 63 - __builtin_clzll(v);
+    int sub = (int)(v >> (magnitude - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1);
+    return (magnitude - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+// Smallest value that lands in bucket i (inverse of bucketIndex)
+static uint64_t bucketLowest(int i) {
+    if (i < SUB_BUCKETS) return (uint64_t)i;
+    int magnitude = i / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    return ((uint64_t)SUB_BUCKETS + (i % SUB_BUCKETS)) << (magnitude - SUB_BUCKET_BITS);
+}
+
+// Single writer: load + store instead of a locked read-modify-write
+#define BUMP(field, delta) \
+    atomic_store_explicit(&(field), atomic_load_explicit(&(field), memory_order_relaxed) + (delta), memory_order_relaxed)
+
+static inline void histogramRecord(LatencyHistogram *h, uint64_t value) {
+    BUMP(h->buckets[bucketIndex(value)], 1);
+    BUMP(h->count, 1);
+    BUMP(h->total, value);
+    if (value < atomic_load_explicit(&h->min, memory_order_relaxed)) atomic_store_explicit(&h->min, value, memory_order_relaxed);
+    if (value > atomic_load_explicit(&h->max, memory_order_relaxed)) atomic_store_explicit(&h->max, value, memory_order_relaxed);
+}
+
+static uint64_t histogramPercentile(const LatencyHistogram *h, double p) {
+    uint64_t count = atomic_load_explicit(&h->count, memory_order_relaxed);
+    uint64_t target = (uint64_t)(count * p / 100.0), seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += atomic_load_explicit(&h->buckets[i], memory_order_relaxed);
+        if (seen > target) return bucketLowest(i);
+    }
+    return atomic_load_explicit(&h->max, memory_order_relaxed);
+}
+
+// ---------------- Stats Page ----------------
+
+int statsOpen(void) {
+    int fd = shm_open(STATS_SHM_NAME, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, sizeof(StatsPage)) != 0) {
+        printf("Error: Cannot create stats page %s\n", STATS_SHM_NAME);
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    statsPage = mmap(NULL, sizeof(StatsPage), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (statsPage == MAP_FAILED) {
+        printf("Error: Cannot map stats page\n");
+        statsPage = NULL;
+        return -1;
+    }
+    statsPage->threadSlots = MAX_STAT_THREADS;
+    statsPage->ticksPerNs = calibrateStageClock();
+    const char *slow = getenv("FLEET_SLOW_TICK_NS");
+    statsPage->slowTickNs = slow && atol(slow) > 0 ? (uint64_t)atol(slow) : SLOW_TICK_NS;
+    slowTickClocks = (uint64_t)(statsPage->slowTickNs * statsPage->ticksPerNs);
+    atomic_thread_fence(memory_order_release);
+    statsPage->magic = STATS_MAGIC;
+    return 0;
+}
+
+void statsClose(void) {
+    munmap(statsPage, sizeof(StatsPage));
+    shm_unlink(STATS_SHM_NAME);
+    statsPage = NULL;
+}
+
+ThreadStats *statsRegisterThread(void) {
+    uint32_t slot = atomic_fetch_add(&statsPage->threadsRegistered, 1);
+    if (slot >= MAX_STAT_THREADS) {
+        printf("Error: No stats slot left for this thread\n");
+        return NULL;
+    }
+    ThreadStats *t = &statsPage->threads[slot];
+    t->pid = getpid();
+    for (int s = 0; s < STAGE_COUNT; s++) atomic_store(&t->stages[s].min, UINT64_MAX);
+    atomic_store(&t->active, 1);
+    threadStats = t;
+    return t;
+}
+
+// Only write() and integer formatting, so it is also safe to call from a signal handler
+static void appendText(char *buf, size_t *len, size_t cap, const char *text) {
+    while (*text && *len + 1 < cap) buf[(*len)++] = *text++;
+}
+
+static void appendUnsigned(char *buf, size_t *len, size_t cap, uint64_t v, int width) {
+    char digits[24];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    for (int pad = n; pad < width && *len + 1 < cap; pad++) buf[(*len)++] = ' ';
+    while (n && *len + 1 < cap) buf[(*len)++] = digits[--n];
+}
+
+void statsDump(int fd, const StatsPage *page) {
+    char buf[8192];
+    for (uint32_t t = 0; t < page->threadSlots; t++) {
+        const ThreadStats *ts = &page->threads[t];
+        if (!atomic_load(&ts->active)) continue;
+
+        size_t len = 0;
+        appendText(buf, &len, sizeof(buf), "---- stats: pid ");
+        appendUnsigned(buf, &len, sizeof(buf), (uint64_t)ts->pid, 0);
+        appendText(buf, &len, sizeof(buf), " thread ");
+        appendUnsigned(buf, &len, sizeof(buf), t, 0);
+        appendText(buf, &len, sizeof(buf), " | ticks ");
+        appendUnsigned(buf, &len, sizeof(buf), atomic_load(&ts->ticks), 0);
+        appendText(buf, &len, sizeof(buf), " | sensors ");
+        appendUnsigned(buf, &len, sizeof(buf), atomic_load(&ts->sensorsEvaluated), 0);
+        appendText(buf, &len, sizeof(buf), " | alerts ");
+        appendUnsigned(buf, &len, sizeof(buf), atomic_load(&ts->alertsRaised), 0);
+        appendText(buf, &len, sizeof(buf), " | bytes logged ");
+        appendUnsigned(buf, &len, sizeof(buf), atomic_load(&ts->bytesLogged), 0);
+        appendText(buf, &len, sizeof(buf), "\nstage (ns)                count      min      p50      p90      p99    p99.9      max\n");
+
+        for (int s = 0; s < STAGE_COUNT; s++) {
+            const LatencyHistogram *h = &ts->stages[s];
+            uint64_t count = atomic_load(&h->count);
+            if (count == 0) continue;
+            const double k = page->ticksPerNs;
+            uint64_t values[6] = {
+                atomic_load(&h->min), histogramPercentile(h, 50), histogramPercentile(h, 90),
+                histogramPercentile(h, 99), histogramPercentile(h, 99.9), atomic_load(&h->max)};
+
+            size_t start = len;
+            appendText(buf, &len, sizeof(buf), stageNames[s]);
+            while (len - start < 20) buf[len++] = ' ';
+            appendUnsigned(buf, &len, sizeof(buf), count, 11);
+            for (int v = 0; v < 6; v++) appendUnsigned(buf, &len, sizeof(buf), (uint64_t)(values[v] / k), 9);
+            appendText(buf, &len, sizeof(buf), "\n");
+        }
+
+        // A reader can catch the newest slot half-written; it is a diagnostic, not a ledger
+        uint64_t slowCount = atomic_load(&ts->slowTicks);
+        appendText(buf, &len, sizeof(buf), "slow ticks (over ");
+        appendUnsigned(buf, &len, sizeof(buf), page->slowTickNs, 0);
+        appendText(buf, &len, sizeof(buf), " ns) ");
+        appendUnsigned(buf, &len, sizeof(buf), slowCount, 0);
+        appendText(buf, &len, sizeof(buf), slowCount ? ", latest first:\n" : "\n");
+        for (uint64_t n = 0; n < slowCount && n < SLOW_TICK_SLOTS; n++) {
+            const SlowTick *st = &ts->slow[(slowCount - 1 - n) % SLOW_TICK_SLOTS];
+            appendText(buf, &len, sizeof(buf), "  tick ");
+            appendUnsigned(buf, &len, sizeof(buf), atomic_load(&st->tick), 9);
+            int timed = atomic_load(&st->stagesTimed);
+            for (int s = timed ? 0 : STAGE_TICK; s < STAGE_COUNT; s++) {
+                appendText(buf, &len, sizeof(buf), s ? " | " : ": ");
+                appendText(buf, &len, sizeof(buf), stageNames[s]);
+                appendText(buf, &len, sizeof(buf), " ");
+                appendUnsigned(buf, &len, sizeof(buf), (uint64_t)(atomic_load(&st->stages[s]) / page->ticksPerNs), 0);
+            }
+            appendText(buf, &len, sizeof(buf), timed ? "\n" : " (stages not sampled)\n");
+        }
+        ssize_t ignored = write(fd, buf, len);
+        (void)ignored;
+    }
+}
+
+static void onDumpSignal(int sig) {
+    (void)sig;
+    dumpRequested = 1;
+}
+
+// Attach to a running instance's stats page and print it once
+static int readLiveStats(void) {
+    int fd = shm_open(STATS_SHM_NAME, O_RDONLY, 0);
+    if (fd < 0) {
+        printf("Error: No stats page %s (is the loop running?)\n", STATS_SHM_NAME);
+        return 1;
+    }
+    const StatsPage *page = mmap(NULL, sizeof(StatsPage), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (page == MAP_FAILED || page->magic != STATS_MAGIC) {
+        printf("Error: Stats page is not ready\n");
+        return 1;
+    }
+    statsDump(STDOUT_FILENO, page);
+    return 0;
+}
+
+// ---------------- Diagnostics (12) ----------------
+
+void initializeVehicle(Vehicle *v, const char *id) {
+    strcpy(v->id, id);
+    for (int i = 0; i < 5; i++) {
+        v->sensors[i].type = i;
+        v->sensors[i].value = 0;
+        strcpy(v->sensors[i].status, "Unknown");
+    }
+    v->healthStatus = 1;
+}
+
+void simulateSensorInput(Vehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag) {
+    diag->avgTemp = 0;
+    diag->minVoltage = 99;
+    diag->criticalSensors = 0;
+
+    updateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    diag->avgTemp = v->sensors[TEMP_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    diag->minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+}
+
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+void checkSafety(Vehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+// Same output as 12; returns the number of bytes written for the bytes-logged counter
+int logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety) {
+    time_t now;
+    time(&now);
+    int bytes = 0;
+
+    bytes += printf("\n--- Vehicle ID: %s ---\n", v->id);
+    bytes += printf("Time: %s", ctime(&now));
+    bytes += printf("Temp: %.1f (%s)\n", v->sensors[TEMP_SENSOR].value, v->sensors[TEMP_SENSOR].status);
+    bytes += printf("Voltage: %.1f (%s)\n", v->sensors[VOLTAGE_SENSOR].value, v->sensors[VOLTAGE_SENSOR].status);
+    bytes += printf("Brake: %s\n", v->sensors[BRAKE_SENSOR].status);
+    bytes += printf("Tire Pressure: %.1f (%s)\n", v->sensors[TIRE_SENSOR].value, v->sensors[TIRE_SENSOR].status);
+    bytes += printf("Distance: %.1fcm\n", v->sensors[DISTANCE_SENSOR].value);
+
+    if (safety->obstacleAlert)
+        bytes += printf("!!! ALERT: Obstacle too close\n");
+    if (safety->brakeFailure)
+        bytes += printf("!!! ALERT: Brake Failure\n");
+    if (safety->tirePressureIssue)
+        bytes += printf("!!! ALERT: Tire Pressure Issue\n");
+
+    bytes += printf("Health Score: %s\n", diag->criticalSensors > 0 ? "UNSAFE" : "SAFE");
+    bytes += printf("-------------------------\n");
+    return bytes;
+}
+
+// boundaries holds the five stage boundaries, or only [0] and [STAGE_TICK] when !timed
+static void recordSlowTick(ThreadStats *t, const uint64_t *boundaries, int timed) {
+    uint64_t n = atomic_load_explicit(&t->slowTicks, memory_order_relaxed);
+    SlowTick *st = &t->slow[n % SLOW_TICK_SLOTS];
+    atomic_store_explicit(&st->tick, atomic_load_explicit(&t->ticks, memory_order_relaxed), memory_order_relaxed);
+    atomic_store_explicit(&st->stagesTimed, (uint32_t)timed, memory_order_relaxed);
+    for (int s = 0; s < STAGE_TICK; s++) {
+        atomic_store_explicit(&st->stages[s], timed ? boundaries[s + 1] - boundaries[s] : 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&st->stages[STAGE_TICK], boundaries[STAGE_TICK] - boundaries[0], memory_order_relaxed);
+    atomic_store_explicit(&t->slowTicks, n + 1, memory_order_release);
+}
+
+// Start of the current tick: the previous tick's last clock read, 0 after a pause
+static _Thread_local uint64_t tickStart;
+
+// One tick of the 12 loop. A clock read costs 20+ ns in a VM against a tick of a few
+// microseconds, so only the whole tick is timed every time, with a single read: the
+// previous tick's end is this tick's start. Stages are timed on 1 tick in
+// STAGE_SAMPLE_EVERY, and on every tick for SLOW_CAPTURE_TICKS after a slow one, so a
+// run of slow ticks gets its breakdown without paying for it on every tick.
+static void runTick(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety) {
+    static unsigned sampleCounter, captureTicks;
+    int bytes;
+
+    if (statsEnabled) {
+        LatencyHistogram *h = threadStats->stages;
+        uint64_t t[STAGE_COUNT];
+        int timed = captureTicks > 0 || (++sampleCounter & (STAGE_SAMPLE_EVERY - 1)) == 0;
+        t[0] = tickStart ? tickStart : stageClock();
+        if (timed) {
+            simulateSensorInput(v);
+            t[1] = stageClock();
+            analyzeSensors(v, diag);
+            t[2] = stageClock();
+            checkSafety(v, safety);
+            t[3] = stageClock();
+            bytes = logHealthStatus(v, diag, safety);
+            if (captureTicks) captureTicks--;
+        } else {
+            simulateSensorInput(v);
+            analyzeSensors(v, diag);
+            checkSafety(v, safety);
+            bytes = logHealthStatus(v, diag, safety);
+        }
+        t[4] = stageClock();
+        tickStart = t[4];
+
+        if (timed) {
+            for (int s = 0; s < STAGE_TICK; s++) histogramRecord(&h[s], t[s + 1] - t[s]);
+        }
+        histogramRecord(&h[STAGE_TICK], t[4] - t[0]);
+        if (t[4] - t[0] > slowTickClocks) {
+            recordSlowTick(threadStats, t, timed);
+            captureTicks = SLOW_CAPTURE_TICKS;
+        }
+    } else {
+        simulateSensorInput(v);
+        analyzeSensors(v, diag);
+        checkSafety(v, safety);
+        bytes = logHealthStatus(v, diag, safety);
+        tickStart = 0;
+    }
+
+    if (statsEnabled) {
+        ThreadStats *t = threadStats;
+        BUMP(t->ticks, 1);
+        BUMP(t->sensorsEvaluated, 5);
+        BUMP(t->alertsRaised, (uint64_t)(safety->obstacleAlert + safety->brakeFailure + safety->tirePressureIssue));
+        BUMP(t->bytesLogged, (uint64_t)bytes);
+    }
+    if (dumpRequested) {
+        dumpRequested = 0;
+        statsDump(STDERR_FILENO, statsPage);
+        tickStart = 0;
+    }
+}
+
+// Runs 'ticks' ticks with stdout on /dev/null; returns ns per tick
+static double runQuietTicks(Vehicle *v, long ticks) {
+    DiagnosticInfo diag;
+    SafetyModule safety;
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    close(devNull);
+
+    tickStart = 0;
+    uint64_t t0 = monotonicNs();
+    for (long i = 0; i < ticks; i++) {
+        runTick(v, &diag, &safety);
+    }
+    uint64_t t1 = monotonicNs();
+
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+    return (double)(t1 - t0) / ticks;
+}
+
+// Cost of the instrumentation itself, timed in isolation: the A/B tick comparison
+// above is at the mercy of scheduler noise, this number is not
+static double instrumentationNsPerTick(void) {
+    const long loops = 1000000;
+    LatencyHistogram *scratch = calloc(1, sizeof(LatencyHistogram));
+    ThreadStats *counters = calloc(1, sizeof(ThreadStats));
+    uint64_t sink = 0;
+
+    uint64_t t0 = monotonicNs();
+    for (long i = 0; i < loops; i++) sink += stageClock();
+    uint64_t t1 = monotonicNs();
+    for (long i = 0; i < loops; i++) histogramRecord(scratch, (uint64_t)(i & 8191) + 5000);
+    uint64_t t2 = monotonicNs();
+    for (long i = 0; i < loops; i++) {
+        BUMP(counters->ticks, 1);
+        BUMP(counters->sensorsEvaluated, 5);
+        BUMP(counters->alertsRaised, (uint64_t)(i & 1));
+        BUMP(counters->bytesLogged, 228);
+    }
+    uint64_t t3 = monotonicNs();
+    __asm__ volatile("" : : "r"(sink));
+    free(scratch);
+    free(counters);
+
+    double clockNs = (double)(t1 - t0) / loops, recordNs = (double)(t2 - t1) / loops, bumpNs = (double)(t3 - t2) / loops;
+    printf("Clock read %.1f ns, histogram record %.1f ns, counters %.1f ns per tick\n", clockNs, recordNs, bumpNs);
+    return clockNs + recordNs + (3 * clockNs + 4 * recordNs) / STAGE_SAMPLE_EVERY + bumpNs;
+}
+
+// Main
+int main(int argc, char *argv[]) {
+    if (argc > 1 && strcmp(argv[1], "--read") == 0) return readLiveStats();
+    long ticks = argc > 1 ? atol(argv[1]) : 200000;
+
+    srand(time(NULL));
+    if (statsOpen() != 0 || statsRegisterThread() == NULL) return 1;
+    signal(SIGUSR1, onDumpSignal);
+
+    Vehicle v;
+    DiagnosticInfo diag;
+    SafetyModule safety;
+    initializeVehicle(&v, "VH700");
+
+    // One visible tick, then the loop runs quietly (no sleep) so the numbers mean something
+    runTick(&v, &diag, &safety);
+    printf("\nStats page %s (clock %.3f ticks/ns, slow tick over %llu ns). While running: kill -USR1 %d, or ./a.out --read\n",
+           STATS_SHM_NAME, statsPage->ticksPerNs, (unsigned long long)statsPage->slowTickNs, getpid());
+
+    // Overhead: alternate short plain and instrumented runs and keep the best of each,
+    // so scheduler noise (easily 10% between identical runs in a VM) cancels out
+    double onNs = 1e18, offNs = 1e18;
+    long roundTicks = ticks / 32 > 0 ? ticks / 32 : 1;
+    for (int round = 0; round < 16; round++) {
+        statsEnabled = 0;
+        double off = runQuietTicks(&v, roundTicks);
+        statsEnabled = 1;
+        double on = runQuietTicks(&v, roundTicks);
+        if (off < offNs) offNs = off;
+        if (on < onNs) onNs = on;
+    }
+    printf("Tick (best of 16 runs): %.1f ns without stats, %.1f ns with stats -> measured overhead %.2f%%\n",
+           offNs, onNs, 100.0 * (onNs - offNs) / offNs);
+    double costNs = instrumentationNsPerTick();
+    printf("Instrumentation cost: %.1f ns per tick = %.2f%% of the tick\n\n", costNs, 100.0 * costNs / offNs);
+
+    statsDump(STDOUT_FILENO, statsPage);
+    statsClose();
+    return 0;
+}
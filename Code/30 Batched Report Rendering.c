@@ -0,0 +1,723 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/uio.h>
+
+// Build: gcc -O2 "30 Batched Report Rendering.c" -lm
+
+#define REPORT_CHUNK_BYTES (64 * 1024)   // Report buffer grows in chunks; chunks are reused every tick
+#define REPORT_MAX_CHUNKS 1024           // writev() is called with at most IOV_MAX of them at a time
+#define RECORD_MAX_BYTES 1024            // Upper bound for one vehicle's block
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024                     // Linux value; limits.h only exposes it with XOPEN
+#endif
+
+// Sensor Types (12)
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Diagnostic Info
+typedef struct {
+    float avgTemp;
+    float minVoltage;
+    int criticalSensors;
+} DiagnosticInfo;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[5];
+    int healthStatus;
+} Vehicle;
+
+// Safety Module
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+// Sensor Types (14)
+#define ALERT_SENSORS 3
+
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE
+} AlertSensorType;
+
+typedef struct {
+    AlertSensorType type;
+    float value;
+    char status[20];
+} AlertSensor;
+
+typedef struct {
+    char id[10];
+    AlertSensor sensors[ALERT_SENSORS];
+} AlertVehicle;
+
+// One tick's report: fixed-size chunks so growth never copies what is already rendered
+typedef struct {
+    char *chunks[REPORT_MAX_CHUNKS];
+    size_t used[REPORT_MAX_CHUNKS];
+    int chunkCount;        // Chunks allocated so far (kept across ticks)
+    int current;           // Chunk being filled
+    size_t bytes;          // Total rendered this tick
+} ReportBuffer;
+
+// Health signature for summary mode: bit 0 unsafe, bits 1-3 the three alerts
+typedef uint8_t HealthSignature;
+#define HEALTH_UNKNOWN 0xFF
+
+// Prototypes
+void initializeVehicle(Vehicle *v, const char *id);
+void simulateSensorInput(Vehicle *v);
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag);
+void checkSafety(Vehicle *v, SafetyModule *safety);
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety);
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount);
+void analyzeSensor(AlertSensor *sensor);
+void performDiagnostics(AlertVehicle *vehicle);
+void logAlert(AlertVehicle *vehicle, const char *message);
+void reportReset(ReportBuffer *rb);
+void reportFree(ReportBuffer *rb);
+ssize_t reportFlush(ReportBuffer *rb, int fd);
+const char *cachedCtime(time_t now);
+void renderHealthStatus(ReportBuffer *rb, const Vehicle *v, const DiagnosticInfo *diag, const SafetyModule *safety, const char *timeText);
+int renderHealthSummary(ReportBuffer *rb, const Vehicle *v, const DiagnosticInfo *diag, const SafetyModule *safety, HealthSignature *last);
+void renderDiagnostics(ReportBuffer *rb, AlertVehicle *vehicle, const char *timeText);
+
+static double elapsedNs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec);
+}
+
+// ---------------- Report Buffer ----------------
+
+void reportReset(ReportBuffer *rb) {
+    for (int i = 0; i < rb->chunkCount; i++) rb->used[i] = 0;
+    rb->current = 0;
+    rb->bytes = 0;
+}
+
+void reportFree(ReportBuffer *rb) {
+    for (int i = 0; i < rb->chunkCount; i++) free(rb->chunks[i]);
+    memset(rb, 0, sizeof(*rb));
+}
+
+// Room for 'n' bytes in the current chunk; moves to the next chunk when it does not fit
+static char *reportReserve(ReportBuffer *rb, size_t n) {
+    if (rb->chunkCount > 0 && rb->used[rb->current] + n <= REPORT_CHUNK_BYTES) {
+        return rb->chunks[rb->current] + rb->used[rb->current];
+    }
+    if (rb->chunkCount > 0) rb->current++;
+    if (rb->current == REPORT_MAX_CHUNKS) {
+        printf("Error: Report exceeds %d chunks\n", REPORT_MAX_CHUNKS);
+        exit(1);
+    }
+    if (rb->current == rb->chunkCount) {
+        rb->chunks[rb->chunkCount] = malloc(REPORT_CHUNK_BYTES);
+        if (rb->chunks[rb->chunkCount] == NULL) {
+            printf("Error: Out of memory for report\n");
+            exit(1);
+        }
+        rb->used[rb->chunkCount++] = 0;
+    }
+    return rb->chunks[rb->current];
+}
+
+static void reportCommit(ReportBuffer *rb, const char *end) {
+    size_t n = (size_t)(end - (rb->chunks[rb->current] + rb->used[rb->current]));
+    rb->used[rb->current] += n;
+    rb->bytes += n;
+}
+
+// Whole report in as few system calls as IOV_MAX allows (one for anything under 64 MB)
+ssize_t reportFlush(ReportBuffer *rb, int fd) {
+    struct iovec iov[REPORT_MAX_CHUNKS];
+    int count = 0;
+    for (int i = 0; i <= rb->current && i < rb->chunkCount; i++) {
+        if (rb->used[i] == 0) continue;
+        iov[count].iov_base = rb->chunks[i];
+        iov[count].iov_len = rb->used[i];
+        count++;
+    }
+
+    ssize_t total = 0;
+    struct iovec *next = iov;
+    while (count > 0) {
+        int batch = count < IOV_MAX ? count : IOV_MAX;
+        ssize_t n = writev(fd, next, batch);
+        if (n < 0) return -1;
+        total += n;
+        // Skip what was written; a short write resumes mid-chunk
+        while (batch > 0 && (size_t)n >= next->iov_len) {
+            n -= next->iov_len;
+            next++;
+            count--;
+            batch--;
+        }
+        if (count > 0 && n > 0) {
+            next->iov_base = (char *)next->iov_base + n;
+            next->iov_len -= n;
+        }
+    }
+    reportReset(rb);
+    return total;
+}
+
+// ---------------- Formatting ----------------
+
+static inline char *putText(char *p, const char *text, size_t len) {
+    memcpy(p, text, len);
+    return p + len;
+}
+
+#define PUT_LITERAL(p, text) putText(p, text, sizeof(text) - 1)
+
+static inline char *putString(char *p, const char *text) {
+    return putText(p, text, strlen(text));
+}
+
+static inline char *putUnsigned(char *p, uint64_t v) {
+    char digits[20];
+    int n = 0;
+    do {
+        digits[n++] = (char)('0' + v % 10);
+        v /= 10;
+    } while (v);
+    while (n) *p++ = digits[--n];
+    return p;
+}
+
+static inline char *putInt(char *p, int v) {
+    if (v < 0) {
+        *p++ = '-';
+        return putUnsigned(p, (uint64_t)(-(int64_t)v));
+    }
+    return putUnsigned(p, (uint64_t)v);
+}
+
+// Same digits as printf("%.*f", decimals, value) for a float. The float widened to
+// double and scaled by 10 or 100 is exact (24 + 7 bits < 53), so nearbyint's
+// round-half-even on it rounds exactly like glibc does on the decimal expansion.
+static char *putFixed(char *p, float value, int decimals) {
+    static const double scale[3] = {1, 10, 100};
+    double scaled = (double)value * scale[decimals];
+    if (!(fabs(scaled) < 9e15)) {
+        return p + sprintf(p, "%.*f", decimals, value);  // Inf, NaN, huge: not worth a fast path
+    }
+
+    if (signbit(value)) *p++ = '-';   // printf keeps the sign of -0.0 and of values rounding to it
+    uint64_t units = (uint64_t)nearbyint(fabs(scaled));
+    uint64_t divisor = decimals == 2 ? 100 : decimals == 1 ? 10 : 1;
+    p = putUnsigned(p, units / divisor);
+    if (decimals > 0) {
+        *p++ = '.';
+        uint64_t frac = units % divisor;
+        if (decimals == 2) *p++ = (char)('0' + frac / 10);
+        *p++ = (char)('0' + frac % 10);
+    }
+    return p;
+}
+
+// ctime() text, formatted once per second
+const char *cachedCtime(time_t now) {
+    static time_t cachedSecond = -1;
+    static char cachedText[32];
+    if (now != cachedSecond) {
+        ctime_r(&now, cachedText);
+        cachedSecond = now;
+    }
+    return cachedText;
+}
+
+// ---------------- Renderers ----------------
+
+// Full mode for 12/13: same bytes as logHealthStatus
+void renderHealthStatus(ReportBuffer *rb, const Vehicle *v, const DiagnosticInfo *diag, const SafetyModule *safety, const char *timeText) {
+    char *p = reportReserve(rb, RECORD_MAX_BYTES);
+
+    p = PUT_LITERAL(p, "\n--- Vehicle ID: ");
+    p = putString(p, v->id);
+    p = PUT_LITERAL(p, " ---\nTime: ");
+    p = putString(p, timeText);
+    p = PUT_LITERAL(p, "Temp: ");
+    p = putFixed(p, v->sensors[TEMP_SENSOR].value, 1);
+    p = PUT_LITERAL(p, " (");
+    p = putString(p, v->sensors[TEMP_SENSOR].status);
+    p = PUT_LITERAL(p, ")\nVoltage: ");
+    p = putFixed(p, v->sensors[VOLTAGE_SENSOR].value, 1);
+    p = PUT_LITERAL(p, " (");
+    p = putString(p, v->sensors[VOLTAGE_SENSOR].status);
+    p = PUT_LITERAL(p, ")\nBrake: ");
+    p = putString(p, v->sensors[BRAKE_SENSOR].status);
+    p = PUT_LITERAL(p, "\nTire Pressure: ");
+    p = putFixed(p, v->sensors[TIRE_SENSOR].value, 1);
+    p = PUT_LITERAL(p, " (");
+    p = putString(p, v->sensors[TIRE_SENSOR].status);
+    p = PUT_LITERAL(p, ")\nDistance: ");
+    p = putFixed(p, v->sensors[DISTANCE_SENSOR].value, 1);
+    p = PUT_LITERAL(p, "cm\n");
+
+    if (safety->obstacleAlert)
+        p = PUT_LITERAL(p, "!!! ALERT: Obstacle too close\n");
+    if (safety->brakeFailure)
+        p = PUT_LITERAL(p, "!!! ALERT: Brake Failure\n");
+    if (safety->tirePressureIssue)
+        p = PUT_LITERAL(p, "!!! ALERT: Tire Pressure Issue\n");
+
+    p = diag->criticalSensors > 0 ? PUT_LITERAL(p, "Health Score: UNSAFE\n") : PUT_LITERAL(p, "Health Score: SAFE\n");
+    p = PUT_LITERAL(p, "-------------------------\n");
+    reportCommit(rb, p);
+}
+
+static HealthSignature healthSignature(const DiagnosticInfo *diag, const SafetyModule *safety) {
+    return (HealthSignature)((diag->criticalSensors > 0) | (safety->obstacleAlert ? 2 : 0) |
+                             (safety->brakeFailure ? 4 : 0) | (safety->tirePressureIssue ? 8 : 0));
+}
+
+static char *putHealth(char *p, HealthSignature s) {
+    if (s == HEALTH_UNKNOWN) return PUT_LITERAL(p, "NEW");
+    p = (s & 1) ? PUT_LITERAL(p, "UNSAFE") : PUT_LITERAL(p, "SAFE");
+    if (s & 2) p = PUT_LITERAL(p, "+OBSTACLE");
+    if (s & 4) p = PUT_LITERAL(p, "+BRAKE");
+    if (s & 8) p = PUT_LITERAL(p, "+TIRE");
+    return p;
+}
+
+// Summary mode: "VH700: SAFE -> UNSAFE+BRAKE" only when the signature changed; returns 1 if emitted
+int renderHealthSummary(ReportBuffer *rb, const Vehicle *v, const DiagnosticInfo *diag, const SafetyModule *safety, HealthSignature *last) {
+    HealthSignature now = healthSignature(diag, safety);
+    if (now == *last) return 0;
+
+    char *p = reportReserve(rb, 128);
+    p = putString(p, v->id);
+    p = PUT_LITERAL(p, ": ");
+    p = putHealth(p, *last);
+    p = PUT_LITERAL(p, " -> ");
+    p = putHealth(p, now);
+    *p++ = '\n';
+    reportCommit(rb, p);
+    *last = now;
+    return 1;
+}
+
+// Full mode for 14: analyzes like performDiagnostics and renders the same bytes,
+// including logAlert's ctime() newline inside the brackets
+void renderDiagnostics(ReportBuffer *rb, AlertVehicle *vehicle, const char *timeText) {
+    char *p = reportReserve(rb, RECORD_MAX_BYTES);
+    p = PUT_LITERAL(p, "\nDiagnostics Report for Vehicle ");
+    p = putString(p, vehicle->id);
+    p = PUT_LITERAL(p, ":\n");
+
+    for (int i = 0; i < ALERT_SENSORS; i++) {
+        AlertSensor *s = &vehicle->sensors[i];
+        analyzeSensor(s);
+
+        p = PUT_LITERAL(p, "Sensor ");
+        p = putInt(p, s->type);
+        p = PUT_LITERAL(p, " | Value: ");
+        p = putFixed(p, s->value, 2);
+        p = PUT_LITERAL(p, " | Status: ");
+        p = putString(p, s->status);
+        *p++ = '\n';
+
+        if (strcmp(s->status, "Normal") != 0) {
+            p = PUT_LITERAL(p, "ALERT: [");
+            p = putString(p, timeText);
+            p = PUT_LITERAL(p, "] Vehicle ");
+            p = putString(p, vehicle->id);
+            p = PUT_LITERAL(p, " - ");
+            p = putString(p, s->status);
+            *p++ = '\n';
+        }
+    }
+    reportCommit(rb, p);
+}
+
+// ---------------- 12: Diagnostics ----------------
+
+void initializeVehicle(Vehicle *v, const char *id) {
+    strcpy(v->id, id);
+    for (int i = 0; i < 5; i++) {
+        v->sensors[i].type = i;
+        v->sensors[i].value = 0;
+        strcpy(v->sensors[i].status, "Unknown");
+    }
+    v->healthStatus = 1;
+}
+
+void simulateSensorInput(Vehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag) {
+    diag->avgTemp = 0;
+    diag->minVoltage = 99;
+    diag->criticalSensors = 0;
+
+    updateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    diag->avgTemp = v->sensors[TEMP_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    diag->minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+}
+
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+void checkSafety(Vehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+// Report timestamp: the live clock, or one fixed second while the compatibility check runs
+static time_t pinnedTime;
+
+static time_t reportNow(void) {
+    return pinnedTime ? pinnedTime : time(NULL);
+}
+
+// Reference printf version (12), kept for the compatibility check and the benchmark
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety) {
+    time_t now = reportNow();
+
+    printf("\n--- Vehicle ID: %s ---\n", v->id);
+    printf("Time: %s", ctime(&now));
+    printf("Temp: %.1f (%s)\n", v->sensors[TEMP_SENSOR].value, v->sensors[TEMP_SENSOR].status);
+    printf("Voltage: %.1f (%s)\n", v->sensors[VOLTAGE_SENSOR].value, v->sensors[VOLTAGE_SENSOR].status);
+    printf("Brake: %s\n", v->sensors[BRAKE_SENSOR].status);
+    printf("Tire Pressure: %.1f (%s)\n", v->sensors[TIRE_SENSOR].value, v->sensors[TIRE_SENSOR].status);
+    printf("Distance: %.1fcm\n", v->sensors[DISTANCE_SENSOR].value);
+
+    if (safety->obstacleAlert)
+        printf("!!! ALERT: Obstacle too close\n");
+    if (safety->brakeFailure)
+        printf("!!! ALERT: Brake Failure\n");
+    if (safety->tirePressureIssue)
+        printf("!!! ALERT: Tire Pressure Issue\n");
+
+    printf("Health Score: %s\n", diag->criticalSensors > 0 ? "UNSAFE" : "SAFE");
+    printf("-------------------------\n");
+}
+
+// ---------------- 14: Diagnostics with alerts ----------------
+
+// Analyze One Sensor
+void analyzeSensor(AlertSensor *sensor) {
+    switch (sensor->type) {
+        case ENGINE_TEMP:
+            if (sensor->value > 110)
+                strcpy(sensor->status, "Overheat");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case OIL_PRESSURE:
+            if (sensor->value < 25)
+                strcpy(sensor->status, "Low Pressure");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case BATTERY_VOLTAGE:
+            if (sensor->value < 11.5)
+                strcpy(sensor->status, "Low Battery");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+    }
+}
+
+// Reference printf version (14)
+void performDiagnostics(AlertVehicle *vehicle) {
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    for (int i = 0; i < ALERT_SENSORS; i++) {
+        analyzeSensor(&vehicle->sensors[i]);
+
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].status);
+
+        if (strcmp(vehicle->sensors[i].status, "Normal") != 0) {
+            logAlert(vehicle, vehicle->sensors[i].status);
+        }
+    }
+}
+
+// Log Alert
+void logAlert(AlertVehicle *vehicle, const char *message) {
+    time_t now = reportNow();
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+// ---------------- Checks and Benchmark ----------------
+
+// Runs fn with stdout sent to 'fd'
+static void withStdout(int fd, void (*fn)(void *), void *arg) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    dup2(fd, STDOUT_FILENO);
+    fn(arg);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+typedef struct {
+    Vehicle *vehicles;
+    DiagnosticInfo *diags;
+    SafetyModule *safeties;
+    AlertVehicle *alertVehicles;
+    int count;
+} Fleet;
+
+static void legacyHealthReport(void *arg) {
+    Fleet *f = arg;
+    for (int i = 0; i < f->count; i++) logHealthStatus(&f->vehicles[i], &f->diags[i], &f->safeties[i]);
+}
+
+static void legacyDiagnosticsReport(void *arg) {
+    Fleet *f = arg;
+    for (int i = 0; i < f->count; i++) performDiagnostics(&f->alertVehicles[i]);
+}
+
+static void batchedHealthReport(ReportBuffer *rb, Fleet *f, int fd) {
+    const char *timeText = cachedCtime(reportNow());
+    for (int i = 0; i < f->count; i++) renderHealthStatus(rb, &f->vehicles[i], &f->diags[i], &f->safeties[i], timeText);
+    reportFlush(rb, fd);
+}
+
+static void batchedDiagnosticsReport(ReportBuffer *rb, Fleet *f, int fd) {
+    const char *timeText = cachedCtime(reportNow());
+    for (int i = 0; i < f->count; i++) renderDiagnostics(rb, &f->alertVehicles[i], timeText);
+    reportFlush(rb, fd);
+}
+
+static void simulateFleet(Fleet *f) {
+    for (int i = 0; i < f->count; i++) {
+        simulateSensorInput(&f->vehicles[i]);
+        analyzeSensors(&f->vehicles[i], &f->diags[i]);
+        checkSafety(&f->vehicles[i], &f->safeties[i]);
+
+        AlertVehicle *a = &f->alertVehicles[i];
+        a->sensors[ENGINE_TEMP].value = 80 + rand() % 40;         // 80 to 120
+        a->sensors[OIL_PRESSURE].value = 20 + rand() % 40;        // 20 to 60
+        a->sensors[BATTERY_VOLTAGE].value = 11 + ((rand() % 30) / 10.0); // 11.0 to 13.9
+    }
+}
+
+static char *readFile(int fd, size_t *size) {
+    off_t end = lseek(fd, 0, SEEK_END);
+    char *data = end >= 0 ? malloc((size_t)end + 1) : NULL;
+    if (data == NULL) {
+        printf("Error: Cannot read back a %lld-byte report\n", (long long)end);
+        return NULL;
+    }
+    ssize_t n = pread(fd, data, (size_t)end, 0);
+    *size = n > 0 ? (size_t)n : 0;
+    return data;
+}
+
+// Renders both ways into temp files and compares. Both renderers read the same pinned
+// second, so a run that crosses a second boundary cannot make them differ.
+static int compareReports(Fleet *f, ReportBuffer *rb, int diagnostics) {
+    char legacyPath[] = "/tmp/report_legacy_XXXXXX", batchedPath[] = "/tmp/report_batched_XXXXXX";
+    int legacyFd = mkstemp(legacyPath);
+    int batchedFd = legacyFd >= 0 ? mkstemp(batchedPath) : -1;
+    if (batchedFd < 0) {
+        printf("Error: Cannot create temporary report files in /tmp\n");
+        if (legacyFd >= 0) {
+            unlink(legacyPath);
+            close(legacyFd);
+        }
+        return 1;
+    }
+    unlink(legacyPath);
+    unlink(batchedPath);
+
+    pinnedTime = time(NULL);
+    withStdout(legacyFd, diagnostics ? legacyDiagnosticsReport : legacyHealthReport, f);
+    if (diagnostics) batchedDiagnosticsReport(rb, f, batchedFd);
+    else batchedHealthReport(rb, f, batchedFd);
+    pinnedTime = 0;
+
+    size_t legacySize = 0, batchedSize = 0;
+    char *legacy = readFile(legacyFd, &legacySize), *batched = readFile(batchedFd, &batchedSize);
+    close(legacyFd);
+    close(batchedFd);
+    if (legacy == NULL || batched == NULL) {
+        free(legacy);
+        free(batched);
+        return 1;
+    }
+    int same = legacySize == batchedSize && memcmp(legacy, batched, legacySize) == 0;
+    free(legacy);
+    free(batched);
+    printf("%-20s full mode, %d vehicles: %zu bytes, %s\n", diagnostics ? "performDiagnostics" : "logHealthStatus",
+           f->count, legacySize, same ? "byte-identical" : "DIFFERENT");
+    return same ? 0 : 1;
+}
+
+// putFixed against printf on awkward floats: ties, negatives, tiny, huge, non-finite
+static int checkFixedFormatting(int samples) {
+    int mismatches = 0;
+    uint32_t x = 12345;
+    char fast[64], slow[64];
+    for (int i = 0; i < samples; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        float f;
+        if (i % 4 == 0) {
+            memcpy(&f, &x, sizeof(f));                       // Any bit pattern
+        } else if (i % 4 == 1) {
+            f = (float)((int)(x % 200001) - 100000) / 8.0f;  // Exact binary ties like 0.125
+        } else {
+            f = (float)((int)(x % 2000001) - 1000000) / 100.0f;
+        }
+        for (int d = 1; d <= 2; d++) {
+            *putFixed(fast, f, d) = '\0';
+            snprintf(slow, sizeof(slow), "%.*f", d, f);
+            if (strcmp(fast, slow) != 0) {
+                if (mismatches < 5) printf("Mismatch: %s vs %s\n", fast, slow);
+                mismatches++;
+            }
+        }
+    }
+    printf("Fixed-point formatter: %d values x 2 precisions, %d mismatches against printf\n", samples, mismatches);
+    return mismatches;
+}
+
+int main() {
+    srand(time(NULL));
+    ReportBuffer rb;
+    memset(&rb, 0, sizeof(rb));
+
+    // A small fleet through all three modes
+    Fleet f;
+    f.count = 3;
+    f.vehicles = calloc(f.count, sizeof(Vehicle));
+    f.diags = calloc(f.count, sizeof(DiagnosticInfo));
+    f.safeties = calloc(f.count, sizeof(SafetyModule));
+    f.alertVehicles = calloc(f.count, sizeof(AlertVehicle));
+    HealthSignature *last = malloc(f.count);
+    memset(last, HEALTH_UNKNOWN, f.count);
+    for (int i = 0; i < f.count; i++) {
+        char id[10];
+        snprintf(id, sizeof(id), "VH%u", (unsigned)(700 + i) % 10000000U);
+        initializeVehicle(&f.vehicles[i], id);
+        snprintf(f.alertVehicles[i].id, sizeof(f.alertVehicles[i].id), "V%u", (unsigned)(101 + i) % 10000000U);
+        for (int s = 0; s < ALERT_SENSORS; s++) f.alertVehicles[i].sensors[s] = (AlertSensor){s, 0, "Normal"};
+    }
+
+    simulateFleet(&f);
+    batchedHealthReport(&rb, &f, STDOUT_FILENO);
+    batchedDiagnosticsReport(&rb, &f, STDOUT_FILENO);
+    printf("\n---- Summary mode, 5 ticks ----\n");
+    fflush(stdout);
+    for (int tick = 0; tick < 5; tick++) {
+        simulateFleet(&f);
+        for (int i = 0; i < f.count; i++) renderHealthSummary(&rb, &f.vehicles[i], &f.diags[i], &f.safeties[i], &last[i]);
+        reportFlush(&rb, STDOUT_FILENO);
+    }
+    free(last);
+
+    // Compatibility checks
+    printf("\n---- Compatibility ----\n");
+    int failures = checkFixedFormatting(1000000);
+    free(f.vehicles); free(f.diags); free(f.safeties); free(f.alertVehicles);
+
+    f.count = 100000;
+    f.vehicles = calloc(f.count, sizeof(Vehicle));
+    f.diags = calloc(f.count, sizeof(DiagnosticInfo));
+    f.safeties = calloc(f.count, sizeof(SafetyModule));
+    f.alertVehicles = calloc(f.count, sizeof(AlertVehicle));
+    last = malloc(f.count);
+    memset(last, HEALTH_UNKNOWN, f.count);
+    for (int i = 0; i < f.count; i++) {
+        char id[10];
+        snprintf(id, sizeof(id), "VH%u", (unsigned)i % 10000000U);
+        initializeVehicle(&f.vehicles[i], id);
+        snprintf(f.alertVehicles[i].id, sizeof(f.alertVehicles[i].id), "V%u", (unsigned)i % 10000000U);
+        for (int s = 0; s < ALERT_SENSORS; s++) f.alertVehicles[i].sensors[s] = (AlertSensor){s, 0, "Normal"};
+    }
+    simulateFleet(&f);
+    failures += compareReports(&f, &rb, 0);
+    failures += compareReports(&f, &rb, 1);
+
+    // Throughput to /dev/null, one tick = the whole fleet
+    printf("\n---- One Tick, %d Vehicles, to /dev/null ----\n", f.count);
+    int devNull = open("/dev/null", O_WRONLY);
+    struct timespec t0, t1;
+    for (int diagnostics = 0; diagnostics < 2; diagnostics++) {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        withStdout(devNull, diagnostics ? legacyDiagnosticsReport : legacyHealthReport, &f);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double legacyNs = elapsedNs(t0, t1);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (diagnostics) batchedDiagnosticsReport(&rb, &f, devNull);
+        else batchedHealthReport(&rb, &f, devNull);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double batchedNs = elapsedNs(t0, t1);
+
+        printf("%-20s printf %7.1f ns/vehicle | batched %6.1f ns/vehicle | %.1fx\n",
+               diagnostics ? "performDiagnostics" : "logHealthStatus",
+               legacyNs / f.count, batchedNs / f.count, legacyNs / batchedNs);
+    }
+
+    // Summary mode: first tick reports everyone as NEW, later ticks only changes
+    for (int i = 0; i < f.count; i++) renderHealthSummary(&rb, &f.vehicles[i], &f.diags[i], &f.safeties[i], &last[i]);
+    reportFlush(&rb, devNull);
+    simulateFleet(&f);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int changed = 0;
+    for (int i = 0; i < f.count; i++) changed += renderHealthSummary(&rb, &f.vehicles[i], &f.diags[i], &f.safeties[i], &last[i]);
+    size_t summaryBytes = rb.bytes;
+    reportFlush(&rb, devNull);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("%-20s summary %6.1f ns/vehicle | %d of %d vehicles changed, %zu bytes\n", "logHealthStatus",
+           elapsedNs(t0, t1) / f.count, changed, f.count, summaryBytes);
+    close(devNull);
+
+    free(last);
+    free(f.vehicles); free(f.diags); free(f.safeties); free(f.alertVehicles);
+    reportFree(&rb);
+    return failures ? 1 : 0;
+}
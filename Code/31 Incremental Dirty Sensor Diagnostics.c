@@ -0,0 +1,554 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+// Build: gcc -O2 "31 Incremental Dirty Sensor Diagnostics.c" -lm
+
+#define SENSOR_COUNT 5
+#define ALERT_SENSORS 3
+#define FULL_SCAN_PER_MILLE 900   // Dirty vehicles (per mille) from which a plain full scan is used
+#define CRITICAL_MASK 0x0F   // Temp, voltage, brake and tire count towards criticalSensors (as in 12)
+
+// Sensor Types
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Diagnostic Info
+typedef struct {
+    float avgTemp;
+    float minVoltage;
+    int criticalSensors;
+} DiagnosticInfo;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[SENSOR_COUNT];
+    int healthStatus;
+} Vehicle;
+
+// Safety Module
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+// Warning when value < threshold (12's rule). Once warning, the sensor only returns
+// to OK at threshold + hysteresis. Moves smaller than deadband that do not change
+// the status are stored but not re-analyzed. Zero for both gives 12's exact behaviour.
+typedef struct {
+    float threshold;
+    float hysteresis;
+    float deadband;
+    char okMessage[16];        // Fixed size so a status update is one 16-byte copy
+    char warnMessage[16];      // Empty: no status text (distance only feeds checkSafety)
+} SensorRule;
+
+static const SensorRule defaultRules[SENSOR_COUNT] = {
+    {100, 2.0f, 0.5f, "OK", "OVERHEAT"},
+    {12.0f, 0.2f, 0.05f, "OK", "LOW VOLTAGE"},
+    {1, 0, 0, "OK", "BRAKE FAIL"},
+    {30, 1.0f, 0.5f, "OK", "LOW PRESSURE"},
+    {20, 2.0f, 1.0f, "", ""},
+};
+
+static const SensorRule exactRules[SENSOR_COUNT] = {
+    {100, 0, 0, "OK", "OVERHEAT"},
+    {12.0f, 0, 0, "OK", "LOW VOLTAGE"},
+    {1, 0, 0, "OK", "BRAKE FAIL"},
+    {30, 0, 0, "OK", "LOW PRESSURE"},
+    {20, 0, 0, "", ""},
+};
+
+// Per-vehicle health kept up to date incrementally. Everything the analyzer writes
+// is in this one cache line, so a dirty vehicle costs two lines (this + its sensors).
+typedef struct {
+    _Alignas(64) float analyzed[SENSOR_COUNT];   // Value the current status/diag was computed from
+    uint8_t warnMask;               // Bit per sensor: currently in warning
+    uint8_t dirtyMask;              // Bit per sensor: needs re-analysis
+    uint8_t statusValid;            // Bit per sensor: status text matches warnMask
+    DiagnosticInfo diag;
+    SafetyModule safety;
+} VehicleHealth;
+
+// Sensor store: vehicles plus dirty tracking at two levels (sensor bits per vehicle,
+// vehicle bits per fleet) so a clean fleet costs one word test per 64 vehicles
+typedef struct {
+    Vehicle *vehicles;
+    VehicleHealth *health;
+    uint64_t *dirtyVehicles;
+    int count;
+    int dirtyCount;                 // Vehicles with their fleet bit set
+    int fullScanPerMille;           // Dirty share at which a plain full scan is cheaper
+    const SensorRule *rules;
+    long sensorsAnalyzed;
+    long fullScans;
+} SensorStore;
+
+// 14's vehicle with the same dirty bits
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE
+} AlertSensorType;
+
+typedef struct {
+    AlertSensorType type;
+    float value;
+    char status[20];
+} AlertSensor;
+
+typedef struct {
+    char id[10];
+    AlertSensor sensors[ALERT_SENSORS];
+    uint8_t dirtyMask;
+} AlertVehicle;
+
+// Prototypes
+int storeInit(SensorStore *store, int count, const SensorRule *rules);
+void storeFree(SensorStore *store);
+void setSensorValue(SensorStore *store, int vehicle, SensorType type, float value);
+void simulateSensorInput(SensorStore *store, int vehicle);
+void analyzeDirtySensors(SensorStore *store);
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag);
+void checkSafety(Vehicle *v, SafetyModule *safety);
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount);
+void updateSensorData(AlertVehicle *vehicle);
+void analyzeSensor(AlertSensor *sensor);
+void performDiagnosticsIncremental(AlertVehicle *vehicle);
+void logAlert(AlertVehicle *vehicle, const char *message);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ---------------- Sensor Store ----------------
+
+int storeInit(SensorStore *store, int count, const SensorRule *rules) {
+    memset(store, 0, sizeof(*store));
+    store->count = count;
+    store->rules = rules;
+    store->vehicles = calloc(count, sizeof(Vehicle));
+    store->health = aligned_alloc(64, sizeof(VehicleHealth) * count);
+    store->dirtyVehicles = calloc((count + 63) / 64, sizeof(uint64_t));
+    if (!store->vehicles || !store->health || !store->dirtyVehicles) {
+        printf("Error: Cannot allocate sensor store for %d vehicles\n", count);
+        storeFree(store);
+        return -1;
+    }
+
+    // initializeVehicle from 12; every sensor starts dirty so the first pass analyzes all
+    for (int i = 0; i < count; i++) {
+        Vehicle *v = &store->vehicles[i];
+        snprintf(v->id, sizeof(v->id), "VH%u", (unsigned)(700 + i) % 10000000U);
+        for (int s = 0; s < SENSOR_COUNT; s++) {
+            v->sensors[s].type = s;
+            v->sensors[s].value = 0;
+            strcpy(v->sensors[s].status, "Unknown");
+        }
+        v->healthStatus = 1;
+
+        VehicleHealth *h = &store->health[i];
+        memset(h, 0, sizeof(*h));
+        for (int s = 0; s < SENSOR_COUNT; s++) h->analyzed[s] = NAN;
+        h->dirtyMask = (1 << SENSOR_COUNT) - 1;
+        store->dirtyVehicles[i / 64] |= 1ULL << (i % 64);
+    }
+    store->dirtyCount = count;
+    store->fullScanPerMille = FULL_SCAN_PER_MILLE;
+    return 0;
+}
+
+void storeFree(SensorStore *store) {
+    free(store->vehicles);
+    free(store->health);
+    free(store->dirtyVehicles);
+    memset(store, 0, sizeof(*store));
+}
+
+static inline int nextWarnState(const SensorRule *rule, int warning, float value) {
+    return warning ? value < rule->threshold + rule->hysteresis : value < rule->threshold;
+}
+
+// The only way writers change a reading. Marks the sensor dirty when the value moved
+// by at least the deadband or the move flips its warning state.
+void setSensorValue(SensorStore *store, int vehicle, SensorType type, float value) {
+    Sensor *s = &store->vehicles[vehicle].sensors[type];
+    if (value == s->value) return;
+    s->value = value;
+
+    VehicleHealth *st = &store->health[vehicle];
+    const SensorRule *rule = &store->rules[type];
+    int warning = (st->warnMask >> type) & 1;
+    if (nextWarnState(rule, warning, value) != warning || !(fabsf(value - st->analyzed[type]) < rule->deadband)) {
+        st->dirtyMask |= 1 << type;
+        uint64_t *word = &store->dirtyVehicles[vehicle / 64], bit = 1ULL << (vehicle % 64);
+        if (!(*word & bit)) {
+            *word |= bit;
+            store->dirtyCount++;
+        }
+    }
+}
+
+// Same value ranges as 12, written through the store
+void simulateSensorInput(SensorStore *store, int vehicle) {
+    setSensorValue(store, vehicle, TEMP_SENSOR, 75 + rand() % 50);      // 75-125
+    setSensorValue(store, vehicle, VOLTAGE_SENSOR, 11.5 + (rand() % 20) / 10.0);  // 11.5–13.5
+    setSensorValue(store, vehicle, BRAKE_SENSOR, rand() % 2);
+    setSensorValue(store, vehicle, TIRE_SENSOR, 28 + rand() % 10);      // 28–38
+    setSensorValue(store, vehicle, DISTANCE_SENSOR, rand() % 100);      // 0–100 cm
+}
+
+// Re-analyze only dirty sensors of dirty vehicles; health and safety are updated from
+// the warning bits instead of being rebuilt, and status text is copied only on a flip
+static void analyzeVehicle(SensorStore *store, int i) {
+    Vehicle *v = &store->vehicles[i];
+    VehicleHealth *st = &store->health[i];
+    uint8_t dirty = st->dirtyMask;
+
+    while (dirty) {
+        int t = __builtin_ctz(dirty);
+        dirty &= dirty - 1;
+        const SensorRule *rule = &store->rules[t];
+        Sensor *s = &v->sensors[t];
+        int warning = (st->warnMask >> t) & 1;
+        int next = nextWarnState(rule, warning, s->value);
+
+        if (rule->warnMessage[0] && (next != warning || !(st->statusValid & (1 << t)))) {
+            memcpy(s->status, next ? rule->warnMessage : rule->okMessage, sizeof(rule->okMessage));
+            st->statusValid |= 1 << t;
+        }
+        st->warnMask = (uint8_t)((st->warnMask & ~(1 << t)) | (next << t));
+        st->analyzed[t] = s->value;
+        store->sensorsAnalyzed++;
+    }
+
+    DiagnosticInfo *diag = &st->diag;
+    diag->avgTemp = st->analyzed[TEMP_SENSOR];
+    diag->minVoltage = st->analyzed[VOLTAGE_SENSOR];
+    diag->criticalSensors = __builtin_popcount(st->warnMask & CRITICAL_MASK);
+
+    SafetyModule *safety = &st->safety;
+    safety->obstacleAlert = (st->warnMask >> DISTANCE_SENSOR) & 1;
+    safety->brakeFailure = (st->warnMask >> BRAKE_SENSOR) & 1;
+    safety->tirePressureIssue = (st->warnMask >> TIRE_SENSOR) & 1;
+    st->dirtyMask = 0;
+}
+
+// Fallback when most vehicles are dirty: every sensor in store order, no bit scanning.
+// Same results as analyzeVehicle on a fully dirty vehicle.
+static void analyzeAllSensors(SensorStore *store) {
+    for (int i = 0; i < store->count; i++) {
+        Vehicle *v = &store->vehicles[i];
+        VehicleHealth *st = &store->health[i];
+        uint8_t warnMask = 0;
+        for (int t = 0; t < SENSOR_COUNT; t++) {
+            const SensorRule *rule = &store->rules[t];
+            float value = v->sensors[t].value;
+            int warning = (st->warnMask >> t) & 1;
+            int next = value < rule->threshold + (float)warning * rule->hysteresis;  // nextWarnState, branch-free
+            // Unconditional like 12's pass: a 16-byte copy is cheaper than a mispredicted flip test
+            if (rule->warnMessage[0]) memcpy(v->sensors[t].status, next ? rule->warnMessage : rule->okMessage, sizeof(rule->okMessage));
+            warnMask |= (uint8_t)(next << t);
+            st->analyzed[t] = value;
+        }
+        st->warnMask = warnMask;
+        st->dirtyMask = 0;
+        st->statusValid = (1 << SENSOR_COUNT) - 1;
+
+        st->diag.avgTemp = st->analyzed[TEMP_SENSOR];
+        st->diag.minVoltage = st->analyzed[VOLTAGE_SENSOR];
+        st->diag.criticalSensors = __builtin_popcount(warnMask & CRITICAL_MASK);
+        st->safety.obstacleAlert = (warnMask >> DISTANCE_SENSOR) & 1;
+        st->safety.brakeFailure = (warnMask >> BRAKE_SENSOR) & 1;
+        st->safety.tirePressureIssue = (warnMask >> TIRE_SENSOR) & 1;
+    }
+    store->sensorsAnalyzed += (long)store->count * SENSOR_COUNT;
+    memset(store->dirtyVehicles, 0, sizeof(uint64_t) * ((store->count + 63) / 64));
+}
+
+void analyzeDirtySensors(SensorStore *store) {
+    int words = (store->count + 63) / 64;
+    if ((long)store->dirtyCount * 1000 >= (long)store->count * store->fullScanPerMille) {
+        store->fullScans++;
+        store->dirtyCount = 0;
+        analyzeAllSensors(store);
+        return;
+    }
+    store->dirtyCount = 0;
+    for (int w = 0; w < words; w++) {
+        uint64_t bits = store->dirtyVehicles[w];
+        if (bits == 0) continue;
+        store->dirtyVehicles[w] = 0;
+        while (bits) {
+            analyzeVehicle(store, w * 64 + __builtin_ctzll(bits));
+            bits &= bits - 1;
+        }
+    }
+}
+
+// ---------------- Full pass (12), the reference ----------------
+
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag) {
+    diag->avgTemp = 0;
+    diag->minVoltage = 99;
+    diag->criticalSensors = 0;
+
+    updateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    diag->avgTemp = v->sensors[TEMP_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    diag->minVoltage = v->sensors[VOLTAGE_SENSOR].value;
+
+    updateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+}
+
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+void checkSafety(Vehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+// ---------------- 14: Diagnostics with alerts ----------------
+
+// Update Sensor Data (Simulation); marks only readings that actually changed
+void updateSensorData(AlertVehicle *vehicle) {
+    float next[ALERT_SENSORS] = {
+        80 + rand() % 40,                  // 80 to 120
+        20 + rand() % 40,                  // 20 to 60
+        11 + ((rand() % 30) / 10.0)        // 11.0 to 13.9
+    };
+    for (int i = 0; i < ALERT_SENSORS; i++) {
+        if (vehicle->sensors[i].value != next[i]) {
+            vehicle->sensors[i].value = next[i];
+            vehicle->dirtyMask |= 1 << i;
+        }
+    }
+}
+
+// Analyze One Sensor
+void analyzeSensor(AlertSensor *sensor) {
+    switch (sensor->type) {
+        case ENGINE_TEMP:
+            if (sensor->value > 110)
+                strcpy(sensor->status, "Overheat");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case OIL_PRESSURE:
+            if (sensor->value < 25)
+                strcpy(sensor->status, "Low Pressure");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+
+        case BATTERY_VOLTAGE:
+            if (sensor->value < 11.5)
+                strcpy(sensor->status, "Low Battery");
+            else
+                strcpy(sensor->status, "Normal");
+            break;
+    }
+}
+
+// Like performDiagnostics, but only dirty sensors are analyzed and reported;
+// a vehicle with nothing dirty prints nothing
+void performDiagnosticsIncremental(AlertVehicle *vehicle) {
+    if (vehicle->dirtyMask == 0) return;
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    for (int i = 0; i < ALERT_SENSORS; i++) {
+        if (!(vehicle->dirtyMask & (1 << i))) continue;
+        analyzeSensor(&vehicle->sensors[i]);
+
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].status);
+
+        if (strcmp(vehicle->sensors[i].status, "Normal") != 0) {
+            logAlert(vehicle, vehicle->sensors[i].status);
+        }
+    }
+    vehicle->dirtyMask = 0;
+}
+
+// Log Alert
+void logAlert(AlertVehicle *vehicle, const char *message) {
+    time_t now;
+    time(&now);
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+// ---------------- Workloads and Checks ----------------
+
+// Steady-state fleet: each tick only 'perMille' of the sensors get a new reading,
+// and most new readings are small moves around the current value
+static long steadyTick(SensorStore *store, int perMille) {
+    long changes = (long)store->count * SENSOR_COUNT * perMille / 1000;
+    for (long c = 0; c < changes; c++) {
+        int vehicle = (int)(((uint64_t)rand() << 16 ^ (uint64_t)rand()) % store->count);
+        SensorType type = (SensorType)(rand() % SENSOR_COUNT);
+        float value = store->vehicles[vehicle].sensors[type].value;
+        switch (type) {
+            case TEMP_SENSOR: value += (rand() % 3) - 1; break;
+            case VOLTAGE_SENSOR: value += ((rand() % 3) - 1) / 10.0f; break;
+            case BRAKE_SENSOR: value = rand() % 2; break;
+            case TIRE_SENSOR: value += ((rand() % 3) - 1) / 2.0f; break;
+            case DISTANCE_SENSOR: value = rand() % 100; break;
+        }
+        setSensorValue(store, vehicle, type, value);
+    }
+    return changes;
+}
+
+static void fullPass(SensorStore *store) {
+    for (int i = 0; i < store->count; i++) {
+        analyzeSensors(&store->vehicles[i], &store->health[i].diag);
+        checkSafety(&store->vehicles[i], &store->health[i].safety);
+    }
+}
+
+// With exact rules the incremental result must equal a full 12 pass on a copy
+static int compareWithFullPass(SensorStore *store) {
+    int mismatches = 0;
+    for (int i = 0; i < store->count; i++) {
+        Vehicle copy = store->vehicles[i];
+        DiagnosticInfo diag;
+        SafetyModule safety;
+        analyzeSensors(&copy, &diag);
+        checkSafety(&copy, &safety);
+
+        const DiagnosticInfo *d = &store->health[i].diag;
+        const SafetyModule *s = &store->health[i].safety;
+        if (diag.avgTemp != d->avgTemp || diag.minVoltage != d->minVoltage || diag.criticalSensors != d->criticalSensors ||
+            safety.obstacleAlert != s->obstacleAlert || safety.brakeFailure != s->brakeFailure ||
+            safety.tirePressureIssue != s->tirePressureIssue) {
+            mismatches++;
+            continue;
+        }
+        for (int t = 0; t < DISTANCE_SENSOR; t++) {
+            if (strcmp(copy.sensors[t].status, store->vehicles[i].sensors[t].status) != 0) {
+                mismatches++;
+                break;
+            }
+        }
+    }
+    return mismatches;
+}
+
+int main() {
+    srand(time(NULL));
+
+    // 14: two vehicles, only changed sensors are re-analyzed and reported
+    AlertVehicle fleet14[2];
+    for (int i = 0; i < 2; i++) {
+        snprintf(fleet14[i].id, sizeof(fleet14[i].id), "V%d", 101 + i);
+        fleet14[i].sensors[ENGINE_TEMP] = (AlertSensor){ENGINE_TEMP, 90.0, "Normal"};
+        fleet14[i].sensors[OIL_PRESSURE] = (AlertSensor){OIL_PRESSURE, 40.0, "Normal"};
+        fleet14[i].sensors[BATTERY_VOLTAGE] = (AlertSensor){BATTERY_VOLTAGE, 12.6, "Normal"};
+        fleet14[i].dirtyMask = 0;
+    }
+    for (int i = 0; i < 2; i++) {
+        updateSensorData(&fleet14[i]);
+        performDiagnosticsIncremental(&fleet14[i]);
+    }
+    fleet14[0].sensors[OIL_PRESSURE].value = 21;   // One reading changes: one line is reported
+    fleet14[0].dirtyMask |= 1 << OIL_PRESSURE;
+    for (int i = 0; i < 2; i++) performDiagnosticsIncremental(&fleet14[i]);
+
+    // Correctness: exact rules, incremental vs full pass after every tick
+    printf("\n---- Incremental vs Full Pass (exact rules) ----\n");
+    SensorStore store;
+    if (storeInit(&store, 100000, exactRules) != 0) return 1;
+    for (int i = 0; i < store.count; i++) simulateSensorInput(&store, i);
+    analyzeDirtySensors(&store);
+    int mismatches = compareWithFullPass(&store);
+    for (int tick = 0; tick < 20; tick++) {
+        steadyTick(&store, tick % 5 == 0 ? 200 : 10);
+        analyzeDirtySensors(&store);
+        mismatches += compareWithFullPass(&store);
+    }
+    printf("100000 vehicles, 21 ticks: %d mismatches\n", mismatches);
+    storeFree(&store);
+
+    // Throughput: 1M vehicles at several change rates, hysteresis rules
+    printf("\n---- Per-Tick Analysis, 1M Vehicles ----\n");
+    if (storeInit(&store, 1000000, defaultRules) != 0) return 1;
+    for (int i = 0; i < store.count; i++) simulateSensorInput(&store, i);
+    analyzeDirtySensors(&store);
+
+    struct timespec t0, t1;
+    const int ticks = 10;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) fullPass(&store);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double fullMs = elapsedMs(t0, t1) / ticks;
+    printf("Full pass (12)              : %8.2f ms/tick\n", fullMs);
+
+    // Each write rate with the incremental path forced, the full scan forced, and the
+    // default threshold choosing between them
+    int rates[] = {1, 10, 30, 100, 200, 300, 500, 1000};
+    int nRates = (int)(sizeof(rates) / sizeof(rates[0]));
+    int modes[] = {1001, 0, FULL_SCAN_PER_MILLE};
+    double crossoverShare = -1;
+    for (int r = 0; r < nRates; r++) {
+        double analyzeMs[3], dirtyShare = 0;
+        for (int m = 0; m < 3; m++) {
+            store.fullScanPerMille = modes[m];
+            analyzeMs[m] = 0;
+            long dirty = 0;
+            for (int tick = 0; tick < ticks; tick++) {
+                if (rates[r] == 1000) {
+                    for (int i = 0; i < store.count; i++) simulateSensorInput(&store, i);
+                } else {
+                    steadyTick(&store, rates[r]);
+                }
+                dirty += store.dirtyCount;
+                clock_gettime(CLOCK_MONOTONIC, &t0);
+                analyzeDirtySensors(&store);
+                clock_gettime(CLOCK_MONOTONIC, &t1);
+                analyzeMs[m] += elapsedMs(t0, t1) / ticks;
+            }
+            dirtyShare += 100.0 * dirty / ticks / store.count / 3;
+        }
+        if (crossoverShare < 0 && analyzeMs[0] > analyzeMs[1]) crossoverShare = dirtyShare;
+        printf("%5.1f%% written, %5.1f%% vehicles dirty: incremental %7.2f | full scan %7.2f | chosen %7.2f ms/tick (%s)\n",
+               rates[r] / 10.0, dirtyShare, analyzeMs[0], analyzeMs[1], analyzeMs[2],
+               dirtyShare * 10 >= FULL_SCAN_PER_MILLE ? "full scan" : "incremental");
+    }
+    if (crossoverShare >= 0) {
+        printf("Crossover: full scan wins from about %.0f%% dirty vehicles (threshold %d%%)\n", crossoverShare,
+               FULL_SCAN_PER_MILLE / 10);
+    } else {
+        printf("Crossover: incremental won at every rate (threshold %d%%)\n", FULL_SCAN_PER_MILLE / 10);
+    }
+    storeFree(&store);
+    return mismatches ? 1 : 0;
+}
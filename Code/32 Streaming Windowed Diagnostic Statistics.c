@@ -0,0 +1,653 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <unistd.h>
+#include <pthread.h>
+
+// Build: gcc -O2 -pthread "32 Streaming Windowed Diagnostic Statistics.c" -lm
+// Usage: ./a.out [vehicles] [window samples] [ewma half-life samples] [threads]
+
+#define SENSOR_COUNT 5
+#define MAX_WINDOW 65535        // Ring positions are stored as uint16_t
+#define MAX_THREADS 64
+
+// Sensor Types
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+static const char *sensorNames[SENSOR_COUNT] = {"Temp", "Voltage", "Brake", "Tire", "Distance"};
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Diagnostic Info: avgTemp and minVoltage now cover the configured window
+// instead of repeating the latest reading
+typedef struct {
+    float avgTemp;          // Window mean
+    float minVoltage;       // Window minimum
+    float maxTemp;          // Window maximum
+    float tempEwma;         // Exponentially weighted, reacts faster than the window mean
+    float voltageStdDev;    // Lifetime (Welford)
+    int criticalSensors;
+} DiagnosticInfo;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[SENSOR_COUNT];
+    int healthStatus;
+} Vehicle;
+
+// Safety Module
+typedef struct {
+    int obstacleAlert;
+    int brakeFailure;
+    int tirePressureIssue;
+} SafetyModule;
+
+// ---------------- Streaming Statistics ----------------
+
+// Chosen once for the whole pool; every stream gets the same fixed footprint
+typedef struct {
+    int window;             // Samples in the sliding window (1..MAX_WINDOW)
+    float ewmaAlpha;        // Weight of the newest sample
+} StatsConfig;
+
+// Per vehicle/sensor aggregates, all O(1) amortized per sample. The header is
+// followed in memory by float samples[window] and the min/max deques, each
+// uint16_t[window] holding ring positions in age order.
+typedef struct {
+    double windowSum;       // Double sum of float samples does not drift at sensor ranges
+    double mean;            // Welford running mean and sum of squared deviations
+    double m2;
+    uint64_t count;
+    float ewma;
+    uint16_t head;          // Ring position the next sample goes to
+    uint16_t filled;        // Samples currently in the window
+    uint16_t minFront, minLen;
+    uint16_t maxFront, maxLen;
+} StreamStats;
+
+typedef struct {
+    StatsConfig config;
+    size_t stride;          // Bytes per stream: header + ring + both deques
+    int vehicles;
+    unsigned char *slab;    // vehicles * SENSOR_COUNT streams, one allocation
+} StatsPool;
+
+// What callers read back from a stream
+typedef struct {
+    float ewma;
+    float windowMean;
+    float windowMin;
+    float windowMax;
+    float stdDev;
+    uint64_t samples;
+} SensorSummary;
+
+// Fleet-wide aggregate of one sensor type; mergeable so threads can roll up chunks
+typedef struct {
+    uint64_t samples;
+    double mean;
+    double m2;
+    float min;              // Over the current windows
+    float max;
+    double ewmaSum;
+    double windowMeanSum;
+    int streams;
+} SensorRollup;
+
+typedef struct {
+    SensorRollup sensor[SENSOR_COUNT];
+} FleetRollup;
+
+// Prototypes
+int statsPoolInit(StatsPool *pool, int vehicles, StatsConfig config);
+void statsPoolFree(StatsPool *pool);
+void streamPush(const StatsPool *pool, StreamStats *st, float x);
+void summarizeStream(const StatsPool *pool, const StreamStats *st, SensorSummary *out);
+void rollupFleet(const StatsPool *pool, int threads, FleetRollup *out);
+void initializeVehicle(Vehicle *v, const char *id);
+void simulateSensorInput(Vehicle *v);
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag, const StatsPool *pool, int vehicle);
+void checkSafety(Vehicle *v, SafetyModule *safety);
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety);
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+static inline StreamStats *streamAt(const StatsPool *pool, int vehicle, SensorType type) {
+    return (StreamStats *)(pool->slab + ((size_t)vehicle * SENSOR_COUNT + type) * pool->stride);
+}
+
+static inline float *streamRing(StreamStats *st) {
+    return (float *)(st + 1);
+}
+
+static inline uint16_t *streamMinQ(const StatsPool *pool, StreamStats *st) {
+    return (uint16_t *)(streamRing(st) + pool->config.window);
+}
+
+static inline uint16_t *streamMaxQ(const StatsPool *pool, StreamStats *st) {
+    return streamMinQ(pool, st) + pool->config.window;
+}
+
+// Alpha for an EWMA whose weight halves every halfLife samples
+static float ewmaAlphaForHalfLife(double halfLife) {
+    return (float)(1.0 - exp2(-1.0 / halfLife));
+}
+
+static size_t streamStride(int window) {
+    size_t bytes = sizeof(StreamStats) + (size_t)window * (sizeof(float) + 2 * sizeof(uint16_t));
+    return (bytes + 7) & ~(size_t)7;
+}
+
+int statsPoolInit(StatsPool *pool, int vehicles, StatsConfig config) {
+    memset(pool, 0, sizeof(*pool));
+    if (config.window < 1 || config.window > MAX_WINDOW) {
+        printf("Error: Window must be 1..%d samples (got %d)\n", MAX_WINDOW, config.window);
+        return -1;
+    }
+    if (!(config.ewmaAlpha > 0 && config.ewmaAlpha <= 1)) {
+        printf("Error: EWMA alpha must be in (0, 1] (got %g)\n", config.ewmaAlpha);
+        return -1;
+    }
+
+    pool->config = config;
+    pool->stride = streamStride(config.window);
+    pool->vehicles = vehicles;
+    // Zeroed header is an empty stream; ring and deque contents are only read once written
+    pool->slab = calloc((size_t)vehicles * SENSOR_COUNT, pool->stride);
+    if (!pool->slab) {
+        printf("Error: Cannot allocate %zu bytes of sensor statistics\n",
+               (size_t)vehicles * SENSOR_COUNT * pool->stride);
+        return -1;
+    }
+    return 0;
+}
+
+void statsPoolFree(StatsPool *pool) {
+    free(pool->slab);
+    memset(pool, 0, sizeof(*pool));
+}
+
+void streamPush(const StatsPool *pool, StreamStats *st, float x) {
+    int w = pool->config.window;
+    float *ring = streamRing(st);
+    uint16_t *minQ = streamMinQ(pool, st);
+    uint16_t *maxQ = streamMaxQ(pool, st);
+    uint16_t pos = st->head;
+
+    if (st->filled == w) {
+        // Evict the oldest sample; if a deque still holds it, it is at the front
+        st->windowSum -= ring[pos];
+        if (st->minLen && minQ[st->minFront] == pos) {
+            st->minFront = st->minFront + 1 == w ? 0 : st->minFront + 1;
+            st->minLen--;
+        }
+        if (st->maxLen && maxQ[st->maxFront] == pos) {
+            st->maxFront = st->maxFront + 1 == w ? 0 : st->maxFront + 1;
+            st->maxLen--;
+        }
+    } else {
+        st->filled++;
+    }
+    ring[pos] = x;
+    st->windowSum += x;
+
+    // Monotonic deques: drop entries the new sample dominates, then append it
+    int back;
+    while (st->minLen) {
+        back = st->minFront + st->minLen - 1;
+        if (back >= w) back -= w;
+        if (ring[minQ[back]] < x) break;
+        st->minLen--;
+    }
+    back = st->minFront + st->minLen;
+    minQ[back >= w ? back - w : back] = pos;
+    st->minLen++;
+
+    while (st->maxLen) {
+        back = st->maxFront + st->maxLen - 1;
+        if (back >= w) back -= w;
+        if (ring[maxQ[back]] > x) break;
+        st->maxLen--;
+    }
+    back = st->maxFront + st->maxLen;
+    maxQ[back >= w ? back - w : back] = pos;
+    st->maxLen++;
+
+    st->head = pos + 1 == w ? 0 : pos + 1;
+
+    st->ewma = st->count ? st->ewma + pool->config.ewmaAlpha * (x - st->ewma) : x;
+
+    // Welford
+    st->count++;
+    double delta = x - st->mean;
+    st->mean += delta / st->count;
+    st->m2 += delta * (x - st->mean);
+}
+
+void summarizeStream(const StatsPool *pool, const StreamStats *st, SensorSummary *out) {
+    StreamStats *s = (StreamStats *)st;
+    out->samples = st->count;
+    if (!st->filled) {
+        out->ewma = out->windowMean = out->windowMin = out->windowMax = out->stdDev = NAN;
+        return;
+    }
+    float *ring = streamRing(s);
+    out->ewma = st->ewma;
+    out->windowMean = (float)(st->windowSum / st->filled);
+    out->windowMin = ring[streamMinQ(pool, s)[st->minFront]];
+    out->windowMax = ring[streamMaxQ(pool, s)[st->maxFront]];
+    out->stdDev = st->count > 1 ? (float)sqrt(st->m2 / (st->count - 1)) : 0;
+}
+
+// ---------------- Fleet Rollup ----------------
+
+static void rollupReset(FleetRollup *r) {
+    for (int t = 0; t < SENSOR_COUNT; t++) {
+        memset(&r->sensor[t], 0, sizeof(SensorRollup));
+        r->sensor[t].min = INFINITY;
+        r->sensor[t].max = -INFINITY;
+    }
+}
+
+// Chan et al. pairwise combination of Welford states
+static void rollupMerge(SensorRollup *into, const SensorRollup *from) {
+    if (!from->samples) return;
+    if (!into->samples) {
+        *into = *from;
+        return;
+    }
+    uint64_t n = into->samples + from->samples;
+    double delta = from->mean - into->mean;
+    into->mean += delta * from->samples / n;
+    into->m2 += from->m2 + delta * delta * ((double)into->samples * from->samples / n);
+    into->samples = n;
+    if (from->min < into->min) into->min = from->min;
+    if (from->max > into->max) into->max = from->max;
+    into->ewmaSum += from->ewmaSum;
+    into->windowMeanSum += from->windowMeanSum;
+    into->streams += from->streams;
+}
+
+static void rollupRange(const StatsPool *pool, int begin, int end, FleetRollup *out) {
+    rollupReset(out);
+    for (int v = begin; v < end; v++) {
+        for (int t = 0; t < SENSOR_COUNT; t++) {
+            const StreamStats *st = streamAt(pool, v, t);
+            if (!st->count) continue;
+            SensorSummary s;
+            summarizeStream(pool, st, &s);
+            SensorRollup one = {st->count, st->mean, st->m2, s.windowMin, s.windowMax, s.ewma, s.windowMean, 1};
+            rollupMerge(&out->sensor[t], &one);
+        }
+    }
+}
+
+typedef struct {
+    const StatsPool *pool;
+    int begin, end;
+    FleetRollup result;
+} RollupJob;
+
+static void *rollupThread(void *arg) {
+    RollupJob *job = arg;
+    rollupRange(job->pool, job->begin, job->end, &job->result);
+    return NULL;
+}
+
+// Contiguous vehicle ranges per thread, merged in range order so the result does
+// not depend on scheduling
+void rollupFleet(const StatsPool *pool, int threads, FleetRollup *out) {
+    RollupJob jobs[MAX_THREADS];
+    pthread_t tids[MAX_THREADS];
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    if (threads > pool->vehicles) threads = pool->vehicles > 0 ? pool->vehicles : 1;
+
+    for (int i = 0; i < threads; i++) {
+        jobs[i].pool = pool;
+        jobs[i].begin = (int)((long)pool->vehicles * i / threads);
+        jobs[i].end = (int)((long)pool->vehicles * (i + 1) / threads);
+    }
+    int started = 0;
+    for (int i = 1; i < threads; i++) {
+        if (pthread_create(&tids[i], NULL, rollupThread, &jobs[i]) != 0) break;
+        started = i;
+    }
+    rollupThread(&jobs[0]);
+    // Ranges whose thread failed to start run here
+    for (int i = started + 1; i < threads; i++) rollupThread(&jobs[i]);
+    for (int i = 1; i <= started; i++) pthread_join(tids[i], NULL);
+
+    rollupReset(out);
+    for (int i = 0; i < threads; i++)
+        for (int t = 0; t < SENSOR_COUNT; t++)
+            rollupMerge(&out->sensor[t], &jobs[i].result.sensor[t]);
+}
+
+static void printRollup(const FleetRollup *r) {
+    printf("%-9s %12s %9s %9s %9s %9s %9s\n", "Sensor", "Samples", "Mean", "StdDev", "WinMin", "WinMax", "AvgEWMA");
+    for (int t = 0; t < SENSOR_COUNT; t++) {
+        const SensorRollup *s = &r->sensor[t];
+        if (!s->samples) continue;
+        printf("%-9s %12llu %9.3f %9.3f %9.2f %9.2f %9.3f\n", sensorNames[t], (unsigned long long)s->samples, s->mean,
+               s->samples > 1 ? sqrt(s->m2 / (s->samples - 1)) : 0.0, s->min, s->max, s->ewmaSum / s->streams);
+    }
+}
+
+// ---------------- Vehicle (12) ----------------
+
+void initializeVehicle(Vehicle *v, const char *id) {
+    strcpy(v->id, id);
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        v->sensors[i].type = i;
+        v->sensors[i].value = 0;
+        strcpy(v->sensors[i].status, "Unknown");
+    }
+    v->healthStatus = 1;
+}
+
+void simulateSensorInput(Vehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+// 12's analysis; every reading also feeds its stream and the diag fields come
+// from the aggregates
+void analyzeSensors(Vehicle *v, DiagnosticInfo *diag, const StatsPool *pool, int vehicle) {
+    diag->criticalSensors = 0;
+
+    updateSensorStatus(&v->sensors[TEMP_SENSOR], v->sensors[TEMP_SENSOR].value, "OK", "OVERHEAT", 100, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[VOLTAGE_SENSOR], v->sensors[VOLTAGE_SENSOR].value, "OK", "LOW VOLTAGE", 12.0, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[BRAKE_SENSOR], v->sensors[BRAKE_SENSOR].value, "OK", "BRAKE FAIL", 1, &diag->criticalSensors);
+    updateSensorStatus(&v->sensors[TIRE_SENSOR], v->sensors[TIRE_SENSOR].value, "OK", "LOW PRESSURE", 30, &diag->criticalSensors);
+
+    for (int t = 0; t < SENSOR_COUNT; t++)
+        streamPush(pool, streamAt(pool, vehicle, t), v->sensors[t].value);
+
+    SensorSummary temp, voltage;
+    summarizeStream(pool, streamAt(pool, vehicle, TEMP_SENSOR), &temp);
+    summarizeStream(pool, streamAt(pool, vehicle, VOLTAGE_SENSOR), &voltage);
+    diag->avgTemp = temp.windowMean;
+    diag->maxTemp = temp.windowMax;
+    diag->tempEwma = temp.ewma;
+    diag->minVoltage = voltage.windowMin;
+    diag->voltageStdDev = voltage.stdDev;
+}
+
+void updateSensorStatus(Sensor *s, float value, const char *okMessage, const char *warnMessage, float threshold, int *criticalCount) {
+    if (value < threshold) {
+        strcpy(s->status, warnMessage);
+        (*criticalCount)++;
+    } else {
+        strcpy(s->status, okMessage);
+    }
+}
+
+void checkSafety(Vehicle *v, SafetyModule *safety) {
+    safety->obstacleAlert = (v->sensors[DISTANCE_SENSOR].value < 20);
+    safety->brakeFailure = strcmp(v->sensors[BRAKE_SENSOR].status, "BRAKE FAIL") == 0;
+    safety->tirePressureIssue = strcmp(v->sensors[TIRE_SENSOR].status, "LOW PRESSURE") == 0;
+}
+
+void logHealthStatus(Vehicle *v, DiagnosticInfo *diag, SafetyModule *safety) {
+    time_t now;
+    time(&now);
+
+    printf("\n--- Vehicle ID: %s ---\n", v->id);
+    printf("Time: %s", ctime(&now));
+    printf("Temp: %.1f (%s) | window avg %.1f max %.1f | ewma %.1f\n", v->sensors[TEMP_SENSOR].value,
+           v->sensors[TEMP_SENSOR].status, diag->avgTemp, diag->maxTemp, diag->tempEwma);
+    printf("Voltage: %.1f (%s) | window min %.1f | sd %.2f\n", v->sensors[VOLTAGE_SENSOR].value,
+           v->sensors[VOLTAGE_SENSOR].status, diag->minVoltage, diag->voltageStdDev);
+    printf("Brake: %s\n", v->sensors[BRAKE_SENSOR].status);
+    printf("Tire Pressure: %.1f (%s)\n", v->sensors[TIRE_SENSOR].value, v->sensors[TIRE_SENSOR].status);
+    printf("Distance: %.1fcm\n", v->sensors[DISTANCE_SENSOR].value);
+
+    if (safety->obstacleAlert)
+        printf("!!! ALERT: Obstacle too close\n");
+    if (safety->brakeFailure)
+        printf("!!! ALERT: Brake Failure\n");
+    if (safety->tirePressureIssue)
+        printf("!!! ALERT: Tire Pressure Issue\n");
+
+    printf("Health Score: %s\n", diag->criticalSensors > 0 ? "UNSAFE" : "SAFE");
+    printf("-------------------------\n");
+}
+
+// ---------------- Verification ----------------
+
+// Random streams checked sample by sample against a brute-force scan of the
+// same window and a two-pass variance over the full history
+static int verifyStreams(int window) {
+    StatsPool pool;
+    StatsConfig config = {window, 0.1f};
+    int streams = 200;
+    int length = window * 5 + 17;
+    if (statsPoolInit(&pool, streams, config) != 0) return -1;
+    float *history = malloc(sizeof(float) * length);
+    if (!history) {
+        printf("Error: Cannot allocate verification history\n");
+        statsPoolFree(&pool);
+        return -1;
+    }
+
+    int failures = 0;
+    for (int i = 0; i < streams && failures < 5; i++) {
+        StreamStats *st = streamAt(&pool, i / SENSOR_COUNT, i % SENSOR_COUNT);
+        // Mix of plateaus, ramps and noise so the deques see ties and long runs
+        float level = rand() % 100;
+        double ewma = 0;
+        for (int n = 0; n < length && failures < 5; n++) {
+            int shape = (n / 13 + i) % 3;
+            float x = shape == 0 ? level : shape == 1 ? level + n % 7 : (float)(rand() % 1000) / 10.0f;
+            history[n] = x;
+            streamPush(&pool, st, x);
+            ewma = n ? ewma + config.ewmaAlpha * (x - ewma) : x;
+
+            int from = n + 1 > window ? n + 1 - window : 0;
+            double sum = 0;
+            float lo = INFINITY, hi = -INFINITY;
+            for (int k = from; k <= n; k++) {
+                sum += history[k];
+                if (history[k] < lo) lo = history[k];
+                if (history[k] > hi) hi = history[k];
+            }
+            double mean = 0, m2 = 0;
+            for (int k = 0; k <= n; k++) mean += history[k];
+            mean /= n + 1;
+            for (int k = 0; k <= n; k++) m2 += (history[k] - mean) * (history[k] - mean);
+
+            SensorSummary s;
+            summarizeStream(&pool, st, &s);
+            float expectSd = n ? (float)sqrt(m2 / n) : 0;
+            if (s.windowMin != lo || s.windowMax != hi || fabsf(s.windowMean - (float)(sum / (n + 1 - from))) > 1e-3f ||
+                fabsf(s.stdDev - expectSd) > 1e-3f * (1 + expectSd) || fabsf(s.ewma - (float)ewma) > 1e-3f) {
+                printf("Mismatch: stream %d sample %d: min %.2f/%.2f max %.2f/%.2f mean %.4f/%.4f sd %.4f/%.4f\n",
+                       i, n, s.windowMin, lo, s.windowMax, hi, s.windowMean, sum / (n + 1 - from), s.stdDev, expectSd);
+                failures++;
+            }
+        }
+    }
+    free(history);
+    statsPoolFree(&pool);
+    return failures;
+}
+
+// ---------------- Benchmarks ----------------
+
+// The alternative the aggregates replace: rescan the stored window on every sample
+static void naiveWindowScan(const StatsPool *pool, StreamStats *st, SensorSummary *out) {
+    float *ring = streamRing(st);
+    double sum = 0;
+    float lo = INFINITY, hi = -INFINITY;
+    for (int k = 0; k < st->filled; k++) {
+        sum += ring[k];
+        if (ring[k] < lo) lo = ring[k];
+        if (ring[k] > hi) hi = ring[k];
+    }
+    (void)pool;
+    out->windowMean = (float)(sum / st->filled);
+    out->windowMin = lo;
+    out->windowMax = hi;
+}
+
+static int benchmark(int vehicles, StatsConfig config, int threads) {
+    StatsPool pool;
+    if (statsPoolInit(&pool, vehicles, config) != 0) return -1;
+    printf("\n---- Streaming Aggregates: %d vehicles x %d sensors, window %d, alpha %.4f ----\n",
+           vehicles, SENSOR_COUNT, config.window, config.ewmaAlpha);
+    printf("Memory: %zu bytes per vehicle/sensor (%zu header + %d x %zu ring/deques), %.1f MB total\n",
+           pool.stride, sizeof(StreamStats), config.window, sizeof(float) + 2 * sizeof(uint16_t),
+           (double)pool.stride * vehicles * SENSOR_COUNT / (1 << 20));
+
+    // Pre-generated readings so rand() stays out of the timed loops
+    int batch = 4096;
+    float *readings = malloc(sizeof(float) * batch * SENSOR_COUNT);
+    if (!readings) {
+        printf("Error: Cannot allocate benchmark readings\n");
+        statsPoolFree(&pool);
+        return -1;
+    }
+    Vehicle v;
+    initializeVehicle(&v, "VH700");
+    for (int i = 0; i < batch; i++) {
+        simulateSensorInput(&v);
+        for (int t = 0; t < SENSOR_COUNT; t++) readings[i * SENSOR_COUNT + t] = v.sensors[t].value;
+    }
+
+    // Fill every window once, then time steady-state ticks
+    int ticks = config.window + 8;
+    for (int tick = 0; tick < config.window; tick++)
+        for (int i = 0; i < vehicles; i++)
+            for (int t = 0; t < SENSOR_COUNT; t++)
+                streamPush(&pool, streamAt(&pool, i, t), readings[((i + tick) % batch) * SENSOR_COUNT + t]);
+
+    struct timespec t0, t1;
+    float sink = 0;
+    int timedTicks = ticks - config.window;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = config.window; tick < ticks; tick++) {
+        for (int i = 0; i < vehicles; i++) {
+            for (int t = 0; t < SENSOR_COUNT; t++) {
+                StreamStats *st = streamAt(&pool, i, t);
+                streamPush(&pool, st, readings[((i + tick) % batch) * SENSOR_COUNT + t]);
+                SensorSummary s;
+                summarizeStream(&pool, st, &s);
+                sink += s.windowMean + s.windowMin + s.windowMax;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double samples = (double)vehicles * SENSOR_COUNT * timedTicks;
+    double streamNs = elapsedMs(t0, t1) * 1e6 / samples;
+
+    // Naive: same pushes, but mean/min/max recomputed by scanning the window
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = ticks; tick < ticks + timedTicks; tick++) {
+        for (int i = 0; i < vehicles; i++) {
+            for (int t = 0; t < SENSOR_COUNT; t++) {
+                StreamStats *st = streamAt(&pool, i, t);
+                streamPush(&pool, st, readings[((i + tick) % batch) * SENSOR_COUNT + t]);
+                SensorSummary s;
+                naiveWindowScan(&pool, st, &s);
+                sink += s.windowMean + s.windowMin + s.windowMax;
+            }
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double naiveNs = elapsedMs(t0, t1) * 1e6 / ((double)vehicles * SENSOR_COUNT * timedTicks);
+    printf("Push + summary, streaming   : %8.1f ns/sample\n", streamNs);
+    printf("Push + window rescan (naive): %8.1f ns/sample (%.1fx)\n", naiveNs, naiveNs / streamNs);
+
+    // Rollup: serial reference, then threaded; results must agree
+    FleetRollup serial, parallel;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    rollupFleet(&pool, 1, &serial);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double serialMs = elapsedMs(t0, t1);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    rollupFleet(&pool, threads, &parallel);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double parallelMs = elapsedMs(t0, t1);
+
+    int agree = 1;
+    for (int t = 0; t < SENSOR_COUNT; t++) {
+        const SensorRollup *a = &serial.sensor[t], *b = &parallel.sensor[t];
+        if (a->samples != b->samples || a->min != b->min || a->max != b->max || fabs(a->mean - b->mean) > 1e-9 * fabs(a->mean) + 1e-12 ||
+            fabs(a->m2 - b->m2) > 1e-9 * a->m2 + 1e-9)
+            agree = 0;
+    }
+    printf("Fleet rollup: 1 thread %.2f ms, %d threads %.2f ms (%s)\n", serialMs, threads, parallelMs,
+           agree ? "results agree" : "RESULTS DIFFER");
+    printRollup(&parallel);
+    if (sink == 12345.0f) printf(" ");
+
+    free(readings);
+    statsPoolFree(&pool);
+    return agree ? 0 : 1;
+}
+
+// Main
+int main(int argc, char *argv[]) {
+    int vehicles = argc > 1 ? atoi(argv[1]) : 100000;
+    int window = argc > 2 ? atoi(argv[2]) : 60;
+    double halfLife = argc > 3 ? atof(argv[3]) : 10;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 4 ? atoi(argv[4]) : (int)(cores > 0 ? cores : 1);
+    if (vehicles < 1 || halfLife <= 0) {
+        printf("Error: Need at least 1 vehicle and a positive half-life\n");
+        return 1;
+    }
+    srand(time(NULL));
+
+    StatsConfig config = {window, ewmaAlphaForHalfLife(halfLife)};
+
+    // Demo: one vehicle, 12's loop, window aggregates in the log
+    StatsPool demoPool;
+    if (statsPoolInit(&demoPool, 1, config) != 0) return 1;
+    Vehicle v;
+    DiagnosticInfo diag;
+    SafetyModule safety;
+    initializeVehicle(&v, "VH700");
+    for (int cycle = 0; cycle < 5; cycle++) {
+        simulateSensorInput(&v);
+        analyzeSensors(&v, &diag, &demoPool, 0);
+        checkSafety(&v, &safety);
+        logHealthStatus(&v, &diag, &safety);
+    }
+    statsPoolFree(&demoPool);
+
+    printf("\n---- Verification Against Brute Force ----\n");
+    int windows[] = {1, 2, 7, window};
+    int failures = 0;
+    for (int i = 0; i < 4; i++) {
+        int f = verifyStreams(windows[i]);
+        if (f < 0) return 1;
+        printf("window %5d: %s\n", windows[i], f ? "MISMATCH" : "ok");
+        failures += f;
+    }
+
+    if (benchmark(vehicles, config, threads) != 0 || failures) return 1;
+    return 0;
+}
@@ -0,0 +1,664 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+// Build: gcc -O2 "33 Compressed Sensor History Tiers.c" -lm
+// Usage: ./a.out [fleet sensors] [seconds per sensor]
+
+#define SENSOR_COUNT 5
+#define RAW_BLOCKS 8             // Compressed raw ring: oldest block is dropped when a new one opens
+#define RAW_BLOCK_BYTES 224      // Bit stream per block; the header brings each block to 256 bytes
+#define MAX_SAMPLE_BITS 80       // Worst case: 36-bit timestamp + 44-bit value
+#define MINUTE_SLOTS 120         // 2 hours of 1-minute min/max/avg
+#define HOUR_SLOTS 48            // 2 days of 1-hour min/max/avg
+#define MINUTE_MS 60000LL
+#define HOUR_MS 3600000LL
+
+// Sensor Types
+typedef enum {
+    TEMP_SENSOR,
+    VOLTAGE_SENSOR,
+    BRAKE_SENSOR,
+    TIRE_SENSOR,
+    DISTANCE_SENSOR
+} SensorType;
+
+// Sensor Data
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Vehicle Info
+typedef struct {
+    char id[10];
+    Sensor sensors[SENSOR_COUNT];
+    int healthStatus;
+} Vehicle;
+
+// ---------------- History Layout ----------------
+
+// One Gorilla-style block: the first sample is stored verbatim in the header,
+// the rest as delta-of-delta timestamps and XOR-encoded values in bits[]
+typedef struct {
+    int64_t firstTime;
+    int64_t lastTime;
+    float firstValue;
+    uint16_t count;
+    uint16_t bitLen;
+    uint8_t bits[RAW_BLOCK_BYTES + 8];   // 8 bytes slack so bit access can always load a whole word
+} RawBlock;
+
+typedef struct {
+    float min;
+    float max;
+    float avg;                           // NAN when the period had no samples
+} TierBucket;
+
+// Period currently being accumulated; flushed into the tier ring when a sample
+// from a later period arrives
+typedef struct {
+    int64_t period;                      // -1: empty
+    float min;
+    float max;
+    double sum;
+    uint32_t count;
+} TierAccum;
+
+typedef enum {
+    TIER_MINUTE,
+    TIER_HOUR
+} HistoryTier;
+
+// Fixed-size history of one sensor: raw ring + two downsampled tiers. Appender
+// state comes first so an append touches this line, the open block and two buckets.
+typedef struct {
+    int newestBlock;
+    int blocksUsed;
+
+    // Encoder state of the open block
+    int64_t prevTime;
+    int64_t prevDelta;
+    uint32_t prevValue;
+    uint8_t prevLead;                    // 32: no XOR window yet
+    uint8_t prevTrail;
+
+    TierAccum minuteAcc;
+    TierAccum hourAcc;
+    int64_t newestMinute;                // Last flushed period, -1 if none
+    int64_t newestHour;
+    RawBlock raw[RAW_BLOCKS];
+    TierBucket minutes[MINUTE_SLOTS];
+    TierBucket hours[HOUR_SLOTS];
+} SensorHistory;
+
+// One decoded downsampled point
+typedef struct {
+    int64_t startTime;
+    float min;
+    float max;
+    float avg;
+} TierPoint;
+
+// Histories of every sensor of every vehicle, one allocation
+typedef struct {
+    SensorHistory *sensors;
+    int vehicles;
+} HistoryStore;
+
+// Prototypes
+void historyInit(SensorHistory *h);
+int historyAppend(SensorHistory *h, int64_t timeMs, float value);
+int historyReadRaw(const SensorHistory *h, int64_t from, int64_t to, int64_t *times, float *values, int max);
+int historyReadTier(const SensorHistory *h, HistoryTier tier, int64_t from, int64_t to, TierPoint *out, int max);
+size_t historyRawBytes(const SensorHistory *h);
+int historyStoreInit(HistoryStore *store, int vehicles);
+void historyStoreFree(HistoryStore *store);
+void recordSensorData(HistoryStore *store, int vehicle, const Vehicle *v, int64_t timeMs);
+void initializeVehicle(Vehicle *v, const char *id);
+void simulateSensorInput(Vehicle *v);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ---------------- Bit Stream ----------------
+
+// Big-endian bit order; n <= 57 so the field never straddles more than 8 bytes.
+// Writes OR into the stream, which relies on blocks being zeroed when opened.
+static inline void putBits(uint8_t *buf, uint32_t pos, uint64_t value, int n) {
+    uint64_t word;
+    memcpy(&word, buf + (pos >> 3), 8);
+    word = __builtin_bswap64(word) | value << (64 - n - (pos & 7));
+    word = __builtin_bswap64(word);
+    memcpy(buf + (pos >> 3), &word, 8);
+}
+
+static inline uint64_t peekBits(const uint8_t *buf, uint32_t pos, int n) {
+    uint64_t word;
+    memcpy(&word, buf + (pos >> 3), 8);
+    return (__builtin_bswap64(word) << (pos & 7)) >> (64 - n);
+}
+
+static inline int64_t signExtend(uint64_t v, int n) {
+    return (int64_t)(v << (64 - n)) >> (64 - n);
+}
+
+static inline uint32_t floatBits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, 4);
+    return u;
+}
+
+static inline float bitsFloat(uint32_t u) {
+    float f;
+    memcpy(&f, &u, 4);
+    return f;
+}
+
+// ---------------- Encoder ----------------
+
+void historyInit(SensorHistory *h) {
+    memset(h, 0, sizeof(*h));
+    h->minuteAcc.period = h->hourAcc.period = -1;
+    h->newestMinute = h->newestHour = -1;
+    h->prevLead = 32;
+}
+
+// Close the accumulated period into its ring slot; periods skipped since the
+// last flush become empty buckets
+static void tierFlush(TierAccum *acc, TierBucket *ring, int slots, int64_t *newest) {
+    if (acc->period < 0) return;
+    int64_t gapFrom = *newest + 1;
+    if (gapFrom < acc->period - slots) gapFrom = acc->period - slots;
+    for (int64_t p = gapFrom; p < acc->period; p++)
+        ring[p % slots] = (TierBucket){NAN, NAN, NAN};
+    ring[acc->period % slots] = (TierBucket){acc->min, acc->max, (float)(acc->sum / acc->count)};
+    *newest = acc->period;
+}
+
+static void tierAdd(TierAccum *acc, TierBucket *ring, int slots, int64_t *newest, int64_t period, float value) {
+    if (period != acc->period) {
+        tierFlush(acc, ring, slots, newest);
+        acc->period = period;
+        acc->min = acc->max = value;
+        acc->sum = value;
+        acc->count = 1;
+        return;
+    }
+    if (value < acc->min) acc->min = value;
+    if (value > acc->max) acc->max = value;
+    acc->sum += value;
+    acc->count++;
+}
+
+static void openBlock(SensorHistory *h, int64_t timeMs, float value) {
+    if (h->blocksUsed) {
+        h->newestBlock = (h->newestBlock + 1) % RAW_BLOCKS;
+    }
+    if (h->blocksUsed < RAW_BLOCKS) h->blocksUsed++;
+
+    RawBlock *b = &h->raw[h->newestBlock];
+    memset(b, 0, sizeof(*b));
+    b->firstTime = b->lastTime = timeMs;
+    b->firstValue = value;
+    b->count = 1;
+
+    h->prevTime = timeMs;
+    h->prevDelta = 0;
+    h->prevValue = floatBits(value);
+    h->prevLead = 32;
+    h->prevTrail = 0;
+}
+
+// Samples must arrive in non-decreasing time order (milliseconds since epoch)
+int historyAppend(SensorHistory *h, int64_t timeMs, float value) {
+    if (timeMs < 0 || (h->blocksUsed && timeMs < h->prevTime)) {
+        printf("Error: History sample at %lld ms is out of order\n", (long long)timeMs);
+        return -1;
+    }
+
+    tierAdd(&h->minuteAcc, h->minutes, MINUTE_SLOTS, &h->newestMinute, timeMs / MINUTE_MS, value);
+    tierAdd(&h->hourAcc, h->hours, HOUR_SLOTS, &h->newestHour, timeMs / HOUR_MS, value);
+
+    RawBlock *b = &h->raw[h->newestBlock];
+    int64_t delta = timeMs - h->prevTime;
+    int64_t dod = delta - h->prevDelta;
+    if (!h->blocksUsed || b->count == UINT16_MAX || b->bitLen + MAX_SAMPLE_BITS > RAW_BLOCK_BYTES * 8 ||
+        dod < INT32_MIN || dod > INT32_MAX) {
+        openBlock(h, timeMs, value);
+        return 0;
+    }
+
+    // Timestamp: delta-of-delta in the smallest of four signed widths
+    uint32_t pos = b->bitLen;
+    if (dod == 0) {
+        pos += 1;                                                   // '0'
+    } else if (dod >= -64 && dod <= 63) {
+        putBits(b->bits, pos, 0x2ULL << 7 | ((uint64_t)dod & 0x7F), 9);           // '10'
+        pos += 9;
+    } else if (dod >= -256 && dod <= 255) {
+        putBits(b->bits, pos, 0x6ULL << 9 | ((uint64_t)dod & 0x1FF), 12);         // '110'
+        pos += 12;
+    } else if (dod >= -2048 && dod <= 2047) {
+        putBits(b->bits, pos, 0xEULL << 12 | ((uint64_t)dod & 0xFFF), 16);        // '1110'
+        pos += 16;
+    } else {
+        putBits(b->bits, pos, 0xFULL << 32 | ((uint64_t)dod & 0xFFFFFFFFULL), 36); // '1111'
+        pos += 36;
+    }
+
+    // Value: XOR with the previous one; reuse the previous meaningful-bit window when it fits
+    uint32_t bits = floatBits(value);
+    uint32_t x = bits ^ h->prevValue;
+    if (x == 0) {
+        pos += 1;                                                   // '0'
+    } else {
+        int lead = __builtin_clz(x);
+        int trail = __builtin_ctz(x);
+        if (h->prevLead < 32 && lead >= h->prevLead && trail >= h->prevTrail) {
+            int len = 32 - h->prevLead - h->prevTrail;
+            putBits(b->bits, pos, 0x2ULL << len | (x >> h->prevTrail), len + 2);   // '10'
+            pos += len + 2;
+        } else {
+            int len = 32 - lead - trail;
+            putBits(b->bits, pos, (0x3ULL << 10 | (uint64_t)lead << 5 | (len - 1)) << len | (x >> trail), 12 + len);  // '11'
+            pos += 12 + len;
+            h->prevLead = lead;
+            h->prevTrail = trail;
+        }
+    }
+
+    b->bitLen = pos;
+    b->count++;
+    b->lastTime = timeMs;
+    h->prevTime = timeMs;
+    h->prevDelta = delta;
+    h->prevValue = bits;
+    return 0;
+}
+
+// ---------------- Readers ----------------
+
+// Decode one block, keeping samples inside [from, to]; returns samples written
+static int decodeBlock(const RawBlock *b, int64_t from, int64_t to, int64_t *times, float *values, int max) {
+    const uint8_t *buf = b->bits;
+    int64_t t = b->firstTime, delta = 0;
+    uint32_t v = floatBits(b->firstValue);
+    int lead = 32, trail = 0;
+    uint32_t pos = 0;
+    int n = 0;
+
+    for (int i = 0; i < b->count; i++) {
+        if (i) {
+            uint64_t ctl = peekBits(buf, pos, 4);
+            if (!(ctl & 8)) {
+                pos += 1;
+            } else if (!(ctl & 4)) {
+                delta += signExtend(peekBits(buf, pos + 2, 7), 7);
+                pos += 9;
+            } else if (!(ctl & 2)) {
+                delta += signExtend(peekBits(buf, pos + 3, 9), 9);
+                pos += 12;
+            } else if (!(ctl & 1)) {
+                delta += signExtend(peekBits(buf, pos + 4, 12), 12);
+                pos += 16;
+            } else {
+                delta += signExtend(peekBits(buf, pos + 4, 32), 32);
+                pos += 36;
+            }
+            t += delta;
+
+            ctl = peekBits(buf, pos, 2);
+            if (!(ctl & 2)) {
+                pos += 1;
+            } else if (!(ctl & 1)) {
+                int len = 32 - lead - trail;
+                v ^= (uint32_t)peekBits(buf, pos + 2, len) << trail;
+                pos += 2 + len;
+            } else {
+                uint64_t hdr = peekBits(buf, pos + 2, 10);
+                lead = hdr >> 5;
+                int len = (hdr & 31) + 1;
+                trail = 32 - lead - len;
+                v ^= (uint32_t)peekBits(buf, pos + 12, len) << trail;
+                pos += 12 + len;
+            }
+        }
+        if (t > to) break;
+        if (t >= from) {
+            if (n == max) break;
+            times[n] = t;
+            values[n] = bitsFloat(v);
+            n++;
+        }
+    }
+    return n;
+}
+
+// Raw samples in [from, to], oldest first; returns the number written (at most max)
+int historyReadRaw(const SensorHistory *h, int64_t from, int64_t to, int64_t *times, float *values, int max) {
+    int n = 0;
+    int oldest = (h->newestBlock - h->blocksUsed + 1 + RAW_BLOCKS) % RAW_BLOCKS;
+    for (int i = 0; i < h->blocksUsed && n < max; i++) {
+        const RawBlock *b = &h->raw[(oldest + i) % RAW_BLOCKS];
+        if (b->lastTime < from) continue;
+        if (b->firstTime > to) break;
+        n += decodeBlock(b, from, to, times + n, values + n, max - n);
+    }
+    return n;
+}
+
+// Downsampled points in [from, to], oldest first, including the period still
+// being accumulated; empty periods are skipped
+int historyReadTier(const SensorHistory *h, HistoryTier tier, int64_t from, int64_t to, TierPoint *out, int max) {
+    const TierBucket *ring = tier == TIER_MINUTE ? h->minutes : h->hours;
+    const TierAccum *acc = tier == TIER_MINUTE ? &h->minuteAcc : &h->hourAcc;
+    int slots = tier == TIER_MINUTE ? MINUTE_SLOTS : HOUR_SLOTS;
+    int64_t periodMs = tier == TIER_MINUTE ? MINUTE_MS : HOUR_MS;
+    int64_t newest = tier == TIER_MINUTE ? h->newestMinute : h->newestHour;
+    int n = 0;
+
+    if (newest >= 0) {
+        int64_t first = newest - slots + 1 > 0 ? newest - slots + 1 : 0;
+        if (first < from / periodMs) first = from / periodMs;
+        for (int64_t p = first; p <= newest && p * periodMs <= to && n < max; p++) {
+            const TierBucket *b = &ring[p % slots];
+            if (isnan(b->avg)) continue;
+            out[n++] = (TierPoint){p * periodMs, b->min, b->max, b->avg};
+        }
+    }
+    if (acc->period >= 0 && n < max && acc->period * periodMs <= to && (acc->period + 1) * periodMs > from)
+        out[n++] = (TierPoint){acc->period * periodMs, acc->min, acc->max, (float)(acc->sum / acc->count)};
+    return n;
+}
+
+size_t historyRawBytes(const SensorHistory *h) {
+    size_t bytes = 0;
+    for (int i = 0; i < h->blocksUsed; i++) {
+        const RawBlock *b = &h->raw[(h->newestBlock - i + RAW_BLOCKS) % RAW_BLOCKS];
+        bytes += (b->bitLen + 7) / 8 + sizeof(int64_t) + sizeof(float);   // Stream + verbatim first sample
+    }
+    return bytes;
+}
+
+// ---------------- Fleet Store ----------------
+
+int historyStoreInit(HistoryStore *store, int vehicles) {
+    store->vehicles = vehicles;
+    store->sensors = malloc(sizeof(SensorHistory) * (size_t)vehicles * SENSOR_COUNT);
+    if (!store->sensors) {
+        printf("Error: Cannot allocate history for %d vehicles (%.1f MB)\n", vehicles,
+               sizeof(SensorHistory) * (double)vehicles * SENSOR_COUNT / (1 << 20));
+        return -1;
+    }
+    for (size_t i = 0; i < (size_t)vehicles * SENSOR_COUNT; i++) historyInit(&store->sensors[i]);
+    return 0;
+}
+
+void historyStoreFree(HistoryStore *store) {
+    free(store->sensors);
+    store->sensors = NULL;
+    store->vehicles = 0;
+}
+
+void recordSensorData(HistoryStore *store, int vehicle, const Vehicle *v, int64_t timeMs) {
+    SensorHistory *h = &store->sensors[(size_t)vehicle * SENSOR_COUNT];
+    for (int t = 0; t < SENSOR_COUNT; t++) historyAppend(&h[t], timeMs, v->sensors[t].value);
+}
+
+// ---------------- Vehicle (12) ----------------
+
+void initializeVehicle(Vehicle *v, const char *id) {
+    strcpy(v->id, id);
+    for (int i = 0; i < SENSOR_COUNT; i++) {
+        v->sensors[i].type = i;
+        v->sensors[i].value = 0;
+        strcpy(v->sensors[i].status, "Unknown");
+    }
+    v->healthStatus = 1;
+}
+
+void simulateSensorInput(Vehicle *v) {
+    v->sensors[TEMP_SENSOR].value = 75 + rand() % 50;      // 75-125
+    v->sensors[VOLTAGE_SENSOR].value = 11.5 + (rand() % 20) / 10.0;  // 11.5–13.5
+    v->sensors[BRAKE_SENSOR].value = rand() % 2;
+    v->sensors[TIRE_SENSOR].value = 28 + rand() % 10;      // 28–38
+    v->sensors[DISTANCE_SENSOR].value = rand() % 100;      // 0–100 cm
+}
+
+// ---------------- Verification ----------------
+
+// Engine temperature at 0.1 degree resolution that moves about once every four
+// readings: closer to a real sensor than 12's uniform noise
+static float driftingTemp(float current) {
+    if (rand() % 4) return current;
+    float next = current + (rand() % 3 - 1) * 0.1f;
+    return roundf(next * 10) / 10;
+}
+
+// Feed one sensor 26 hours of 1 Hz samples with timestamp jitter and compare
+// every tier with a brute-force reference
+static int verifyHistory(SensorHistory *h, int uniform) {
+    int seconds = 26 * 3600;
+    int64_t start = 1700000000000LL;
+    int64_t *refTimes = malloc(sizeof(int64_t) * seconds);
+    float *refValues = malloc(sizeof(float) * seconds);
+    int64_t *times = malloc(sizeof(int64_t) * seconds);
+    float *values = malloc(sizeof(float) * seconds);
+    TierPoint *points = malloc(sizeof(TierPoint) * MINUTE_SLOTS * 2);
+    if (!refTimes || !refValues || !times || !values || !points) {
+        printf("Error: Cannot allocate verification buffers\n");
+        free(refTimes); free(refValues); free(times); free(values); free(points);
+        return -1;
+    }
+
+    historyInit(h);
+    Vehicle v;
+    initializeVehicle(&v, "VH700");
+    float temp = 90;
+    int64_t t = start;
+    for (int i = 0; i < seconds; i++) {
+        t += 1000 + (rand() % 8 == 0 ? rand() % 7 - 3 : 0);   // Occasional few-ms jitter
+        if (i % 5000 == 4999) t += 45000;                       // Occasional gap in reporting
+        if (uniform) {
+            simulateSensorInput(&v);
+            temp = v.sensors[TEMP_SENSOR].value;
+        } else {
+            temp = driftingTemp(temp);
+        }
+        refTimes[i] = t;
+        refValues[i] = temp;
+        historyAppend(h, t, temp);
+    }
+
+    int failures = 0;
+    // Raw: everything still held must decode to exactly the newest reference samples
+    int n = historyReadRaw(h, 0, INT64_MAX, times, values, seconds);
+    for (int i = 0; i < n && failures < 5; i++) {
+        int r = seconds - n + i;
+        if (times[i] != refTimes[r] || floatBits(values[i]) != floatBits(refValues[r])) {
+            printf("Mismatch: raw sample %d: %lld/%lld %.3f/%.3f\n", i, (long long)times[i], (long long)refTimes[r],
+                   values[i], refValues[r]);
+            failures++;
+        }
+    }
+    // Range read inside the raw window
+    int64_t from = times[n / 3], to = times[n / 2];
+    int m = historyReadRaw(h, from, to, times, values, seconds);
+    if (m != n / 2 - n / 3 + 1 || times[0] != from || times[m - 1] != to) {
+        printf("Mismatch: raw range read returned %d samples, expected %d\n", m, n / 2 - n / 3 + 1);
+        failures++;
+    }
+
+    // Tiers: recompute each retained period from the reference
+    HistoryTier tiers[] = {TIER_MINUTE, TIER_HOUR};
+    int64_t periods[] = {MINUTE_MS, HOUR_MS};
+    int tierCounts[2];
+    for (int k = 0; k < 2; k++) {
+        int p = historyReadTier(h, tiers[k], 0, INT64_MAX, points, MINUTE_SLOTS * 2);
+        tierCounts[k] = p;
+        int r = 0;
+        for (int i = 0; i < p && failures < 5; i++) {
+            while (r < seconds && refTimes[r] < points[i].startTime) r++;
+            float lo = INFINITY, hi = -INFINITY;
+            double sum = 0;
+            int count = 0;
+            for (; r < seconds && refTimes[r] < points[i].startTime + periods[k]; r++, count++) {
+                if (refValues[r] < lo) lo = refValues[r];
+                if (refValues[r] > hi) hi = refValues[r];
+                sum += refValues[r];
+            }
+            if (!count || points[i].min != lo || points[i].max != hi || fabsf(points[i].avg - (float)(sum / count)) > 1e-4f * fabsf(hi)) {
+                printf("Mismatch: %s bucket %d\n", k ? "hour" : "minute", i);
+                failures++;
+            }
+        }
+    }
+
+    size_t rawBytes = historyRawBytes(h);
+    printf("%-22s raw %5d samples (%5.1f min) in %4zu bytes = %.2f bytes/sample | minute tier %3d points | hour tier %2d points | %s\n",
+           uniform ? "12's uniform readings:" : "Drifting temperature:", n, (refTimes[seconds - 1] - refTimes[seconds - n]) / 60000.0,
+           rawBytes, (double)rawBytes / n, tierCounts[0], tierCounts[1], failures ? "MISMATCH" : "ok");
+
+    free(refTimes); free(refValues); free(times); free(values); free(points);
+    return failures;
+}
+
+// ---------------- Benchmarks ----------------
+
+static int benchmark(int sensors, int seconds) {
+    HistoryStore store;
+    int vehicles = (sensors + SENSOR_COUNT - 1) / SENSOR_COUNT;
+    if (historyStoreInit(&store, vehicles) != 0) return -1;
+    int total = vehicles * SENSOR_COUNT;
+    printf("\n---- Fleet: %d sensors, %d s of 1 Hz samples each ----\n", total, seconds);
+
+    // Pre-generated drifting readings so rand() stays out of the timed ingest
+    int pattern = 1 << 16;
+    float *readings = malloc(sizeof(float) * pattern);
+    int64_t *times = malloc(sizeof(int64_t) * 4096);
+    float *values = malloc(sizeof(float) * 4096);
+    if (!readings || !times || !values) {
+        printf("Error: Cannot allocate benchmark buffers\n");
+        free(readings); free(times); free(values);
+        historyStoreFree(&store);
+        return -1;
+    }
+    float temp = 90;
+    for (int i = 0; i < pattern; i++) readings[i] = temp = driftingTemp(temp);
+
+    struct timespec t0, t1;
+    int64_t start = 1700000000000LL;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int s = 0; s < seconds; s++) {
+        int64_t now = start + s * 1000LL;
+        for (int i = 0; i < total; i++)
+            historyAppend(&store.sensors[i], now, readings[(i * 131 + s) & (pattern - 1)]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double ingestMs = elapsedMs(t0, t1);
+    printf("Ingest     : %.1f M samples/s (%.1f ns/sample)\n", (double)total * seconds / ingestMs / 1e3,
+           ingestMs * 1e6 / ((double)total * seconds));
+
+    // Full raw read of every sensor; compare the decoded output rate with plain memcpy
+    size_t compressed = 0;
+    long decoded = 0;
+    double checksum = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < total; i++) {
+        int n = historyReadRaw(&store.sensors[i], 0, INT64_MAX, times, values, 4096);
+        decoded += n;
+        checksum += values[n - 1];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double decodeMs = elapsedMs(t0, t1);
+    for (int i = 0; i < total; i++) compressed += historyRawBytes(&store.sensors[i]);
+
+    size_t copyBytes = 64 << 20;
+    char *src = malloc(copyBytes), *dst = malloc(copyBytes);
+    double copyGBs = 0;
+    if (src && dst) {
+        memset(src, 1, copyBytes);
+        memset(dst, 0, copyBytes);
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (int r = 0; r < 4; r++) {
+            memcpy(dst, src, copyBytes);
+            src[r] = dst[copyBytes - 1 - r];   // Keeps the copies observable
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        copyGBs = 4.0 * copyBytes / elapsedMs(t0, t1) / 1e6;
+        checksum += src[3];
+    }
+    free(src);
+    free(dst);
+
+    double outBytes = decoded * (double)(sizeof(int64_t) + sizeof(float));
+    printf("Range read : %.1f M samples/s, %.2f bytes/sample compressed, output %.2f GB/s (memcpy %.2f GB/s)\n",
+           decoded / decodeMs / 1e3, (double)compressed / decoded, outBytes / decodeMs / 1e6, copyGBs);
+    if (checksum == 0) printf(" ");
+
+    free(readings);
+    free(times);
+    free(values);
+    historyStoreFree(&store);
+    return 0;
+}
+
+// Main
+int main(int argc, char *argv[]) {
+    int sensors = argc > 1 ? atoi(argv[1]) : 100000;
+    int seconds = argc > 2 ? atoi(argv[2]) : 900;
+    if (sensors < 1 || seconds < 1) {
+        printf("Error: Need at least 1 sensor and 1 second\n");
+        return 1;
+    }
+    srand(42);
+
+    SensorHistory *h = malloc(sizeof(SensorHistory));
+    if (!h) {
+        printf("Error: Cannot allocate sensor history\n");
+        return 1;
+    }
+
+    printf("---- Fixed Budget Per Sensor ----\n");
+    printf("Raw ring %d x %zu B, minute tier %d x %zu B, hour tier %d x %zu B: %zu bytes per sensor\n",
+           RAW_BLOCKS, sizeof(RawBlock), MINUTE_SLOTS, sizeof(TierBucket), HOUR_SLOTS, sizeof(TierBucket), sizeof(SensorHistory));
+    printf("1M sensors: %.2f GB for recent raw + %d h at 1 min + %d h at 1 h\n",
+           sizeof(SensorHistory) * 1e6 / (1 << 30), MINUTE_SLOTS / 60, HOUR_SLOTS);
+
+    // Demo: one vehicle recorded through the fleet store
+    HistoryStore demo;
+    if (historyStoreInit(&demo, 1) != 0) return 1;
+    Vehicle v;
+    initializeVehicle(&v, "VH700");
+    int64_t demoStart = (int64_t)time(NULL) * 1000;
+    for (int s = 0; s < 180; s++) {
+        simulateSensorInput(&v);
+        recordSensorData(&demo, 0, &v, demoStart + s * 1000LL);
+    }
+    TierPoint points[4];
+    int64_t rawTimes[3];
+    float rawValues[3];
+    int n = historyReadTier(&demo.sensors[TEMP_SENSOR], TIER_MINUTE, 0, INT64_MAX, points, 4);
+    printf("\n--- Vehicle ID: %s, Temp history ---\n", v.id);
+    for (int i = 0; i < n; i++) {
+        time_t at = points[i].startTime / 1000;
+        printf("Minute %.8s: min %.1f max %.1f avg %.1f\n", ctime(&at) + 11, points[i].min, points[i].max, points[i].avg);
+    }
+    n = historyReadRaw(&demo.sensors[TEMP_SENSOR], demoStart + 177000, INT64_MAX, rawTimes, rawValues, 3);
+    for (int i = 0; i < n; i++) printf("Raw +%llds: %.1f\n", (long long)(rawTimes[i] - demoStart) / 1000, rawValues[i]);
+    historyStoreFree(&demo);
+
+    printf("\n---- Verification: 26 h at 1 Hz ----\n");
+    int failures = verifyHistory(h, 0);
+    failures += verifyHistory(h, 1);
+    free(h);
+    if (failures) return 1;
+
+    return benchmark(sensors, seconds) != 0;
+}
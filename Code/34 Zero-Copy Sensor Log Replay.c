@@ -0,0 +1,1004 @@
+#define _GNU_SOURCE             // tm_gmtoff
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Build: gcc -O2 "34 Zero-Copy Sensor Log Replay.c"
+// Usage: ./a.out [--speed X] [--quiet] [sensor_log.txt | capture.seg]
+//        --speed 1 replays at wall-clock rate, 10 ten times faster, 0 (default) unthrottled.
+//        Without a file, a synthetic text log and segment are generated and replayed.
+
+#define MAX_SENSORS 5
+#define BLOCK_ROWS 4096                       // Samples per column block (23)
+#define SEGMENT_MAGIC 0x53454753u             // "SEGS"
+#define SEGMENT_VERSION 1
+#define VEHICLE_ID_NONE UINT32_MAX
+
+// Sensor Types
+typedef enum {
+    TEMPERATURE_SENSOR,
+    SPEED_SENSOR,
+    FUEL_SENSOR,
+    BRAKE_PRESSURE_SENSOR,
+    BATTERY_VOLTAGE_SENSOR
+} SensorType;
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    SensorData sensors[MAX_SENSORS];
+    uint8_t sensor_count;
+    uint8_t status;
+} Vehicle;
+
+// Segment layout written by 23
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t blockRows;
+    uint32_t reserved;
+} SegmentHeader;
+
+typedef struct {
+    uint32_t rows;
+    uint32_t faultyCount;
+    int64_t minTime, maxTime;
+    uint32_t minVehicle, maxVehicle;
+    uint16_t minValue, maxValue;
+    uint8_t typeMask;
+    uint8_t pad[3];
+} BlockHeader;
+
+// ---------------- Replay Source ----------------
+
+typedef enum {
+    REPLAY_TEXT,        // sensor_log.txt as logSensorData (11) writes it
+    REPLAY_SEGMENT      // Binary column segment from 23 plus its ".ids" table
+} ReplayFormat;
+
+// Where one snapshot starts; only built when the file is not already in time order
+typedef struct {
+    int64_t time;
+    size_t pos;         // Text: offset of the record; segment: offset of the block
+    uint32_t row;       // Segment: first row of the snapshot
+} ReplayIndexEntry;
+
+// The whole input mapped read-only; records are parsed straight out of the mapping
+typedef struct {
+    ReplayFormat format;
+    const char *base;
+    size_t size;
+    const char (*segIds)[10];
+    uint32_t segIdCount;
+    size_t idsSize;
+    ReplayIndexEntry *index;    // NULL: file order is timestamp order
+    size_t snapshots;
+    uint64_t samples;
+    size_t malformed;
+    int64_t firstTime, lastTime;
+} ReplaySource;
+
+// One vehicle's readings at one timestamp; id points into the mapping
+typedef struct {
+    int64_t time;
+    const char *id;
+    int idLen;
+    char idBuf[12];             // "#<index>" for segment vehicles without a name
+    uint32_t segVehicle;
+    uint8_t count;
+    SensorData sensors[MAX_SENSORS];
+} ReplaySnapshot;
+
+typedef struct {
+    size_t pos;
+    uint32_t row;
+    size_t next;                // Next index entry when replaying through the index
+    size_t malformed;
+    int64_t offsetHour;         // Local hour (+1) the cached UTC offset belongs to, 0 = none
+    long utcOffset;             // ctime() wrote local time
+} ReplayCursor;
+
+// Vehicles seen in the replay, found by ID through an open-addressing index
+typedef struct {
+    Vehicle *vehicles;
+    uint32_t count, capacity;
+    uint32_t *hash;
+    uint32_t hashCapacity;
+    uint32_t *segMap;           // Segment vehicle index -> fleet index
+} ReplayFleet;
+
+typedef struct {
+    uint64_t snapshots;
+    uint64_t samples;
+    uint64_t faultFlagChanges;  // Recorded flag differs from what checkSensorFault computes now
+    uint64_t checksum;
+    double elapsedMs;
+    double maxLagMs;            // Wall-clock mode: worst delay behind the recorded schedule
+} ReplayStats;
+
+// Pipeline step per replayed vehicle; returns fault flags it changed
+typedef int (*ReplayProcessor)(Vehicle *);
+
+// Function Prototypes
+int replayOpen(ReplaySource *src, const char *path);
+void replayClose(ReplaySource *src);
+int replayNext(const ReplaySource *src, ReplayCursor *c, ReplaySnapshot *s);
+int replayRun(const ReplaySource *src, ReplayFleet *fleet, double speed, ReplayProcessor process, ReplayStats *stats);
+void fleetFree(ReplayFleet *fleet);
+int processReplayedVehicle(Vehicle *vehicle);
+void assignRandomSensors(Vehicle *vehicle);
+void updateSensorData(Vehicle *vehicle);
+void checkSensorFault(SensorData *sensor);
+void processTemperature(SensorData *sensor);
+void processSpeed(SensorData *sensor);
+void processFuel(SensorData *sensor);
+void processBrakePressure(SensorData *sensor);
+void processBatteryVoltage(SensorData *sensor);
+void sendToCANBus(SensorData *sensor);
+
+// Function Pointer for Sensor Processing
+typedef void (*SensorProcessor)(SensorData *);
+
+// Function Pointer Array for Sensor Processing
+SensorProcessor sensorHandlers[] = {
+    processTemperature,
+    processSpeed,
+    processFuel,
+    processBrakePressure,
+    processBatteryVoltage
+};
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ---------------- Text Parsing ----------------
+
+// Days since 1970-01-01 for a proleptic Gregorian date
+static int64_t daysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+static inline int twoDigits(const char *p) {
+    return (p[0] == ' ' ? 0 : p[0] - '0') * 10 + (p[1] - '0');
+}
+
+// "Sat Oct 17 04:47:56 2026" (ctime without the newline) -> seconds as if UTC
+static int parseCtime(const char *p, int64_t *civil) {
+    static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    int month = 0;
+    for (int m = 0; m < 12; m++) {
+        if (p[4] == months[m * 3] && p[5] == months[m * 3 + 1] && p[6] == months[m * 3 + 2]) {
+            month = m + 1;
+            break;
+        }
+    }
+    if (!month || p[13] != ':' || p[16] != ':' || p[19] != ' ') return 0;
+    for (int i = 20; i < 24; i++)
+        if (p[i] < '0' || p[i] > '9') return 0;
+    int year = (p[20] - '0') * 1000 + (p[21] - '0') * 100 + (p[22] - '0') * 10 + (p[23] - '0');
+    int64_t days = daysFromCivil(year, month, twoDigits(p + 8));
+    *civil = days * 86400 + twoDigits(p + 11) * 3600 + twoDigits(p + 14) * 60 + twoDigits(p + 17);
+    return 1;
+}
+
+// Offset of local time from UTC at a local wall-clock time, as mktime resolves it
+static long localUtcOffset(int64_t civil) {
+    time_t t = (time_t)civil;
+    struct tm local;
+    gmtime_r(&t, &local);
+    local.tm_isdst = -1;
+    time_t utc = mktime(&local);
+    return utc == (time_t)-1 ? 0 : (long)(civil - (int64_t)utc);
+}
+
+static const char *parseUint(const char *p, const char *end, uint32_t *out) {
+    uint32_t v = 0;
+    const char *start = p;
+    while (p < end && *p >= '0' && *p <= '9') v = v * 10 + (uint32_t)(*p++ - '0');
+    *out = v;
+    return p > start ? p : NULL;
+}
+
+static inline const char *lineEnd(const char *p, const char *end) {
+    const char *eol = memchr(p, '\n', (size_t)(end - p));
+    return eol ? eol : end;
+}
+
+// One record:  "\n[<ctime>\n] Vehicle ID: <id>\n" then "Sensor Type: %d, Value: %d %s\n" lines.
+// Unparseable lines are skipped and counted, so a torn write only costs that record.
+static int parseTextRecord(const ReplaySource *src, ReplayCursor *c, ReplaySnapshot *s) {
+    const char *p = src->base + c->pos;
+    const char *end = src->base + src->size;
+
+    for (;;) {
+        while (p < end && *p == '\n') p++;
+        if (p >= end) {
+            c->pos = src->size;
+            return 0;
+        }
+        const char *eol = lineEnd(p, end);
+        int64_t civil;
+        if (eol - p != 25 || p[0] != '[' || !parseCtime(p + 1, &civil)) {
+            c->malformed++;
+            p = eol;
+            continue;
+        }
+        const char *idLine = eol + 1;
+        if (idLine >= end) {
+            c->malformed++;
+            p = end;
+            continue;
+        }
+        eol = lineEnd(idLine, end);
+        if (eol - idLine <= 14 || memcmp(idLine, "] Vehicle ID: ", 14) != 0) {
+            c->malformed++;
+            p = idLine;
+            continue;
+        }
+        // DST changes on hour boundaries, so one mktime per local hour is enough
+        int64_t hour = civil / 3600 + 1;
+        if (hour != c->offsetHour) {
+            c->utcOffset = localUtcOffset(civil);
+            c->offsetHour = hour;
+        }
+        s->time = civil - c->utcOffset;
+        s->id = idLine + 14;
+        s->idLen = (int)(eol - s->id);
+        s->segVehicle = VEHICLE_ID_NONE;
+        s->count = 0;
+        p = eol + 1;
+        break;
+    }
+
+    while (p + 13 < end && memcmp(p, "Sensor Type: ", 13) == 0) {
+        const char *eol = lineEnd(p, end);
+        uint32_t type, value;
+        const char *q = parseUint(p + 13, eol, &type);
+        if (!q || eol - q < 9 || memcmp(q, ", Value: ", 9) != 0 || !(q = parseUint(q + 9, eol, &value)) ||
+            type >= MAX_SENSORS || value > UINT16_MAX || s->count == MAX_SENSORS) {
+            c->malformed++;
+        } else {
+            SensorData *d = &s->sensors[s->count++];
+            d->type = (SensorType)type;
+            d->value = (uint16_t)value;
+            d->is_faulty = eol - q >= 9 && memcmp(eol - 8, "[FAULTY]", 8) == 0;
+        }
+        p = eol + 1;
+    }
+    c->pos = p < end ? (size_t)(p - src->base) : src->size;
+    return 1;
+}
+
+// ---------------- Segment Parsing ----------------
+
+typedef struct {
+    uint32_t rows;
+    const int64_t *timestamp;
+    const uint32_t *vehicle;
+    const uint16_t *value;
+    const uint8_t *sensorType;
+    const uint8_t *faulty;
+} BlockColumns;
+
+static size_t blockBytes(uint32_t rows) {
+    return sizeof(BlockHeader) + (size_t)rows * (sizeof(int64_t) + sizeof(uint32_t) + sizeof(uint16_t) + 2);
+}
+
+// Columns of the block at offset, or rows == 0 past the end / at a truncated tail
+static BlockColumns blockAt(const ReplaySource *src, size_t offset) {
+    BlockColumns b = {0};
+    if (offset + sizeof(BlockHeader) > src->size) return b;
+    const BlockHeader *h = (const BlockHeader *)(src->base + offset);
+    if (h->rows == 0 || h->rows > BLOCK_ROWS || offset + blockBytes(h->rows) > src->size) return b;
+    const char *col = src->base + offset + sizeof(BlockHeader);
+    b.rows = h->rows;
+    b.timestamp = (const int64_t *)col;
+    b.vehicle = (const uint32_t *)(col + b.rows * sizeof(int64_t));
+    b.value = (const uint16_t *)(col + b.rows * (sizeof(int64_t) + sizeof(uint32_t)));
+    b.sensorType = (const uint8_t *)(b.value + b.rows);
+    b.faulty = b.sensorType + b.rows;
+    return b;
+}
+
+// Consecutive rows with the same time and vehicle form one snapshot (logSensorData in
+// 23 appends a vehicle's sensors back to back); a snapshot may continue into the next block
+static int parseSegmentSnapshot(const ReplaySource *src, ReplayCursor *c, ReplaySnapshot *s) {
+    BlockColumns b = blockAt(src, c->pos);
+    if (!b.rows) return 0;
+
+    s->time = b.timestamp[c->row];
+    s->segVehicle = b.vehicle[c->row];
+    s->count = 0;
+    if (s->segVehicle < src->segIdCount) {
+        s->id = src->segIds[s->segVehicle];
+        s->idLen = (int)strnlen(s->id, 10);
+    } else {
+        s->idLen = snprintf(s->idBuf, sizeof(s->idBuf), "#%u", s->segVehicle);
+        s->id = s->idBuf;
+    }
+
+    for (;;) {
+        if (b.sensorType[c->row] < MAX_SENSORS) {
+            SensorData *d = &s->sensors[s->count++];
+            d->type = (SensorType)b.sensorType[c->row];
+            d->value = b.value[c->row];
+            d->is_faulty = b.faulty[c->row];
+        } else {
+            c->malformed++;
+        }
+        if (++c->row == b.rows) {
+            c->pos += blockBytes(b.rows);
+            c->row = 0;
+            b = blockAt(src, c->pos);
+            if (!b.rows) break;
+        }
+        if (s->count == MAX_SENSORS || b.timestamp[c->row] != s->time || b.vehicle[c->row] != s->segVehicle) break;
+    }
+    return 1;
+}
+
+// ---------------- Open / Iterate ----------------
+
+static const void *mapFile(const char *path, size_t *size) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return NULL;
+    }
+    void *base = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+    madvise(base, (size_t)st.st_size, MADV_SEQUENTIAL);
+    *size = (size_t)st.st_size;
+    return base;
+}
+
+static int readAt(const ReplaySource *src, ReplayCursor *c, ReplaySnapshot *s) {
+    return src->format == REPLAY_TEXT ? parseTextRecord(src, c, s) : parseSegmentSnapshot(src, c, s);
+}
+
+static int compareIndex(const void *a, const void *b) {
+    const ReplayIndexEntry *x = a, *y = b;
+    if (x->time != y->time) return x->time < y->time ? -1 : 1;
+    if (x->pos != y->pos) return x->pos < y->pos ? -1 : 1;
+    return (x->row > y->row) - (x->row < y->row);
+}
+
+int replayOpen(ReplaySource *src, const char *path) {
+    memset(src, 0, sizeof(*src));
+    src->base = mapFile(path, &src->size);
+    if (!src->base) {
+        printf("Error: Cannot map %s\n", path);
+        return -1;
+    }
+
+    const SegmentHeader *header = (const SegmentHeader *)src->base;
+    if (src->size >= sizeof(SegmentHeader) && header->magic == SEGMENT_MAGIC) {
+        if (header->version != SEGMENT_VERSION) {
+            printf("Error: %s has segment version %u, expected %d\n", path, header->version, SEGMENT_VERSION);
+            replayClose(src);
+            return -1;
+        }
+        src->format = REPLAY_SEGMENT;
+        char idsPath[300];
+        snprintf(idsPath, sizeof(idsPath), "%s.ids", path);
+        src->segIds = mapFile(idsPath, &src->idsSize);
+        src->segIdCount = src->segIds ? (uint32_t)(src->idsSize / 10) : 0;
+    } else {
+        src->format = REPLAY_TEXT;
+    }
+
+    // Scan once for counts and order; sort an index only if the file is out of order
+    ReplayCursor c = {src->format == REPLAY_SEGMENT ? sizeof(SegmentHeader) : 0, 0, 0, 0, 0, 0};
+    ReplaySnapshot s;
+    int sorted = 1;
+    int64_t prev = INT64_MIN;
+    src->firstTime = INT64_MAX;
+    src->lastTime = INT64_MIN;
+    while (readAt(src, &c, &s)) {
+        if (s.time < prev) sorted = 0;
+        prev = s.time;
+        if (s.time < src->firstTime) src->firstTime = s.time;
+        if (s.time > src->lastTime) src->lastTime = s.time;
+        src->snapshots++;
+        src->samples += s.count;
+    }
+    src->malformed = c.malformed;
+
+    if (!sorted) {
+        src->index = malloc(sizeof(ReplayIndexEntry) * src->snapshots);
+        if (!src->index) {
+            printf("Error: Cannot allocate replay index for %zu records\n", src->snapshots);
+            replayClose(src);
+            return -1;
+        }
+        ReplayCursor scan = {src->format == REPLAY_SEGMENT ? sizeof(SegmentHeader) : 0, 0, 0, 0, 0, 0};
+        for (size_t i = 0; i < src->snapshots; i++) {
+            ReplayIndexEntry *e = &src->index[i];
+            // Skip leading blank lines so the entry points at the record itself
+            if (src->format == REPLAY_TEXT)
+                while (scan.pos < src->size && src->base[scan.pos] == '\n') scan.pos++;
+            e->pos = scan.pos;
+            e->row = scan.row;
+            readAt(src, &scan, &s);
+            e->time = s.time;
+        }
+        qsort(src->index, src->snapshots, sizeof(ReplayIndexEntry), compareIndex);
+    }
+    return 0;
+}
+
+void replayClose(ReplaySource *src) {
+    if (src->base) munmap((void *)src->base, src->size);
+    if (src->segIds) munmap((void *)src->segIds, src->idsSize);
+    free(src->index);
+    memset(src, 0, sizeof(*src));
+}
+
+// Next snapshot in timestamp order (file order when already sorted)
+int replayNext(const ReplaySource *src, ReplayCursor *c, ReplaySnapshot *s) {
+    if (!src->index) return readAt(src, c, s);
+    if (c->next == src->snapshots) return 0;
+    const ReplayIndexEntry *e = &src->index[c->next++];
+    c->pos = e->pos;
+    c->row = e->row;
+    return readAt(src, c, s);
+}
+
+// ---------------- Replay Fleet ----------------
+
+static uint32_t hashVehicleId(const char *id, int len) {
+    uint32_t h = 2166136261U;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)id[i];
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static int idEquals(const Vehicle *v, const char *id, int len) {
+    return (size_t)len == strnlen(v->id, sizeof(v->id)) && memcmp(v->id, id, (size_t)len) == 0;
+}
+
+static int fleetGrowHash(ReplayFleet *fleet) {
+    uint32_t capacity = fleet->hashCapacity ? fleet->hashCapacity * 2 : 1024;
+    uint32_t *hash = malloc(sizeof(uint32_t) * capacity);
+    if (!hash) return -1;
+    for (uint32_t i = 0; i < capacity; i++) hash[i] = VEHICLE_ID_NONE;
+    for (uint32_t v = 0; v < fleet->count; v++) {
+        const char *id = fleet->vehicles[v].id;
+        uint32_t slot = hashVehicleId(id, (int)strnlen(id, sizeof(fleet->vehicles[v].id))) & (capacity - 1);
+        while (hash[slot] != VEHICLE_ID_NONE) slot = (slot + 1) & (capacity - 1);
+        hash[slot] = v;
+    }
+    free(fleet->hash);
+    fleet->hash = hash;
+    fleet->hashCapacity = capacity;
+    return 0;
+}
+
+// IDs longer than Vehicle.id holds are truncated, as strcpy into it would overflow
+static Vehicle *fleetFindOrAdd(ReplayFleet *fleet, const char *id, int len) {
+    if (len > (int)sizeof(fleet->vehicles[0].id) - 1) len = sizeof(fleet->vehicles[0].id) - 1;
+    if ((fleet->count + 1) * 2 > fleet->hashCapacity && fleetGrowHash(fleet) != 0) return NULL;
+
+    uint32_t mask = fleet->hashCapacity - 1;
+    uint32_t slot = hashVehicleId(id, len) & mask;
+    while (fleet->hash[slot] != VEHICLE_ID_NONE) {
+        Vehicle *v = &fleet->vehicles[fleet->hash[slot]];
+        if (idEquals(v, id, len)) return v;
+        slot = (slot + 1) & mask;
+    }
+
+    if (fleet->count == fleet->capacity) {
+        uint32_t capacity = fleet->capacity ? fleet->capacity * 2 : 1024;
+        Vehicle *grown = realloc(fleet->vehicles, sizeof(Vehicle) * capacity);
+        if (!grown) return NULL;
+        fleet->vehicles = grown;
+        fleet->capacity = capacity;
+    }
+    Vehicle *v = &fleet->vehicles[fleet->count];
+    memset(v, 0, sizeof(*v));
+    memcpy(v->id, id, (size_t)len);
+    v->status = 1;
+    fleet->hash[slot] = fleet->count++;
+    return v;
+}
+
+void fleetFree(ReplayFleet *fleet) {
+    free(fleet->vehicles);
+    free(fleet->hash);
+    free(fleet->segMap);
+    memset(fleet, 0, sizeof(*fleet));
+}
+
+// ---------------- Replay Loop ----------------
+
+static inline uint64_t mixSample(uint64_t h, const char *id, int idLen, const SensorData *d) {
+    uint64_t x = hashVehicleId(id, idLen) ^ (uint64_t)d->type << 32 ^ (uint64_t)d->value << 40 ^ (uint64_t)d->is_faulty << 60;
+    return (h ^ x) * 0x100000001b3ULL;
+}
+
+// Feed every snapshot into the fleet in timestamp order and run the pipeline on
+// the vehicle. speed > 0 paces by the recorded timestamps (1 = wall clock).
+int replayRun(const ReplaySource *src, ReplayFleet *fleet, double speed, ReplayProcessor process, ReplayStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (src->format == REPLAY_SEGMENT && !fleet->segMap && src->segIdCount) {
+        fleet->segMap = malloc(sizeof(uint32_t) * src->segIdCount);
+        if (!fleet->segMap) {
+            printf("Error: Cannot allocate segment vehicle map\n");
+            return -1;
+        }
+        for (uint32_t i = 0; i < src->segIdCount; i++) fleet->segMap[i] = VEHICLE_ID_NONE;
+    }
+
+    ReplayCursor c = {src->format == REPLAY_SEGMENT ? sizeof(SegmentHeader) : 0, 0, 0, 0, 0, 0};
+    ReplaySnapshot s;
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int64_t pacedTime = INT64_MIN;
+    uint64_t tickHash = 0;
+
+    while (replayNext(src, &c, &s)) {
+        if (s.time != pacedTime) {
+            // Order-sensitive checksum: chain within a timestamp, then fold per timestamp
+            stats->checksum = stats->checksum * 0x9E3779B97F4A7C15ULL + tickHash;
+            tickHash = 0;
+            pacedTime = s.time;
+            if (speed > 0) {
+                double offset = (s.time - src->firstTime) / speed;
+                struct timespec due = start;
+                due.tv_sec += (time_t)offset;
+                due.tv_nsec += (long)((offset - (time_t)offset) * 1e9);
+                if (due.tv_nsec >= 1000000000L) {
+                    due.tv_sec++;
+                    due.tv_nsec -= 1000000000L;
+                }
+                clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL);
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                double lag = elapsedMs(due, now);
+                if (lag > stats->maxLagMs) stats->maxLagMs = lag;
+            }
+        }
+
+        Vehicle *v;
+        if (s.segVehicle != VEHICLE_ID_NONE && s.segVehicle < src->segIdCount) {
+            uint32_t *slot = &fleet->segMap[s.segVehicle];
+            if (*slot == VEHICLE_ID_NONE) {
+                v = fleetFindOrAdd(fleet, s.id, s.idLen);
+                if (v) *slot = (uint32_t)(v - fleet->vehicles);
+            } else {
+                v = &fleet->vehicles[*slot];
+            }
+        } else {
+            v = fleetFindOrAdd(fleet, s.id, s.idLen);
+        }
+        if (!v) {
+            printf("Error: Cannot grow replay fleet\n");
+            return -1;
+        }
+
+        memcpy(v->sensors, s.sensors, sizeof(SensorData) * s.count);
+        v->sensor_count = s.count;
+        for (int i = 0; i < s.count; i++) tickHash = mixSample(tickHash, s.id, s.idLen, &s.sensors[i]);
+        if (process) stats->faultFlagChanges += process(v);
+
+        stats->snapshots++;
+        stats->samples += s.count;
+    }
+    stats->checksum = stats->checksum * 0x9E3779B97F4A7C15ULL + tickHash;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    stats->elapsedMs = elapsedMs(start, now);
+    return 0;
+}
+
+// ---------------- Pipeline (11) ----------------
+
+// processFleet's per-vehicle work minus the simulated input and the re-logging:
+// the replayed readings go through fault checks, handlers and CAN as live ones do
+int processReplayedVehicle(Vehicle *vehicle) {
+    int changed = 0;
+    printf("\nVehicle ID: %s\n", vehicle->id);
+    for (int j = 0; j < vehicle->sensor_count; j++) {
+        SensorData *sensor = &vehicle->sensors[j];
+        uint8_t recorded = sensor->is_faulty;
+        checkSensorFault(sensor);
+        changed += sensor->is_faulty != recorded;
+        sensorHandlers[sensor->type](sensor);
+        sendToCANBus(sensor);
+    }
+    return changed;
+}
+
+// Assign Random Sensors Dynamically
+void assignRandomSensors(Vehicle *vehicle) {
+    int num_sensors = (rand() % MAX_SENSORS) + 1; // 1 to MAX_SENSORS
+    vehicle->sensor_count = num_sensors;
+
+    for (int i = 0; i < num_sensors; i++) {
+        vehicle->sensors[i].type = (SensorType)(rand() % MAX_SENSORS); // Random sensor type
+        vehicle->sensors[i].value = (rand() % 50) + 10; // Random sensor values between 10-59
+        vehicle->sensors[i].is_faulty = 0; // No faults initially
+    }
+}
+
+// Update Sensor Data in Real Time
+void updateSensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        int change = (rand() % 5) - 2; // Random fluctuation between -2 and +2
+        vehicle->sensors[i].value += change;
+        checkSensorFault(&vehicle->sensors[i]); // Check for faults
+    }
+}
+
+// Check if Sensor is Faulty
+void checkSensorFault(SensorData *sensor) {
+    switch (sensor->type) {
+        case TEMPERATURE_SENSOR:
+            sensor->is_faulty = (sensor->value > 90) ? 1 : 0;
+            break;
+        case SPEED_SENSOR:
+            sensor->is_faulty = (sensor->value > 180) ? 1 : 0;
+            break;
+        case FUEL_SENSOR:
+            sensor->is_faulty = (sensor->value < 10) ? 1 : 0;
+            break;
+        case BRAKE_PRESSURE_SENSOR:
+            sensor->is_faulty = (sensor->value < 20) ? 1 : 0;
+            break;
+        case BATTERY_VOLTAGE_SENSOR:
+            sensor->is_faulty = (sensor->value < 11) ? 1 : 0;
+            break;
+    }
+}
+
+// Process Temperature Sensor
+void processTemperature(SensorData *sensor) {
+    printf("Temperature: %d°C %s\n", sensor->value, sensor->is_faulty ? "[FAULTY]" : "");
+}
+
+// Process Speed Sensor
+void processSpeed(SensorData *sensor) {
+    printf("Speed: %d km/h %s\n", sensor->value, sensor->is_faulty ? "[FAULTY]" : "");
+}
+
+// Process Fuel Sensor
+void processFuel(SensorData *sensor) {
+    printf("Fuel Level: %d%% %s\n", sensor->value, sensor->is_faulty ? "[FAULTY]" : "");
+}
+
+// Process Brake Pressure Sensor
+void processBrakePressure(SensorData *sensor) {
+    printf("Brake Pressure: %d bar %s\n", sensor->value, sensor->is_faulty ? "[FAULTY]" : "");
+}
+
+// Process Battery Voltage Sensor
+void processBatteryVoltage(SensorData *sensor) {
+    printf("Battery Voltage: %dV %s\n", sensor->value, sensor->is_faulty ? "[FAULTY]" : "");
+}
+
+// Simulated CAN Bus Transmission
+void sendToCANBus(SensorData *sensor) {
+    printf("Sending Sensor Type %d with Value %d to CAN Bus...\n", sensor->type, sensor->value);
+}
+
+// ---------------- Reporting ----------------
+
+static int savedStdout = -1;
+
+// Pipeline output goes to /dev/null in quiet mode and while benchmarking
+static void parkStdout(void) {
+    fflush(stdout);
+    savedStdout = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    if (devNull >= 0) {
+        dup2(devNull, STDOUT_FILENO);
+        close(devNull);
+    }
+}
+
+static void restoreStdout(void) {
+    if (savedStdout < 0) return;
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+    savedStdout = -1;
+}
+
+static void printReplayStats(const char *label, const ReplayFleet *fleet, const ReplayStats *st) {
+    printf("%-26s %9llu samples %8llu records %7u vehicles %8.1f ms  %7.2f M samples/s",
+           label, (unsigned long long)st->samples, (unsigned long long)st->snapshots, fleet->count, st->elapsedMs,
+           st->samples / st->elapsedMs / 1e3);
+    if (st->maxLagMs > 0) printf("  max lag %.1f ms", st->maxLagMs);
+    if (st->faultFlagChanges) printf("  %llu fault flags differ", (unsigned long long)st->faultFlagChanges);
+    printf("\n");
+}
+
+static int replayFile(const char *path, double speed, int quiet) {
+    ReplaySource src;
+    if (replayOpen(&src, path) != 0) return -1;
+    printf("Replaying %s (%s, %.1f MB, %zu records, %llu samples, %zu malformed lines, %s order, %lld s recorded)\n",
+           path, src.format == REPLAY_TEXT ? "text log" : "segment", src.size / 1048576.0, src.snapshots,
+           (unsigned long long)src.samples, src.malformed, src.index ? "sorted into timestamp" : "file",
+           src.snapshots ? (long long)(src.lastTime - src.firstTime) : 0LL);
+
+    ReplayFleet fleet = {0};
+    ReplayStats stats;
+    if (quiet) parkStdout();
+    int rc = replayRun(&src, &fleet, speed, processReplayedVehicle, &stats);
+    if (quiet) restoreStdout();
+    if (rc == 0) printReplayStats(speed > 0 ? "Paced replay:" : "Unthrottled replay:", &fleet, &stats);
+    fleetFree(&fleet);
+    replayClose(&src);
+    return rc;
+}
+
+// ---------------- Self Test ----------------
+
+// Minimal writer for 23's segment layout
+typedef struct {
+    FILE *file;
+    BlockHeader header;
+    int64_t timestamp[BLOCK_ROWS];
+    uint32_t vehicle[BLOCK_ROWS];
+    uint16_t value[BLOCK_ROWS];
+    uint8_t sensorType[BLOCK_ROWS];
+    uint8_t faulty[BLOCK_ROWS];
+} SegmentBuilder;
+
+static void builderFlush(SegmentBuilder *b) {
+    uint32_t rows = b->header.rows;
+    if (!rows) return;
+    fwrite(&b->header, sizeof(b->header), 1, b->file);
+    fwrite(b->timestamp, sizeof(int64_t), rows, b->file);
+    fwrite(b->vehicle, sizeof(uint32_t), rows, b->file);
+    fwrite(b->value, sizeof(uint16_t), rows, b->file);
+    fwrite(b->sensorType, 1, rows, b->file);
+    fwrite(b->faulty, 1, rows, b->file);
+    memset(&b->header, 0, sizeof(b->header));
+    b->header.minTime = INT64_MAX;
+    b->header.maxTime = INT64_MIN;
+    b->header.minVehicle = UINT32_MAX;
+    b->header.minValue = UINT16_MAX;
+}
+
+static void builderAppend(SegmentBuilder *b, int64_t t, uint32_t vehicle, const SensorData *d) {
+    BlockHeader *h = &b->header;
+    uint32_t row = h->rows;
+    b->timestamp[row] = t;
+    b->vehicle[row] = vehicle;
+    b->value[row] = d->value;
+    b->sensorType[row] = (uint8_t)d->type;
+    b->faulty[row] = d->is_faulty;
+    if (t < h->minTime) h->minTime = t;
+    if (t > h->maxTime) h->maxTime = t;
+    if (vehicle < h->minVehicle) h->minVehicle = vehicle;
+    if (vehicle > h->maxVehicle) h->maxVehicle = vehicle;
+    if (d->value < h->minValue) h->minValue = d->value;
+    if (d->value > h->maxValue) h->maxValue = d->value;
+    h->typeMask |= (uint8_t)(1u << d->type);
+    h->faultyCount += d->is_faulty;
+    if (++h->rows == BLOCK_ROWS) builderFlush(b);
+}
+
+// Write the same fleet history as a text log (11's exact format) and as a segment.
+// One tick is written late, as a second process flushing after the others would,
+// so both replays have to restore timestamp order. Returns the expected checksum.
+static uint64_t generateLogs(const char *textPath, const char *segPath, int vehicles, int ticks, int64_t start) {
+    FILE *text = fopen(textPath, "w");
+    static SegmentBuilder seg;
+    seg.file = fopen(segPath, "wb");
+    Vehicle *fleet = malloc(sizeof(Vehicle) * vehicles);
+    Vehicle *late = malloc(sizeof(Vehicle) * vehicles);
+    uint64_t *tickHash = calloc(ticks, sizeof(uint64_t));
+    if (!text || !seg.file || !fleet || !late || !tickHash) {
+        printf("Error: Cannot create replay test files\n");
+        if (text) fclose(text);
+        if (seg.file) fclose(seg.file);
+        free(fleet); free(late); free(tickHash);
+        return 0;
+    }
+    SegmentHeader header = {SEGMENT_MAGIC, SEGMENT_VERSION, BLOCK_ROWS, 0};
+    fwrite(&header, sizeof(header), 1, seg.file);
+    builderFlush(&seg);
+
+    for (int i = 0; i < vehicles; i++) {
+        snprintf(fleet[i].id, sizeof(fleet[i].id), "VH%u", (100U + (unsigned)i) % 10000000U);
+        assignRandomSensors(&fleet[i]);
+    }
+
+    int lateTick = ticks > 3 ? ticks / 2 : -1;
+    for (int tick = 0; tick <= ticks; tick++) {
+        // The late tick's data is captured on time but written one tick later
+        int writeTick = tick;
+        Vehicle *source = fleet;
+        if (tick == lateTick + 2 && lateTick >= 0) {
+            writeTick = lateTick;
+            source = late;
+            tick--;
+            lateTick = -1;
+        } else if (tick == ticks) {
+            break;
+        } else {
+            for (int i = 0; i < vehicles; i++) updateSensorData(&fleet[i]);
+            for (int i = 0; i < vehicles; i++)
+                for (int j = 0; j < fleet[i].sensor_count; j++)
+                    tickHash[tick] = mixSample(tickHash[tick], fleet[i].id, (int)strlen(fleet[i].id), &fleet[i].sensors[j]);
+            if (tick == lateTick) {
+                memcpy(late, fleet, sizeof(Vehicle) * vehicles);
+                continue;
+            }
+        }
+
+        time_t now = (time_t)(start + writeTick);
+        char stamp[32];
+        strcpy(stamp, ctime(&now));
+        for (int i = 0; i < vehicles; i++) {
+            Vehicle *v = &source[i];
+            fprintf(text, "\n[%s] Vehicle ID: %s\n", stamp, v->id);
+            for (int j = 0; j < v->sensor_count; j++) {
+                fprintf(text, "Sensor Type: %d, Value: %d %s\n", v->sensors[j].type, v->sensors[j].value,
+                        v->sensors[j].is_faulty ? "[FAULTY]" : "");
+                builderAppend(&seg, now, (uint32_t)i, &v->sensors[j]);
+            }
+        }
+    }
+    builderFlush(&seg);
+    fclose(text);
+    fclose(seg.file);
+
+    char idsPath[300];
+    snprintf(idsPath, sizeof(idsPath), "%s.ids", segPath);
+    FILE *ids = fopen(idsPath, "wb");
+    if (ids) {
+        for (int i = 0; i < vehicles; i++) fwrite(fleet[i].id, 10, 1, ids);
+        fclose(ids);
+    }
+
+    uint64_t expected = 0;
+    for (int t = 0; t < ticks; t++) expected = expected * 0x9E3779B97F4A7C15ULL + tickHash[t];
+    free(fleet);
+    free(late);
+    free(tickHash);
+    return expected;
+}
+
+// The usual way to read the log back: fgets + sscanf + mktime per line
+static uint64_t stdioReplay(const char *path, double *ms) {
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    FILE *f = fopen(path, "r");
+    if (!f) return 0;
+    char line[128], wday[4], mon[4];
+    uint64_t samples = 0;
+    Vehicle v;
+    memset(&v, 0, sizeof(v));
+    while (fgets(line, sizeof(line), f)) {
+        int type, value, day, h, m, s, year;
+        if (line[0] == '[' && sscanf(line, "[%3s %3s %d %d:%d:%d %d", wday, mon, &day, &h, &m, &s, &year) == 7) {
+            struct tm tm = {0};
+            static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+            tm.tm_mon = (int)((strstr(months, mon) - months) / 3);
+            tm.tm_mday = day; tm.tm_hour = h; tm.tm_min = m; tm.tm_sec = s; tm.tm_year = year - 1900; tm.tm_isdst = -1;
+            mktime(&tm);
+            v.sensor_count = 0;
+        } else if (sscanf(line, "] Vehicle ID: %9s", v.id) == 1) {
+            v.sensor_count = 0;
+        } else if (sscanf(line, "Sensor Type: %d, Value: %d", &type, &value) == 2 && v.sensor_count < MAX_SENSORS) {
+            v.sensors[v.sensor_count].type = (SensorType)type;
+            v.sensors[v.sensor_count].value = (uint16_t)value;
+            v.sensors[v.sensor_count].is_faulty = strstr(line, "[FAULTY]") != NULL;
+            v.sensor_count++;
+            samples++;
+        }
+    }
+    fclose(f);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    *ms = elapsedMs(t0, t1);
+    return samples;
+}
+
+static int selfTest(void) {
+    const char *textPath = "sensor_log_replay_bench.txt";
+    const char *segPath = "sensor_log_replay_bench.seg";
+    char idsPath[300];
+    snprintf(idsPath, sizeof(idsPath), "%s.ids", segPath);
+    int vehicles = 20000, ticks = 60;
+    int64_t start = (int64_t)time(NULL) - ticks;
+
+    printf("---- Replay Self Test: %d vehicles x %d ticks, one tick written late ----\n", vehicles, ticks);
+    uint64_t expected = generateLogs(textPath, segPath, vehicles, ticks, start);
+    int failures = 0;
+
+    const char *paths[] = {textPath, segPath};
+    for (int k = 0; k < 2; k++) {
+        ReplaySource src;
+        if (replayOpen(&src, paths[k]) != 0) return 1;
+        printf("%s: %.1f MB, %zu records, %zu malformed, %s\n", paths[k], src.size / 1048576.0, src.snapshots,
+               src.malformed, src.index ? "out of order -> index sorted" : "in order");
+
+        ReplayFleet fleet = {0};
+        ReplayStats parseOnly, full;
+        replayRun(&src, &fleet, 0, NULL, &parseOnly);
+        parkStdout();
+        replayRun(&src, &fleet, 0, processReplayedVehicle, &full);
+        restoreStdout();
+        printReplayStats("  parse + feed only:", &fleet, &parseOnly);
+        printReplayStats("  with 11's pipeline:", &fleet, &full);
+        if (parseOnly.checksum != expected || full.checksum != expected) {
+            printf("  Mismatch: replay checksum %016llx, expected %016llx\n", (unsigned long long)parseOnly.checksum,
+                   (unsigned long long)expected);
+            failures++;
+        } else {
+            printf("  timestamp-ordered checksum matches the recording\n");
+        }
+        fleetFree(&fleet);
+        replayClose(&src);
+    }
+
+    double stdioMs = 0;
+    uint64_t samples = stdioReplay(textPath, &stdioMs);
+    printf("fgets+sscanf reader (no ordering): %llu samples %8.1f ms  %7.2f M samples/s\n", (unsigned long long)samples,
+           stdioMs, samples / stdioMs / 1e3);
+
+    // Wall clock: 3 recorded seconds should take 3 real seconds
+    generateLogs(textPath, segPath, 2, 4, start);
+    printf("\n---- Wall-Clock Replay (2 vehicles, 4 ticks 1 s apart) ----\n");
+    ReplaySource src;
+    if (replayOpen(&src, textPath) == 0) {
+        ReplayFleet fleet = {0};
+        ReplayStats paced;
+        replayRun(&src, &fleet, 1.0, processReplayedVehicle, &paced);
+        printReplayStats("Paced replay:", &fleet, &paced);
+        fleetFree(&fleet);
+        replayClose(&src);
+    }
+
+    unlink(textPath);
+    unlink(segPath);
+    unlink(idsPath);
+    return failures;
+}
+
+int main(int argc, char *argv[]) {
+    double speed = 0;
+    int quiet = 0;
+    const char *path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--speed") == 0 && i + 1 < argc) {
+            speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            quiet = 1;
+        } else if (argv[i][0] == '-') {
+            printf("Error: Unknown option %s\n", argv[i]);
+            return 1;
+        } else {
+            path = argv[i];
+        }
+    }
+    srand(time(0)); // Seed random values
+
+    if (path) return replayFile(path, speed, quiet) != 0;
+    return selfTest() != 0;
+}
@@ -0,0 +1,419 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Build: gcc -O2 "35 Specialized Sensor Dispatch by Type.c"
+// Usage: ./a.out [sensors]
+
+// The sensor type list, known at compile time. Every per-type function below is
+// generated from it, so adding a type is one line here and the compiler sees each
+// handler body at its call site.
+//   X(enum, Name, fault condition on `value`)
+// The condition must be a plain comparison: it is also evaluated on vectors.
+#define SENSOR_TYPES(X)                                   \
+    X(TEMPERATURE_SENSOR, Temperature, value > 90)        \
+    X(SPEED_SENSOR, Speed, value > 180)                   \
+    X(FUEL_SENSOR, Fuel, value < 10)                      \
+    X(BRAKE_PRESSURE_SENSOR, BrakePressure, value < 20)   \
+    X(BATTERY_VOLTAGE_SENSOR, BatteryVoltage, value < 11)
+
+#define COLUMN_BLOCK 4096       // Per-lane uint16_t fault counts cannot overflow in a block
+#define COLUMN_LANES 8
+
+// GCC vector extensions, 16 bytes so the baseline x86-64 build maps them onto SSE2
+typedef uint16_t U16xN __attribute__((vector_size(16)));
+typedef int16_t S16xN __attribute__((vector_size(16)));
+typedef uint32_t U32xN __attribute__((vector_size(16)));
+typedef uint8_t U8xN __attribute__((vector_size(8)));
+
+// Sensor Types
+typedef enum {
+#define X(ENUM, Name, fault) ENUM,
+    SENSOR_TYPES(X)
+#undef X
+    SENSOR_TYPE_COUNT
+} SensorType;
+
+static const char *sensorTypeNames[SENSOR_TYPE_COUNT] = {
+#define X(ENUM, Name, fault) #Name,
+    SENSOR_TYPES(X)
+#undef X
+};
+
+// Sensor Data Structure
+typedef struct {
+    SensorType type;
+    uint16_t value;
+    uint8_t is_faulty; // 0 = Normal, 1 = Faulty
+} SensorData;
+
+// What the analysis pass produces per sensor type
+typedef struct {
+    uint64_t sensors;
+    uint64_t faulty;
+    uint64_t valueSum;
+    uint16_t maxValue;
+} TypeStats;
+
+// Runtime handler API (10/11 style); kept for plugins and as the reference path
+typedef void (*SensorProcessor)(SensorData *, TypeStats *);
+
+// Sensors grouped by type: indices into the mixed array, one contiguous range per type
+typedef struct {
+    uint32_t *index;
+    uint32_t start[SENSOR_TYPE_COUNT + 1];
+} SensorGroups;
+
+// Same grouping with the values copied out: columns the per-type loops can vectorize
+typedef struct {
+    uint16_t *values;
+    uint8_t *faulty;
+    uint32_t *owner;            // Position in the mixed array
+    uint32_t start[SENSOR_TYPE_COUNT + 1];
+} SensorColumns;
+
+// Function Prototypes
+int registerSensorPlugin(SensorType type, SensorProcessor processor);
+void analyzeByPointer(SensorData *sensors, uint32_t count, TypeStats *stats);
+void analyzeBySwitch(SensorData *sensors, uint32_t count, TypeStats *stats);
+int groupSensors(const SensorData *sensors, uint32_t count, SensorGroups *groups);
+void analyzeGrouped(SensorData *sensors, const SensorGroups *groups, TypeStats *stats);
+int buildColumns(const SensorData *sensors, uint32_t count, SensorColumns *columns);
+void analyzeColumns(SensorColumns *columns, TypeStats *stats);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+static inline void accumulate(TypeStats *stats, uint16_t value, uint8_t faulty) {
+    stats->sensors++;
+    stats->faulty += faulty;
+    stats->valueSum += value;
+    if (value > stats->maxValue) stats->maxValue = value;
+}
+
+// ---------------- Generated Per-Type Code ----------------
+
+// Fault rule, the runtime handler, and two specialized loops per type
+#define X(ENUM, Name, fault)                                                              \
+    static inline uint8_t isFaulty##Name(uint16_t value) {                                \
+        return (fault);                                                                   \
+    }                                                                                     \
+                                                                                          \
+    void process##Name(SensorData *sensor, TypeStats *stats) {                            \
+        sensor->is_faulty = isFaulty##Name(sensor->value);                                \
+        accumulate(stats, sensor->value, sensor->is_faulty);                              \
+    }                                                                                     \
+                                                                                          \
+    /* In place through the group's index list: no indirect call, no type test */         \
+    static void runIndexed##Name(SensorData *sensors, const uint32_t *index, uint32_t n, \
+                                 TypeStats *stats) {                                      \
+        for (uint32_t i = 0; i < n; i++) {                                                \
+            SensorData *s = &sensors[index[i]];                                           \
+            s->is_faulty = isFaulty##Name(s->value);                                      \
+            accumulate(stats, s->value, s->is_faulty);                                    \
+        }                                                                                 \
+    }                                                                                     \
+                                                                                          \
+    /* Over a type's column, 8 sensors per step: the same fault condition applied to */ \
+    /* a vector `value` yields a lane mask, so the loop has no branches at all */         \
+    static void runColumn##Name(const uint16_t *values, uint8_t *faulty, uint32_t n,     \
+                                TypeStats *stats) {                                       \
+        uint32_t i = 0;                                                                   \
+        U16xN vmax = {0};                                                                \
+        while (n - i >= COLUMN_LANES) {                                                   \
+            uint32_t end = i + (n - i < COLUMN_BLOCK ? (n - i) / COLUMN_LANES * COLUMN_LANES \
+                                                     : COLUMN_BLOCK);                     \
+            U16xN vfaults = {0};                                                         \
+            U32xN vsum = {0};                                                             \
+            for (; i < end; i += COLUMN_LANES) {                                          \
+                U16xN value;                                                             \
+                memcpy(&value, values + i, sizeof(value));                                \
+                S16xN mask = (fault);                                                    \
+                U8xN flags = __builtin_convertvector(-mask, U8xN);                      \
+                memcpy(faulty + i, &flags, sizeof(flags));                                \
+                vfaults -= (U16xN)mask;                                                  \
+                U32xN pairs = (U32xN)value;                                               \
+                vsum += (pairs & 0xFFFF) + (pairs >> 16);                                 \
+                S16xN greater = value > vmax;                                            \
+                vmax = (vmax & ~(U16xN)greater) | (value & (U16xN)greater);             \
+            }                                                                             \
+            for (int k = 0; k < COLUMN_LANES; k++) stats->faulty += vfaults[k];           \
+            for (int k = 0; k < COLUMN_LANES / 2; k++) stats->valueSum += vsum[k];        \
+        }                                                                                 \
+        stats->sensors += i;                                                              \
+        for (int k = 0; k < COLUMN_LANES; k++)                                            \
+            if (vmax[k] > stats->maxValue) stats->maxValue = vmax[k];                     \
+        for (; i < n; i++) {                                                              \
+            faulty[i] = isFaulty##Name(values[i]);                                        \
+            accumulate(stats, values[i], faulty[i]);                                      \
+        }                                                                                 \
+    }
+SENSOR_TYPES(X)
+#undef X
+
+// Compiled-in handlers, and the runtime table callers dispatch through
+static const SensorProcessor builtinHandlers[SENSOR_TYPE_COUNT] = {
+#define X(ENUM, Name, fault) process##Name,
+    SENSOR_TYPES(X)
+#undef X
+};
+
+// Function Pointer Array for Sensor Processing
+static SensorProcessor sensorHandlers[SENSOR_TYPE_COUNT] = {
+#define X(ENUM, Name, fault) process##Name,
+    SENSOR_TYPES(X)
+#undef X
+};
+
+// Types a plugin has taken over (NULL restores the built-in); those run through the
+// pointer even on the grouped paths
+static SensorProcessor plugins[SENSOR_TYPE_COUNT];
+
+int registerSensorPlugin(SensorType type, SensorProcessor processor) {
+    if ((unsigned)type >= SENSOR_TYPE_COUNT) {
+        printf("Error: No sensor type %d for plugin\n", (int)type);
+        return -1;
+    }
+    plugins[type] = processor;
+    sensorHandlers[type] = processor ? processor : builtinHandlers[type];
+    return 0;
+}
+
+// ---------------- Dispatch Styles ----------------
+
+// Today's style: one indirect call per sensor
+void analyzeByPointer(SensorData *sensors, uint32_t count, TypeStats *stats) {
+    for (uint32_t i = 0; i < count; i++) {
+        sensorHandlers[sensors[i].type](&sensors[i], &stats[sensors[i].type]);
+    }
+}
+
+// Inlined, but still a data-dependent branch per sensor on a mixed fleet
+void analyzeBySwitch(SensorData *sensors, uint32_t count, TypeStats *stats) {
+    for (uint32_t i = 0; i < count; i++) {
+        SensorData *s = &sensors[i];
+        switch (s->type) {
+#define X(ENUM, Name, fault)                                   \
+        case ENUM:                                             \
+            if (plugins[ENUM]) {                               \
+                plugins[ENUM](s, &stats[ENUM]);                \
+            } else {                                           \
+                s->is_faulty = isFaulty##Name(s->value);       \
+                accumulate(&stats[ENUM], s->value, s->is_faulty); \
+            }                                                  \
+            break;
+            SENSOR_TYPES(X)
+#undef X
+        default:
+            break;
+        }
+    }
+}
+
+// Counting sort by type; only needs redoing when sensors are added or retyped
+int groupSensors(const SensorData *sensors, uint32_t count, SensorGroups *groups) {
+    groups->index = malloc(sizeof(uint32_t) * (count ? count : 1));
+    if (!groups->index) {
+        printf("Error: Cannot allocate sensor groups for %u sensors\n", count);
+        return -1;
+    }
+    uint32_t fill[SENSOR_TYPE_COUNT] = {0};
+    for (uint32_t i = 0; i < count; i++) fill[sensors[i].type]++;
+    groups->start[0] = 0;
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        groups->start[t + 1] = groups->start[t] + fill[t];
+        fill[t] = groups->start[t];
+    }
+    for (uint32_t i = 0; i < count; i++) groups->index[fill[sensors[i].type]++] = i;
+    return 0;
+}
+
+void analyzeGrouped(SensorData *sensors, const SensorGroups *groups, TypeStats *stats) {
+#define X(ENUM, Name, fault)                                                                        \
+    {                                                                                               \
+        const uint32_t *index = groups->index + groups->start[ENUM];                                \
+        uint32_t n = groups->start[ENUM + 1] - groups->start[ENUM];                                 \
+        if (plugins[ENUM]) {                                                                        \
+            for (uint32_t i = 0; i < n; i++) plugins[ENUM](&sensors[index[i]], &stats[ENUM]);       \
+        } else {                                                                                    \
+            runIndexed##Name(sensors, index, n, &stats[ENUM]);                                      \
+        }                                                                                           \
+    }
+    SENSOR_TYPES(X)
+#undef X
+}
+
+int buildColumns(const SensorData *sensors, uint32_t count, SensorColumns *columns) {
+    SensorGroups groups;
+    if (groupSensors(sensors, count, &groups) != 0) return -1;
+    size_t n = count ? count : 1;
+    columns->values = malloc(sizeof(uint16_t) * n);
+    columns->faulty = malloc(n);
+    columns->owner = groups.index;
+    if (!columns->values || !columns->faulty) {
+        printf("Error: Cannot allocate sensor columns for %u sensors\n", count);
+        free(columns->values);
+        free(columns->faulty);
+        free(groups.index);
+        return -1;
+    }
+    memcpy(columns->start, groups.start, sizeof(groups.start));
+    for (uint32_t i = 0; i < count; i++) {
+        columns->values[i] = sensors[columns->owner[i]].value;
+        columns->faulty[i] = sensors[columns->owner[i]].is_faulty;
+    }
+    return 0;
+}
+
+void analyzeColumns(SensorColumns *columns, TypeStats *stats) {
+#define X(ENUM, Name, fault)                                                                        \
+    {                                                                                               \
+        uint32_t first = columns->start[ENUM], n = columns->start[ENUM + 1] - first;                \
+        if (plugins[ENUM]) {                                                                        \
+            for (uint32_t i = 0; i < n; i++) {                                                      \
+                SensorData s = {ENUM, columns->values[first + i], columns->faulty[first + i]};      \
+                plugins[ENUM](&s, &stats[ENUM]);                                                    \
+                columns->faulty[first + i] = s.is_faulty;                                           \
+            }                                                                                       \
+        } else {                                                                                    \
+            runColumn##Name(columns->values + first, columns->faulty + first, n, &stats[ENUM]);     \
+        }                                                                                           \
+    }
+    SENSOR_TYPES(X)
+#undef X
+}
+
+// ---------------- Benchmark ----------------
+
+// Example plugin: a stricter temperature rule loaded at runtime
+static void strictTemperaturePlugin(SensorData *sensor, TypeStats *stats) {
+    sensor->is_faulty = sensor->value > 85;
+    accumulate(stats, sensor->value, sensor->is_faulty);
+}
+
+static int sameStats(const TypeStats *a, const TypeStats *b) {
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        if (a[t].sensors != b[t].sensors || a[t].faulty != b[t].faulty || a[t].valueSum != b[t].valueSum ||
+            a[t].maxValue != b[t].maxValue)
+            return 0;
+    }
+    return 1;
+}
+
+typedef enum {
+    STYLE_POINTER,
+    STYLE_SWITCH,
+    STYLE_GROUPED,
+    STYLE_COLUMNS
+} DispatchStyle;
+
+static void runStyle(DispatchStyle style, SensorData *sensors, uint32_t count, const SensorGroups *groups,
+                     SensorColumns *columns, TypeStats *stats) {
+    memset(stats, 0, sizeof(TypeStats) * SENSOR_TYPE_COUNT);
+    switch (style) {
+        case STYLE_POINTER: analyzeByPointer(sensors, count, stats); break;
+        case STYLE_SWITCH: analyzeBySwitch(sensors, count, stats); break;
+        case STYLE_GROUPED: analyzeGrouped(sensors, groups, stats); break;
+        case STYLE_COLUMNS: analyzeColumns(columns, stats); break;
+    }
+}
+
+// Best of several passes, ns per sensor
+static double timeStyle(DispatchStyle style, SensorData *sensors, uint32_t count, const SensorGroups *groups,
+                        SensorColumns *columns, TypeStats *stats) {
+    double best = 1e30;
+    for (int round = 0; round < 7; round++) {
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        runStyle(style, sensors, count, groups, columns, stats);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double ns = elapsedMs(t0, t1) * 1e6 / count;
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+static int checkFlags(const SensorData *sensors, uint32_t count, const SensorColumns *columns) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (columns->faulty[i] != sensors[columns->owner[i]].is_faulty) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    uint32_t count = argc > 1 ? (uint32_t)atol(argv[1]) : 1000000;
+    if (count == 0) {
+        printf("Error: Need at least one sensor\n");
+        return 1;
+    }
+    srand(time(0)); // Seed random values
+
+    // Mixed fleet: random type per slot as assignRandomSensors (11) does; values spread
+    // across every threshold so the fault outcome is data dependent too
+    SensorData *sensors = malloc(sizeof(SensorData) * count);
+    if (!sensors) {
+        printf("Error: Cannot allocate %u sensors\n", count);
+        return 1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        sensors[i].type = (SensorType)(rand() % SENSOR_TYPE_COUNT);
+        sensors[i].value = rand() % 200;
+        sensors[i].is_faulty = 0;
+    }
+
+    struct timespec t0, t1;
+    SensorGroups groups;
+    SensorColumns columns;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (groupSensors(sensors, count, &groups) != 0) return 1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double groupNs = elapsedMs(t0, t1) * 1e6 / count;
+    if (buildColumns(sensors, count, &columns) != 0) return 1;
+
+    static const char *styleNames[] = {
+        "function pointer per sensor",
+        "inlined switch per sensor",
+        "grouped by type, in place",
+        "grouped by type, columns",
+    };
+    TypeStats reference[SENSOR_TYPE_COUNT], stats[SENSOR_TYPE_COUNT];
+
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) registerSensorPlugin(TEMPERATURE_SENSOR, strictTemperaturePlugin);
+        printf("\n---- %u mixed sensors, %s ----\n", count,
+               pass ? "temperature handled by a runtime plugin" : "compile-time handlers only");
+
+        runStyle(STYLE_POINTER, sensors, count, &groups, &columns, reference);
+        int ok = 1;
+        for (int style = STYLE_SWITCH; style <= STYLE_COLUMNS; style++) {
+            runStyle(style, sensors, count, &groups, &columns, stats);
+            if (!sameStats(reference, stats)) ok = 0;
+        }
+        if (!checkFlags(sensors, count, &columns)) ok = 0;
+        printf("All dispatch styles agree on stats and fault flags: %s\n", ok ? "yes" : "NO");
+
+        double pointerNs = 0;
+        for (int style = STYLE_POINTER; style <= STYLE_COLUMNS; style++) {
+            double ns = timeStyle(style, sensors, count, &groups, &columns, stats);
+            if (style == STYLE_POINTER) pointerNs = ns;
+            printf("%-28s: %6.2f ns/sensor (%5.1fx)\n", styleNames[style], ns, pointerNs / ns);
+        }
+        if (!ok) return 1;
+    }
+
+    printf("\nGrouping by type (once per topology change): %.2f ns/sensor\n", groupNs);
+    for (int t = 0; t < SENSOR_TYPE_COUNT; t++) {
+        printf("%-15s %8llu sensors %8llu faulty  max %u\n", sensorTypeNames[t], (unsigned long long)stats[t].sensors,
+               (unsigned long long)stats[t].faulty, stats[t].maxValue);
+    }
+
+    free(columns.values);
+    free(columns.faulty);
+    free(columns.owner);
+    free(groups.index);
+    free(sensors);
+    return 0;
+}
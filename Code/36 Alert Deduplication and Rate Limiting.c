@@ -0,0 +1,480 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Build: gcc -O2 "36 Alert Deduplication and Rate Limiting.c"
+// Usage: ./a.out [vehicles] [ticks] [window seconds] [alerts per second]
+
+#define MAX_SENSORS 3
+#define MAX_VEHICLES 2
+
+// Sensor Types
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE
+} SensorType;
+
+// Sensor Structure
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    Sensor sensors[MAX_SENSORS];
+} Vehicle;
+
+// Status codes behind the status strings, so an alert key is three small integers
+typedef enum {
+    STATUS_NORMAL,
+    STATUS_OVERHEAT,
+    STATUS_LOW_PRESSURE,
+    STATUS_LOW_BATTERY
+} SensorStatus;
+
+static const char *statusText[] = {"Normal", "Overheat", "Low Pressure", "Low Battery"};
+
+// One (vehicle, sensor, status) being tracked; 24 bytes, vehicle == NULL is empty
+typedef struct {
+    const Vehicle *vehicle;
+    uint8_t sensor;
+    uint8_t status;
+    uint16_t pad;
+    uint32_t repeats;           // Occurrences suppressed since windowStart
+    uint32_t windowStart;       // Epoch seconds of the last line printed for this key
+    uint32_t lastSeen;
+} AlertEntry;
+
+typedef struct {
+    uint64_t raised;            // logAlert calls
+    uint64_t printed;           // Fresh alert lines
+    uint64_t summaries;         // "N occurrences since T" lines
+    uint64_t suppressed;        // Absorbed into a summary
+    uint64_t rateLimited;       // Had no token; counted into the key's next summary
+    uint64_t untracked;         // Table full: printed without deduplication
+    uint64_t probes;            // Slots inspected by lookups
+} AlertStats;
+
+// Dedup table plus a global token bucket in front of the output
+typedef struct {
+    AlertEntry *entries;
+    uint32_t capacity;          // Power of two
+    uint32_t used;
+    int shift;                  // 64 - log2(capacity)
+    uint32_t window;            // Suppression window, seconds
+    double tokens;
+    double rate;                // Tokens per second
+    double burst;
+    time_t refilled;
+    FILE *out;
+    AlertStats stats;
+} AlertEngine;
+
+// Function Prototypes
+int alertEngineInit(AlertEngine *e, uint32_t maxKeys, uint32_t windowSeconds, double ratePerSecond, double burst, FILE *out);
+void alertEngineFree(AlertEngine *e);
+void alertFlush(AlertEngine *e, time_t now);
+void initializeVehicle(Vehicle *vehicle, const char *id);
+void updateSensorData(Vehicle *vehicle);
+SensorStatus analyzeSensor(Sensor *sensor);
+void performDiagnostics(AlertEngine *e, Vehicle *vehicle, time_t now);
+void logAlert(AlertEngine *e, Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ctime() is only re-rendered when the second changes
+static const char *cachedCtime(time_t now) {
+    static time_t cachedSecond = -1;
+    static char cachedText[32];
+    if (now != cachedSecond) {
+        ctime_r(&now, cachedText);
+        cachedSecond = now;
+    }
+    return cachedText;
+}
+
+// ---------------- Alert Engine ----------------
+
+int alertEngineInit(AlertEngine *e, uint32_t maxKeys, uint32_t windowSeconds, double ratePerSecond, double burst, FILE *out) {
+    memset(e, 0, sizeof(*e));
+    uint32_t capacity = 64;
+    int bits = 6;
+    while (capacity < maxKeys * 2 && bits < 31) {   // Load factor <= 0.5 keeps probes short
+        capacity <<= 1;
+        bits++;
+    }
+    e->entries = calloc(capacity, sizeof(AlertEntry));
+    if (!e->entries) {
+        printf("Error: Cannot allocate alert table for %u keys\n", maxKeys);
+        return -1;
+    }
+    e->capacity = capacity;
+    e->shift = 64 - bits;
+    e->window = windowSeconds;
+    e->rate = ratePerSecond;
+    e->burst = burst;
+    e->tokens = burst;
+    e->refilled = -1;
+    e->out = out;
+    return 0;
+}
+
+void alertEngineFree(AlertEngine *e) {
+    free(e->entries);
+    memset(e, 0, sizeof(*e));
+}
+
+static inline uint32_t alertSlot(const AlertEngine *e, const Vehicle *vehicle, int sensor, int status) {
+    // Vehicles sit at a fixed stride, so mix every pointer bit before taking the top bits
+    uint64_t key = (uint64_t)(uintptr_t)vehicle * 32 + (uint64_t)(sensor * 4 + status);
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return (uint32_t)(key >> e->shift);
+}
+
+static int takeToken(AlertEngine *e, time_t now) {
+    if (e->rate <= 0) return 1;
+    if (now != e->refilled) {
+        if (e->refilled >= 0) e->tokens += (now - e->refilled) * e->rate;
+        if (e->tokens > e->burst) e->tokens = e->burst;
+        e->refilled = now;
+    }
+    if (e->tokens < 1) return 0;
+    e->tokens -= 1;
+    return 1;
+}
+
+static void printAlert(AlertEngine *e, const Vehicle *vehicle, int status, time_t now) {
+    fprintf(e->out, "ALERT: [%s] Vehicle %s - %s\n", cachedCtime(now), vehicle->id, statusText[status]);
+    e->stats.printed++;
+}
+
+// Closes an entry's window: prints its summary if anything was held back
+static void emitSummary(AlertEngine *e, AlertEntry *a, time_t now) {
+    if (!a->repeats) return;
+    char since[32];
+    time_t start = a->windowStart;
+    ctime_r(&start, since);
+    fprintf(e->out, "ALERT: [%s] Vehicle %s - %s (%u occurrences since %.24s)\n", cachedCtime(now), a->vehicle->id,
+            statusText[a->status], a->repeats, since);
+    e->stats.summaries++;
+    a->repeats = 0;
+}
+
+// Key seen again after its window closed: one line carries both the summary and this occurrence
+static void reopenWindow(AlertEngine *e, AlertEntry *a, time_t now) {
+    if (!takeToken(e, now)) {
+        a->repeats++;
+        e->stats.rateLimited++;
+        return;
+    }
+    a->repeats++;
+    emitSummary(e, a, now);
+    a->windowStart = (uint32_t)now;
+}
+
+// Replaces 14's logAlert. A repeat inside the window costs one hash probe and three stores.
+void logAlert(AlertEngine *e, Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now) {
+    e->stats.raised++;
+    uint32_t mask = e->capacity - 1;
+    uint32_t slot = alertSlot(e, vehicle, sensor, status);
+    AlertEntry *a;
+    for (;;) {
+        e->stats.probes++;
+        a = &e->entries[slot];
+        if (a->vehicle == vehicle && a->sensor == sensor && a->status == status) break;
+        if (!a->vehicle) {
+            a = NULL;
+            break;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    if (a) {
+        a->lastSeen = (uint32_t)now;
+        if ((uint32_t)now - a->windowStart < e->window) {
+            a->repeats++;
+            e->stats.suppressed++;
+            return;
+        }
+        reopenWindow(e, a, now);
+        return;
+    }
+
+    // New key: track it if the table has room, then print through the bucket
+    if (e->used * 2 >= e->capacity) {
+        if (takeToken(e, now)) printAlert(e, vehicle, status, now);
+        else e->stats.rateLimited++;
+        e->stats.untracked++;
+        return;
+    }
+    a = &e->entries[slot];
+    a->vehicle = vehicle;
+    a->sensor = (uint8_t)sensor;
+    a->status = (uint8_t)status;
+    a->repeats = 0;
+    a->windowStart = a->lastSeen = (uint32_t)now;
+    e->used++;
+    if (takeToken(e, now)) {
+        printAlert(e, vehicle, status, now);
+    } else {
+        a->repeats = 1;                 // Reported by the first summary instead
+        e->stats.rateLimited++;
+    }
+}
+
+// Periodic sweep (once per tick is plenty): closes expired windows, printing
+// their summaries, and drops keys that have gone quiet so the table stays small
+static inline int alertExpired(const AlertEngine *e, const AlertEntry *a, time_t now) {
+    return !a->repeats && (uint32_t)now - a->lastSeen >= e->window;
+}
+
+void alertFlush(AlertEngine *e, time_t now) {
+    uint32_t live = 0;
+    for (uint32_t i = 0; i < e->capacity; i++) {
+        AlertEntry *a = &e->entries[i];
+        if (!a->vehicle) continue;
+        // Without a token the summary stays pending until a later sweep
+        if ((uint32_t)now - a->windowStart >= e->window && a->repeats && takeToken(e, now)) {
+            emitSummary(e, a, now);
+            a->windowStart = (uint32_t)now;
+        }
+        if (!alertExpired(e, a, now)) live++;
+    }
+    if (live == e->used) return;
+
+    // Clearing a slot in place would cut the probe chains running through it, so the
+    // survivors move to a fresh table; without memory the stale keys just stay a while
+    AlertEntry *fresh = calloc(e->capacity, sizeof(AlertEntry));
+    if (!fresh) return;
+    uint32_t mask = e->capacity - 1;
+    for (uint32_t i = 0; i < e->capacity; i++) {
+        AlertEntry *a = &e->entries[i];
+        if (!a->vehicle || alertExpired(e, a, now)) continue;
+        uint32_t slot = alertSlot(e, a->vehicle, a->sensor, a->status);
+        while (fresh[slot].vehicle) slot = (slot + 1) & mask;
+        fresh[slot] = *a;
+    }
+    free(e->entries);
+    e->entries = fresh;
+    e->used = live;
+}
+
+// ---------------- Vehicles (14) ----------------
+
+// Initialize Vehicle with Default Data
+void initializeVehicle(Vehicle *vehicle, const char *id) {
+    strcpy(vehicle->id, id);
+    vehicle->sensors[ENGINE_TEMP] = (Sensor){ENGINE_TEMP, 90.0, "Normal"};
+    vehicle->sensors[OIL_PRESSURE] = (Sensor){OIL_PRESSURE, 40.0, "Normal"};
+    vehicle->sensors[BATTERY_VOLTAGE] = (Sensor){BATTERY_VOLTAGE, 12.6, "Normal"};
+}
+
+// Update Sensor Data (Simulation)
+void updateSensorData(Vehicle *vehicle) {
+    vehicle->sensors[ENGINE_TEMP].value = 80 + rand() % 40;         // 80 to 120
+    vehicle->sensors[OIL_PRESSURE].value = 20 + rand() % 40;        // 20 to 60
+    vehicle->sensors[BATTERY_VOLTAGE].value = 11 + ((rand() % 30) / 10.0); // 11.0 to 13.9
+}
+
+// Analyze One Sensor; the status text is kept for reports, the code keys alerts
+SensorStatus analyzeSensor(Sensor *sensor) {
+    SensorStatus status = STATUS_NORMAL;
+    switch (sensor->type) {
+        case ENGINE_TEMP:
+            if (sensor->value > 110) status = STATUS_OVERHEAT;
+            break;
+        case OIL_PRESSURE:
+            if (sensor->value < 25) status = STATUS_LOW_PRESSURE;
+            break;
+        case BATTERY_VOLTAGE:
+            if (sensor->value < 11.5) status = STATUS_LOW_BATTERY;
+            break;
+    }
+    strcpy(sensor->status, statusText[status]);
+    return status;
+}
+
+// Diagnostics Function (uses analyzeSensor inside)
+void performDiagnostics(AlertEngine *e, Vehicle *vehicle, time_t now) {
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        SensorStatus status = analyzeSensor(&vehicle->sensors[i]);
+
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].status);
+
+        if (status != STATUS_NORMAL) {
+            logAlert(e, vehicle, (SensorType)i, status, now);
+        }
+    }
+}
+
+// ---------------- Alert Storm Benchmark ----------------
+
+// 14's logAlert as it was: fresh ctime() + printf per alert
+static void legacyLogAlert(Vehicle *vehicle, const char *message) {
+    time_t now;
+    time(&now);
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+// Oil pressure flapping across the whole fleet: every vehicle crosses 25 every tick or two
+static void stormInput(Vehicle *v, int tick) {
+    v->sensors[ENGINE_TEMP].value = 90;
+    v->sensors[OIL_PRESSURE].value = (tick + (v->id[2] & 1)) % 2 ? 22 : 24 + rand() % 3;
+    v->sensors[BATTERY_VOLTAGE].value = 12.6f;
+}
+
+static int runStorm(int vehicles, int ticks, uint32_t window, double rate) {
+    Vehicle *fleet = malloc(sizeof(Vehicle) * vehicles);
+    if (!fleet) {
+        printf("Error: Cannot allocate %d vehicles\n", vehicles);
+        return -1;
+    }
+    for (int i = 0; i < vehicles; i++) {
+        char id[10];
+        snprintf(id, sizeof(id), "V%u", (100U + (unsigned)i) % 10000000U);
+        initializeVehicle(&fleet[i], id);
+    }
+
+    // Both runs see identical readings
+    int saved = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    struct timespec t0, t1;
+    time_t start = time(NULL);
+
+    fflush(stdout);
+    dup2(devNull, STDOUT_FILENO);
+    srand(7);
+    uint64_t legacyLines = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        for (int i = 0; i < vehicles; i++) {
+            stormInput(&fleet[i], tick);
+            for (int s = 0; s < MAX_SENSORS; s++) {
+                if (analyzeSensor(&fleet[i].sensors[s]) != STATUS_NORMAL) {
+                    legacyLogAlert(&fleet[i], fleet[i].sensors[s].status);
+                    legacyLines++;
+                }
+            }
+        }
+    }
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double legacyMs = elapsedMs(t0, t1);
+
+    AlertEngine engine;
+    if (alertEngineInit(&engine, (uint32_t)vehicles * 2, window, rate, rate * 5, stdout) != 0) {
+        dup2(saved, STDOUT_FILENO);
+        free(fleet);
+        return -1;
+    }
+    srand(7);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int tick = 0; tick < ticks; tick++) {
+        time_t now = start + tick;                      // One tick per simulated second
+        for (int i = 0; i < vehicles; i++) {
+            stormInput(&fleet[i], tick);
+            for (int s = 0; s < MAX_SENSORS; s++) {
+                SensorStatus status = analyzeSensor(&fleet[i].sensors[s]);
+                if (status != STATUS_NORMAL) logAlert(&engine, &fleet[i], (SensorType)s, status, now);
+            }
+        }
+        alertFlush(&engine, now);
+    }
+    alertFlush(&engine, start + ticks + window);        // Drain what is still pending
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double engineMs = elapsedMs(t0, t1);
+
+    // Isolated cost of a suppressed repeat: one key per vehicle, all inside their window
+    AlertEngine hot;
+    if (alertEngineInit(&hot, (uint32_t)vehicles * 2, window, 0, 0, stdout) != 0) {
+        dup2(saved, STDOUT_FILENO);
+        alertEngineFree(&engine);
+        free(fleet);
+        return -1;
+    }
+    time_t later = start + ticks;
+    for (int i = 0; i < vehicles; i++) logAlert(&hot, &fleet[i], OIL_PRESSURE, STATUS_LOW_PRESSURE, later);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int r = 0; r < 10; r++)
+        for (int i = 0; i < vehicles; i++) logAlert(&hot, &fleet[i], OIL_PRESSURE, STATUS_LOW_PRESSURE, later);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double hotNs = elapsedMs(t0, t1) * 1e6 / (10.0 * vehicles);
+    double hotProbes = (double)(hot.stats.probes - vehicles) / hot.stats.suppressed;
+    alertEngineFree(&hot);
+
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+    close(devNull);
+
+    AlertStats *st = &engine.stats;
+    printf("\n---- Oil Pressure Storm: %d vehicles x %d ticks (1 tick/s), window %u s, %.0f lines/s ----\n",
+           vehicles, ticks, window, rate);
+    printf("legacy logAlert : %9llu alert lines  %8.1f ms  (%.0f ns/alert)\n", (unsigned long long)legacyLines, legacyMs,
+           legacyMs * 1e6 / legacyLines);
+    printf("alert engine    : %9llu alerts raised -> %llu lines (%llu fresh, %llu summaries)  %8.1f ms  (%.0f ns/alert)\n",
+           (unsigned long long)st->raised, (unsigned long long)(st->printed + st->summaries), (unsigned long long)st->printed,
+           (unsigned long long)st->summaries, engineMs, engineMs * 1e6 / st->raised);
+    printf("                  %llu suppressed, %llu rate limited, %llu untracked, table %u/%u slots (%zu KB)\n",
+           (unsigned long long)st->suppressed, (unsigned long long)st->rateLimited, (unsigned long long)st->untracked,
+           engine.used, engine.capacity, engine.capacity * sizeof(AlertEntry) / 1024);
+    printf("suppressed repeat: %.1f ns, %.2f probes per alert\n", hotNs, hotProbes);
+
+    alertEngineFree(&engine);
+    free(fleet);
+    return 0;
+}
+
+// Main Function
+int main(int argc, char *argv[]) {
+    int vehicles = argc > 1 ? atoi(argv[1]) : 100000;
+    int ticks = argc > 2 ? atoi(argv[2]) : 120;
+    uint32_t window = argc > 3 ? (uint32_t)atoi(argv[3]) : 30;
+    double rate = argc > 4 ? atof(argv[4]) : 2000;
+    if (vehicles < 1 || ticks < 1 || window < 1) {
+        printf("Error: Need vehicles, ticks and window of at least 1\n");
+        return 1;
+    }
+    srand(time(0));
+
+    // 14's demo, with five simulated seconds of readings and a 3 s window
+    Vehicle fleet[MAX_VEHICLES];
+    AlertEngine engine;
+    if (alertEngineInit(&engine, 64, 3, 100, 100, stdout) != 0) return 1;
+
+    initializeVehicle(&fleet[0], "V101");
+    initializeVehicle(&fleet[1], "V102");
+
+    time_t now = time(NULL);
+    for (int second = 0; second < 5; second++, now++) {
+        for (int i = 0; i < MAX_VEHICLES; i++) {
+            updateSensorData(&fleet[i]);
+            fleet[i].sensors[OIL_PRESSURE].value = 22;      // Stuck low: repeats collapse into summaries
+            performDiagnostics(&engine, &fleet[i], now);
+        }
+        alertFlush(&engine, now);
+    }
+    alertFlush(&engine, now + 3);
+    alertEngineFree(&engine);
+
+    return runStorm(vehicles, ticks, window, rate) != 0;
+}
@@ -0,0 +1,631 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+// Build: gcc -O2 -pthread "37 Lock-Free MPSC Alert Queue.c"
+// Usage: ./a.out [vehicles] [ticks] [worker threads]
+
+#define MAX_SENSORS 3
+#define MAX_VEHICLES 2
+#define MAX_WORKERS 64
+#define ALERT_QUEUE_SIZE 65536      // Records, must be a power of two
+#define ALERT_BATCH 256             // Records formatted per write by the consumer
+#define ALERT_LINE_MAX 160          // Longest formatted alert, float value at FLT_MAX included
+#define ALERT_IDLE_SPINS 64         // Empty polls (each a sched_yield) before the consumer parks
+
+// Sensor Types
+typedef enum {
+    ENGINE_TEMP,
+    OIL_PRESSURE,
+    BATTERY_VOLTAGE
+} SensorType;
+
+// Sensor Structure
+typedef struct {
+    SensorType type;
+    float value;
+    char status[20];
+} Sensor;
+
+// Vehicle Structure
+typedef struct {
+    char id[10];
+    Sensor sensors[MAX_SENSORS];
+} Vehicle;
+
+// Status codes behind the status strings, so a record carries no text
+typedef enum {
+    STATUS_NORMAL,
+    STATUS_OVERHEAT,
+    STATUS_LOW_PRESSURE,
+    STATUS_LOW_BATTERY
+} SensorStatus;
+
+static const char *statusText[] = {"Normal", "Overheat", "Low Pressure", "Low Battery"};
+
+// One queued alert, 32 bytes. seq is the slot's turn counter: pos means free for
+// the producer claiming pos, pos + 1 means published and ready for the consumer.
+typedef struct {
+    _Atomic size_t seq;
+    int64_t time;
+    char vehicleId[10];
+    uint8_t sensor;
+    uint8_t status;
+    float value;
+} AlertRecord;
+
+// Bounded multi-producer/single-consumer ring. Producers claim a slot with one
+// CAS on enqueuePos and never wait: a full ring drops the alert and counts it.
+typedef struct {
+    _Alignas(64) _Atomic size_t enqueuePos;     // Shared by all producers
+    _Alignas(64) atomic_ulong dropped;          // Producers, ring full
+    _Alignas(64) atomic_int sleeping;           // Consumer parked on this futex word
+    _Alignas(64) size_t dequeuePos;             // Consumer only from here down
+    unsigned long emitted;
+    unsigned long batches;
+    unsigned long droppedReported;              // Already announced in the output
+    size_t highWater;                           // Deepest ring the consumer has seen
+    AlertRecord *records;
+    size_t mask;
+    FILE *out;
+    pthread_t thread;
+    atomic_int running;
+} AlertQueue;
+
+// Function Prototypes
+int alertQueueInit(AlertQueue *q, size_t capacity, FILE *out);
+int alertConsumerStart(AlertQueue *q);
+void alertConsumerStop(AlertQueue *q);
+void alertQueueFree(AlertQueue *q);
+int tryPushAlert(AlertQueue *q, const Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now);
+int logAlert(AlertQueue *q, const Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now);
+void initializeVehicle(Vehicle *vehicle, const char *id);
+void updateSensorData(Vehicle *vehicle, unsigned int *seed);
+SensorStatus analyzeSensor(Sensor *sensor);
+void performDiagnostics(AlertQueue *q, Vehicle *vehicle, time_t now);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ctime() is only re-rendered when the second changes; consumer thread only
+static const char *cachedCtime(time_t now) {
+    static time_t cachedSecond = -1;
+    static char cachedText[32];
+    if (now != cachedSecond) {
+        ctime_r(&now, cachedText);
+        cachedSecond = now;
+    }
+    return cachedText;
+}
+
+// ---------------- Alert Queue ----------------
+
+int alertQueueInit(AlertQueue *q, size_t capacity, FILE *out) {
+    memset(q, 0, sizeof(*q));
+    if (capacity < 2 || (capacity & (capacity - 1))) {
+        printf("Error: Alert queue size %zu is not a power of two\n", capacity);
+        return -1;
+    }
+    q->records = aligned_alloc(64, capacity * sizeof(AlertRecord));
+    if (!q->records) {
+        printf("Error: Cannot allocate alert queue of %zu records\n", capacity);
+        return -1;
+    }
+    for (size_t i = 0; i < capacity; i++) atomic_init(&q->records[i].seq, i);
+    atomic_init(&q->enqueuePos, 0);
+    atomic_init(&q->dropped, 0);
+    atomic_init(&q->sleeping, 0);
+    q->mask = capacity - 1;
+    q->out = out;
+    return 0;
+}
+
+void alertQueueFree(AlertQueue *q) {
+    free(q->records);
+    q->records = NULL;
+}
+
+static void futexWait(atomic_int *word, int expected) {
+    syscall(SYS_futex, (int *)word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+}
+
+static void futexWake(atomic_int *word) {
+    syscall(SYS_futex, (int *)word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+// Safe from any number of threads. Copies the alert into a pre-allocated slot and
+// returns 1, or returns 0 when the ring is full. No malloc, no lock, no stdio: the
+// shared writes on success are the CAS and the publish, plus a wake only when the
+// consumer has parked.
+int tryPushAlert(AlertQueue *q, const Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now) {
+    size_t pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+    AlertRecord *r;
+    for (;;) {
+        r = &q->records[pos & q->mask];
+        size_t seq = atomic_load_explicit(&r->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->enqueuePos, &pos, pos + 1, memory_order_relaxed,
+                                                      memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // The slot still holds the record from one lap ago: the consumer is behind
+            return 0;
+        } else {
+            pos = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed);
+        }
+    }
+    r->time = now;
+    memcpy(r->vehicleId, vehicle->id, sizeof(r->vehicleId));
+    r->sensor = (uint8_t)sensor;
+    r->status = (uint8_t)status;
+    r->value = vehicle->sensors[sensor].value;
+    atomic_store_explicit(&r->seq, pos + 1, memory_order_release);
+
+    // Pairs with the fence in alertConsumerThread: either it sees this record or we see it asleep
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&q->sleeping, memory_order_relaxed) && atomic_exchange(&q->sleeping, 0)) {
+        futexWake(&q->sleeping);
+    }
+    return 1;
+}
+
+// Replaces 14's logAlert: one push attempt, and an alert that finds the ring full is dropped and counted
+int logAlert(AlertQueue *q, const Vehicle *vehicle, SensorType sensor, SensorStatus status, time_t now) {
+    if (tryPushAlert(q, vehicle, sensor, status, now)) return 1;
+    atomic_fetch_add_explicit(&q->dropped, 1, memory_order_relaxed);
+    return 0;
+}
+
+// Consumer side: the next published record, or NULL when the next slot is not ready.
+// A producer that claimed a slot but has not published it yet holds back the slots
+// behind it too, so alerts come out in the order their slots were claimed.
+static inline AlertRecord *peekRecord(AlertQueue *q) {
+    AlertRecord *r = &q->records[q->dequeuePos & q->mask];
+    return atomic_load_explicit(&r->seq, memory_order_acquire) == q->dequeuePos + 1 ? r : NULL;
+}
+
+// Hands the slot back to the producer that will claim it one lap later
+static inline void releaseRecord(AlertQueue *q, AlertRecord *r) {
+    atomic_store_explicit(&r->seq, q->dequeuePos + q->mask + 1, memory_order_release);
+    q->dequeuePos++;
+    q->emitted++;
+}
+
+// 14's line format, plus the reading that triggered it
+static int formatAlert(char *buf, size_t size, const AlertRecord *r) {
+    return snprintf(buf, size, "ALERT: [%s] Vehicle %.10s - %s | Value: %.2f\n", cachedCtime((time_t)r->time),
+                    r->vehicleId, statusText[r->status < 4 ? r->status : 0], r->value);
+}
+
+// Takes up to ALERT_BATCH published records, formats them into one buffer and
+// writes it with a single fwrite. Returns the number of records consumed.
+static int drainBatch(AlertQueue *q) {
+    static char buf[ALERT_BATCH * 96 + ALERT_LINE_MAX];
+    size_t len = 0;
+    int n = 0;
+
+    unsigned long dropped = atomic_load_explicit(&q->dropped, memory_order_relaxed);
+    if (dropped != q->droppedReported) {
+        time_t now = time(NULL);
+        len += (size_t)snprintf(buf, sizeof(buf), "ALERT: [%s] Alert queue overflow - %lu alerts dropped\n",
+                                cachedCtime(now), dropped - q->droppedReported);
+        q->droppedReported = dropped;
+    }
+
+    size_t depth = atomic_load_explicit(&q->enqueuePos, memory_order_relaxed) - q->dequeuePos;
+    if (depth <= q->mask + 1 && depth > q->highWater) q->highWater = depth;
+
+    AlertRecord *r;
+    // Stops early rather than truncate when the values make the lines unusually long
+    while (n < ALERT_BATCH && sizeof(buf) - len >= ALERT_LINE_MAX && (r = peekRecord(q))) {
+        int written = formatAlert(buf + len, sizeof(buf) - len, r);
+        if (written > 0) len += (size_t)written < sizeof(buf) - len ? (size_t)written : sizeof(buf) - len - 1;
+        releaseRecord(q, r);
+        n++;
+    }
+
+    if (len) {
+        fwrite(buf, 1, len, q->out);
+        fflush(q->out);
+        q->batches++;
+    }
+    return n;
+}
+
+// The only thread that touches the output stream. When idle it yields for a while,
+// then parks on the sleeping futex until a producer or alertConsumerStop wakes it.
+static void *alertConsumerThread(void *arg) {
+    AlertQueue *q = arg;
+    int idle = 0;
+    for (;;) {
+        if (drainBatch(q)) {
+            idle = 0;
+            continue;
+        }
+        if (!atomic_load(&q->running)) {
+            // Producers are done: one more pass picks up anything published meanwhile
+            while (drainBatch(q)) {
+            }
+            break;
+        }
+        if (++idle < ALERT_IDLE_SPINS) {
+            sched_yield();
+            continue;
+        }
+        atomic_store_explicit(&q->sleeping, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (!peekRecord(q) && atomic_load(&q->running)) futexWait(&q->sleeping, 1);
+        atomic_store_explicit(&q->sleeping, 0, memory_order_relaxed);
+        idle = 0;
+    }
+    return NULL;
+}
+
+int alertConsumerStart(AlertQueue *q) {
+    atomic_store(&q->running, 1);
+    if (pthread_create(&q->thread, NULL, alertConsumerThread, q) != 0) {
+        printf("Error: Cannot start alert consumer thread\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Returns after every alert queued before the call has been written
+void alertConsumerStop(AlertQueue *q) {
+    atomic_store(&q->running, 0);
+    atomic_store(&q->sleeping, 0);
+    futexWake(&q->sleeping);
+    pthread_join(q->thread, NULL);
+}
+
+static void printQueueStats(const char *label, AlertQueue *q) {
+    printf("%-16s emitted %lu in %lu batches (%.1f per write) | high-water %zu/%zu | dropped %lu\n", label,
+           q->emitted, q->batches, q->batches ? (double)q->emitted / q->batches : 0.0, q->highWater, q->mask + 1,
+           atomic_load(&q->dropped));
+}
+
+// ---------------- Vehicles (14) ----------------
+
+// Initialize Vehicle with Default Data
+void initializeVehicle(Vehicle *vehicle, const char *id) {
+    strcpy(vehicle->id, id);
+    vehicle->sensors[ENGINE_TEMP] = (Sensor){ENGINE_TEMP, 90.0, "Normal"};
+    vehicle->sensors[OIL_PRESSURE] = (Sensor){OIL_PRESSURE, 40.0, "Normal"};
+    vehicle->sensors[BATTERY_VOLTAGE] = (Sensor){BATTERY_VOLTAGE, 12.6, "Normal"};
+}
+
+// Update Sensor Data (Simulation); rand_r so worker threads do not share rand()'s lock
+void updateSensorData(Vehicle *vehicle, unsigned int *seed) {
+    vehicle->sensors[ENGINE_TEMP].value = 80 + rand_r(seed) % 40;         // 80 to 120
+    vehicle->sensors[OIL_PRESSURE].value = 20 + rand_r(seed) % 40;        // 20 to 60
+    vehicle->sensors[BATTERY_VOLTAGE].value = 11 + ((rand_r(seed) % 30) / 10.0); // 11.0 to 13.9
+}
+
+// Analyze One Sensor
+SensorStatus analyzeSensor(Sensor *sensor) {
+    SensorStatus status = STATUS_NORMAL;
+    switch (sensor->type) {
+        case ENGINE_TEMP:
+            if (sensor->value > 110) status = STATUS_OVERHEAT;
+            break;
+        case OIL_PRESSURE:
+            if (sensor->value < 25) status = STATUS_LOW_PRESSURE;
+            break;
+        case BATTERY_VOLTAGE:
+            if (sensor->value < 11.5) status = STATUS_LOW_BATTERY;
+            break;
+    }
+    strcpy(sensor->status, statusText[status]);
+    return status;
+}
+
+// Diagnostics Function (uses analyzeSensor inside)
+void performDiagnostics(AlertQueue *q, Vehicle *vehicle, time_t now) {
+    printf("\nDiagnostics Report for Vehicle %s:\n", vehicle->id);
+    for (int i = 0; i < MAX_SENSORS; i++) {
+        SensorStatus status = analyzeSensor(&vehicle->sensors[i]);
+
+        printf("Sensor %d | Value: %.2f | Status: %s\n",
+                vehicle->sensors[i].type,
+                vehicle->sensors[i].value,
+                vehicle->sensors[i].status);
+
+        if (status != STATUS_NORMAL) {
+            logAlert(q, vehicle, (SensorType)i, status, now);
+        }
+    }
+}
+
+// ---------------- Multi-Threaded Benchmark ----------------
+
+// 14's logAlert as it was: ctime() + printf on the shared stdout per alert
+static void legacyLogAlert(Vehicle *vehicle, const char *message) {
+    time_t now;
+    time(&now);
+    printf("ALERT: [%s] Vehicle %s - %s\n", ctime(&now), vehicle->id, message);
+}
+
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int ticks;
+    unsigned int seed;
+    time_t start;
+    AlertQueue *queue;          // NULL: legacy printf path
+    uint64_t raised;
+    uint64_t queued;
+    uint64_t retries;           // Ring was full: yielded to the consumer and tried again
+    uint64_t checksum;          // Over queued records, compared with what the consumer saw
+    atomic_int *finished;
+} WorkerArgs;
+
+static inline uint64_t alertHash(const char *id, int sensor, int status, int64_t time, float value) {
+    uint64_t h = 1469598103934665603ULL;
+    for (int i = 0; i < 10 && id[i]; i++) h = (h ^ (uint8_t)id[i]) * 1099511628211ULL;
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    h = (h ^ (uint64_t)(sensor * 4 + status)) * 1099511628211ULL;
+    h = (h ^ (uint64_t)time) * 1099511628211ULL;
+    return (h ^ bits) * 1099511628211ULL;
+}
+
+// The diagnostics a worker runs on its slice each tick; alerts are the only output
+static void *diagnosticsWorker(void *arg) {
+    WorkerArgs *w = arg;
+    for (int tick = 0; tick < w->ticks; tick++) {
+        time_t now = w->start + tick;
+        for (int i = 0; i < w->count; i++) {
+            Vehicle *v = &w->vehicles[i];
+            updateSensorData(v, &w->seed);
+            for (int s = 0; s < MAX_SENSORS; s++) {
+                SensorStatus status = analyzeSensor(&v->sensors[s]);
+                if (status == STATUS_NORMAL) continue;
+                w->raised++;
+                if (!w->queue) {
+                    legacyLogAlert(v, v->sensors[s].status);
+                    continue;
+                }
+                // Every alert must arrive for the comparison, so a full ring is retried here
+                // and nothing counts as dropped
+                while (!tryPushAlert(w->queue, v, (SensorType)s, status, now)) {
+                    w->retries++;
+                    sched_yield();
+                }
+                w->queued++;
+                w->checksum += alertHash(v->id, s, status, now, v->sensors[s].value);
+            }
+        }
+    }
+    if (w->finished) atomic_fetch_add(w->finished, 1);
+    return NULL;
+}
+
+static void resetFleet(Vehicle *fleet, int vehicles) {
+    for (int i = 0; i < vehicles; i++) {
+        char id[10];
+        snprintf(id, sizeof(id), "VH%u", (unsigned)i % 10000000U);
+        initializeVehicle(&fleet[i], id);
+    }
+}
+
+// Splits the fleet over `workers` threads, all seeded from `seed`; returns how many started
+static int startWorkers(pthread_t *threads, WorkerArgs *args, Vehicle *fleet, int vehicles, int workers, int ticks,
+                         unsigned int seed, AlertQueue *queue, atomic_int *finished) {
+    int per = (vehicles + workers - 1) / workers;
+    time_t start = time(NULL);
+    for (int t = 0; t < workers; t++) {
+        int first = t * per;
+        int count = vehicles - first < per ? vehicles - first : per;
+        args[t] = (WorkerArgs){fleet + first, count > 0 ? count : 0, ticks, seed + (unsigned)t, start, queue,
+                               0, 0, 0, 0, finished};
+        if (pthread_create(&threads[t], NULL, diagnosticsWorker, &args[t]) != 0) {
+            printf("Error: Cannot start diagnostics worker %d\n", t);
+            return t;
+        }
+    }
+    return workers;
+}
+
+// Runs the fleet on `workers` threads; returns elapsed ms until every alert is
+// written, and in *producerMs (if given) until the last worker finished its ticks.
+// Returns -1 when the consumer or any worker could not be started.
+static double runFleet(Vehicle *fleet, int vehicles, int workers, int ticks, AlertQueue *queue, WorkerArgs *args,
+                       double *producerMs) {
+    pthread_t threads[MAX_WORKERS];
+    struct timespec t0, t1;
+
+    resetFleet(fleet, vehicles);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (queue && alertConsumerStart(queue) != 0) return -1;
+    int started = startWorkers(threads, args, fleet, vehicles, workers, ticks, 1234u, queue, NULL);
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+    if (started < workers) {
+        if (queue) alertConsumerStop(queue);
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    if (producerMs) *producerMs = elapsedMs(t0, t1);
+    if (queue) alertConsumerStop(queue);
+    fflush(stdout);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return elapsedMs(t0, t1);
+}
+
+static void restoreStdout(int saved, int devNull) {
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+    close(devNull);
+}
+
+static int runBenchmark(int vehicles, int ticks, int workers) {
+    Vehicle *fleet = malloc(sizeof(Vehicle) * vehicles);
+    if (!fleet) {
+        printf("Error: Cannot allocate %d vehicles\n", vehicles);
+        return -1;
+    }
+    WorkerArgs args[MAX_WORKERS];
+    printf("\n---- Alert Output: %d vehicles x %d ticks on %d worker threads ----\n", vehicles, ticks, workers);
+
+    // Both paths write to /dev/null through stdout; identical seeds give identical alerts
+    int saved = dup(STDOUT_FILENO);
+    int devNull = open("/dev/null", O_WRONLY);
+    fflush(stdout);
+    dup2(devNull, STDOUT_FILENO);
+
+    double legacyMs = runFleet(fleet, vehicles, workers, ticks, NULL, args, NULL);
+    if (legacyMs < 0) {
+        restoreStdout(saved, devNull);
+        printf("Error: Cannot start %d diagnostics workers\n", workers);
+        free(fleet);
+        return -1;
+    }
+    uint64_t legacyAlerts = 0;
+    for (int t = 0; t < workers; t++) legacyAlerts += args[t].raised;
+
+    AlertQueue queue;
+    if (alertQueueInit(&queue, ALERT_QUEUE_SIZE, stdout) != 0) {
+        restoreStdout(saved, devNull);
+        free(fleet);
+        return -1;
+    }
+    double queueProducerMs;
+    double queueMs = runFleet(fleet, vehicles, workers, ticks, &queue, args, &queueProducerMs);
+    if (queueMs < 0) {
+        restoreStdout(saved, devNull);
+        printf("Error: Cannot start the alert consumer and %d diagnostics workers\n", workers);
+        alertQueueFree(&queue);
+        free(fleet);
+        return -1;
+    }
+    uint64_t raised = 0, queued = 0, retries = 0;
+    for (int t = 0; t < workers; t++) {
+        raised += args[t].raised;
+        queued += args[t].queued;
+        retries += args[t].retries;
+    }
+
+    restoreStdout(saved, devNull);
+
+    printf("legacy printf   : %9llu alerts  %8.1f ms  (%.0f ns/alert)\n", (unsigned long long)legacyAlerts, legacyMs,
+           legacyMs * 1e6 / legacyAlerts);
+    printf("MPSC queue      : %9llu alerts  %8.1f ms  (%.0f ns/alert, workers done after %.1f ms)\n",
+           (unsigned long long)raised, queueMs, queueMs * 1e6 / raised, queueProducerMs);
+    printQueueStats("consumer", &queue);
+    printf("accounting      : raised %llu, queued %llu, emitted %lu -> %s | full-ring retries %llu\n",
+           (unsigned long long)raised, (unsigned long long)queued, queue.emitted,
+           raised == legacyAlerts && queued == raised && queue.emitted == queued ? "OK" : "MISMATCH",
+           (unsigned long long)retries);
+    alertQueueFree(&queue);
+
+    // Content check: this thread consumes and hashes each record instead of printing it,
+    // and must see exactly what the producers queued
+    if (alertQueueInit(&queue, ALERT_QUEUE_SIZE, stdout) != 0) {
+        free(fleet);
+        return -1;
+    }
+    pthread_t threads[MAX_WORKERS];
+    atomic_int finished = 0;
+    resetFleet(fleet, vehicles);
+    int started = startWorkers(threads, args, fleet, vehicles, workers, ticks, 99u, &queue, &finished);
+    uint64_t consumedChecksum = 0;
+    for (;;) {
+        int done = atomic_load(&finished) == started;   // Read before draining: nothing can follow
+        AlertRecord *r;
+        int n = 0;
+        while ((r = peekRecord(&queue))) {
+            consumedChecksum += alertHash(r->vehicleId, r->sensor, r->status, r->time, r->value);
+            releaseRecord(&queue, r);
+            n++;
+        }
+        if (done) break;
+        if (!n) sched_yield();
+    }
+    for (int t = 0; t < started; t++) pthread_join(threads[t], NULL);
+    if (started < workers) {
+        alertQueueFree(&queue);
+        free(fleet);
+        return -1;
+    }
+    uint64_t producedChecksum = 0;
+    queued = 0;
+    for (int t = 0; t < workers; t++) {
+        producedChecksum += args[t].checksum;
+        queued += args[t].queued;
+    }
+    printf("content check   : %llu records, checksum %s\n", (unsigned long long)queued,
+           producedChecksum == consumedChecksum && queue.emitted == queued ? "OK" : "MISMATCH");
+    alertQueueFree(&queue);
+
+    // What a worker pays per alert when the ring has room: fill an empty ring from one thread
+    if (alertQueueInit(&queue, ALERT_QUEUE_SIZE, stdout) != 0) {
+        free(fleet);
+        return -1;
+    }
+    struct timespec t0, t1;
+    time_t now = time(NULL);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < ALERT_QUEUE_SIZE; i++) logAlert(&queue, &fleet[i % vehicles], OIL_PRESSURE, STATUS_LOW_PRESSURE, now);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("logAlert push   : %.1f ns per alert (ring with room, no consumer)\n",
+           elapsedMs(t0, t1) * 1e6 / ALERT_QUEUE_SIZE);
+    alertQueueFree(&queue);
+    free(fleet);
+    return 0;
+}
+
+// Main Function
+int main(int argc, char *argv[]) {
+    int vehicles = argc > 1 ? atoi(argv[1]) : 100000;
+    int ticks = argc > 2 ? atoi(argv[2]) : 20;
+    int workers = argc > 3 ? atoi(argv[3]) : 4;
+    if (vehicles < 1 || ticks < 1 || workers < 1 || workers > MAX_WORKERS) {
+        printf("Error: Need vehicles and ticks of at least 1 and 1..%d workers\n", MAX_WORKERS);
+        return 1;
+    }
+    unsigned int seed = (unsigned int)time(0);
+
+    // 14's demo: the reports print from this thread, the alerts from the consumer
+    Vehicle fleet[MAX_VEHICLES];
+    AlertQueue queue;
+    if (alertQueueInit(&queue, 1024, stdout) != 0) return 1;
+
+    initializeVehicle(&fleet[0], "V101");
+    initializeVehicle(&fleet[1], "V102");
+
+    if (alertConsumerStart(&queue) != 0) return 1;
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        updateSensorData(&fleet[i], &seed);
+        fleet[i].sensors[OIL_PRESSURE].value = 22;          // At least one alert per vehicle
+        performDiagnostics(&queue, &fleet[i], time(NULL));
+    }
+    fflush(stdout);
+    alertConsumerStop(&queue);
+    printQueueStats("demo", &queue);
+    alertQueueFree(&queue);
+
+    // Saturation: 16 slots and no consumer running while 40 alerts are raised
+    AlertQueue small;
+    if (alertQueueInit(&small, 16, stdout) != 0) return 1;
+    fleet[0].sensors[OIL_PRESSURE].value = 22;
+    int accepted = 0;
+    for (int i = 0; i < 40; i++) accepted += logAlert(&small, &fleet[0], OIL_PRESSURE, STATUS_LOW_PRESSURE, time(NULL));
+    printf("\nSaturated queue: %d of 40 accepted, %lu dropped\n", accepted, atomic_load(&small.dropped));
+    if (alertConsumerStart(&small) != 0) return 1;
+    alertConsumerStop(&small);
+    printQueueStats("saturated", &small);
+    alertQueueFree(&small);
+
+    return runBenchmark(vehicles, ticks, workers) != 0;
+}
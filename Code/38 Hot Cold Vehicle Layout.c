@@ -0,0 +1,596 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <time.h>
+
+// Build: gcc -O2 "38 Hot Cold Vehicle Layout.c"
+// Usage: ./a.out [vehicles]
+
+#define MAX_VEHICLES 10
+#define MAX_SENSORS 5
+#define NO_SYMBOL UINT16_MAX   // Symbol ID for strings that were never interned
+#define MAX_SENSOR_KINDS 255   // Sensor kinds are stored as uint8_t
+
+// Known sensor types; their names are interned first so the enum value is the symbol ID
+typedef enum {
+    SENSOR_TEMPERATURE,
+    SENSOR_OIL_PRESSURE,
+    SENSOR_BRAKE_FLUID,
+    SENSOR_TIRE_PRESSURE,
+    SENSOR_BATTERY_VOLTAGE,
+    SENSOR_KIND_COUNT
+} SensorKind;
+
+static const char *sensorKindNames[SENSOR_KIND_COUNT] = {
+    "Temperature", "Oil Pressure", "Brake Fluid", "Tire Pressure", "Battery Voltage"
+};
+
+// Hot record: everything the scan paths read, exactly one cache line per vehicle
+// (the fleet array is 64-byte aligned). Strings live in the cold tables below and
+// are reached through the accessors.
+typedef struct {
+    int year;
+    float engine_capacity;
+    int mileage;
+    uint16_t make;                      // Symbol ID in coldStrings.names
+    uint16_t model;                     // Symbol ID in coldStrings.names
+    uint8_t sensor_count;
+    uint8_t sensor_kind[MAX_SENSORS];   // Symbol ID in coldStrings.sensorKinds
+    float sensor_value[MAX_SENSORS];
+    uint8_t reserved[20];               // Room for more hot fields
+} Vehicle;
+
+_Static_assert(sizeof(Vehicle) == 64, "Vehicle must stay one cache line");
+
+// Fleet management structure
+typedef struct {
+    Vehicle *vehicles;                  // 64-byte aligned
+    int count;
+    int capacity;
+} VehicleFleet;
+
+// String interning table (18): every distinct string is stored exactly once
+typedef struct {
+    char **strings;     // Symbol ID -> string
+    int count;
+    int capacity;
+    int32_t *buckets;   // Open-addressing table of symbol IDs, -1 = empty
+    int bucketCount;    // Power of two
+} StringTable;
+
+// Cold side: only touched when a vehicle is printed or looked up by name
+typedef struct {
+    StringTable names;          // Makes and models
+    StringTable sensorKinds;    // SensorKind names first, then any other type string seen
+} ColdStrings;
+
+static ColdStrings coldStrings;
+
+// 09's layout, kept for the scan comparison
+typedef struct {
+    char type[20];
+    float value;
+} WideSensor;
+
+typedef struct {
+    char make[50];
+    char model[50];
+    int year;
+    float engine_capacity;
+    int mileage;
+    WideSensor sensors[MAX_SENSORS];
+    int sensor_count;
+} WideVehicle;
+
+// Function prototypes
+void stringTableInit(StringTable *table);
+void stringTableFree(StringTable *table);
+uint16_t internString(StringTable *table, const char *str);
+uint16_t lookupSymbol(StringTable *table, const char *str);
+const char *symbolName(StringTable *table, uint16_t id);
+void coldStringsInit(void);
+void coldStringsFree(void);
+const char *vehicleMake(const Vehicle *vehicle);
+const char *vehicleModel(const Vehicle *vehicle);
+const char *sensorType(const Vehicle *vehicle, int i);
+int fleetInit(VehicleFleet *fleet, int capacity);
+void fleetFree(VehicleFleet *fleet);
+Vehicle createVehicle(char *make, char *model, int year, float engine_capacity, int mileage);
+void addVehicle(VehicleFleet *fleet, Vehicle vehicle);
+void addSensor(Vehicle *vehicle, char *type, float value);
+void printVehicle(Vehicle vehicle);
+void displayFleet(VehicleFleet *fleet);
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model);
+int removeVehicle(VehicleFleet *fleet, char *make, char *model);
+void updateMileage(Vehicle *vehicle, int mileage);
+void displaySensorData(Vehicle *vehicle);
+void runScanBenchmark(int numVehicles);
+
+// FNV-1a string hash
+static uint32_t hashString(const char *str) {
+    uint32_t h = 2166136261U;
+    while (*str) {
+        h ^= (unsigned char)*str++;
+        h *= 16777619U;
+    }
+    return h;
+}
+
+static double elapsedNs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e9 + (b.tv_nsec - a.tv_nsec);
+}
+
+// ---------------- String interning (18) ----------------
+
+void stringTableInit(StringTable *table) {
+    table->strings = NULL;
+    table->count = 0;
+    table->capacity = 0;
+    table->bucketCount = 64;
+    table->buckets = malloc(sizeof(int32_t) * table->bucketCount);
+    if (table->buckets == NULL) {
+        // An empty table: lookups miss and the first intern retries the allocation
+        table->bucketCount = 0;
+        return;
+    }
+    for (int i = 0; i < table->bucketCount; i++) {
+        table->buckets[i] = -1;
+    }
+}
+
+void stringTableFree(StringTable *table) {
+    for (int i = 0; i < table->count; i++) {
+        free(table->strings[i]);
+    }
+    free(table->strings);
+    free(table->buckets);
+    memset(table, 0, sizeof(*table));
+}
+
+// Keeps the old buckets when the bigger array cannot be allocated
+static int stringTableRehash(StringTable *table) {
+    int newCount = table->bucketCount ? table->bucketCount * 2 : 64;
+    int32_t *buckets = malloc(sizeof(int32_t) * newCount);
+    if (buckets == NULL) return -1;
+    free(table->buckets);
+    table->buckets = buckets;
+    table->bucketCount = newCount;
+    for (int i = 0; i < table->bucketCount; i++) {
+        table->buckets[i] = -1;
+    }
+
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    for (int id = 0; id < table->count; id++) {
+        uint32_t slot = hashString(table->strings[id]) & mask;
+        while (table->buckets[slot] != -1) {
+            slot = (slot + 1) & mask;
+        }
+        table->buckets[slot] = id;
+    }
+    return 0;
+}
+
+// Return the symbol ID for a string, NO_SYMBOL if it was never interned
+uint16_t lookupSymbol(StringTable *table, const char *str) {
+    if (table->bucketCount == 0) return NO_SYMBOL;
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    uint32_t slot = hashString(str) & mask;
+
+    while (table->buckets[slot] != -1) {
+        if (strcmp(table->strings[table->buckets[slot]], str) == 0) {
+            return (uint16_t)table->buckets[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NO_SYMBOL;
+}
+
+// Return the existing symbol ID or store the string once and assign a new one
+uint16_t internString(StringTable *table, const char *str) {
+    uint16_t id = lookupSymbol(table, str);
+    if (id != NO_SYMBOL) return id;
+
+    if (table->count >= NO_SYMBOL) {
+        printf("Error: Symbol table full\n");
+        return NO_SYMBOL;
+    }
+    if ((table->count + 1) * 2 > table->bucketCount && stringTableRehash(table) != 0) {
+        printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+        return NO_SYMBOL;
+    }
+    if (table->count == table->capacity) {
+        int newCapacity = table->capacity ? table->capacity * 2 : 16;
+        char **strings = realloc(table->strings, sizeof(char *) * newCapacity);
+        if (strings == NULL) {
+            printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+            return NO_SYMBOL;
+        }
+        table->strings = strings;
+        table->capacity = newCapacity;
+    }
+    char *copy = strdup(str);
+    if (copy == NULL) {
+        printf("Error: Out of memory, cannot intern \"%s\"\n", str);
+        return NO_SYMBOL;
+    }
+
+    id = (uint16_t)table->count++;
+    table->strings[id] = copy;
+
+    uint32_t mask = (uint32_t)table->bucketCount - 1;
+    uint32_t slot = hashString(str) & mask;
+    while (table->buckets[slot] != -1) {
+        slot = (slot + 1) & mask;
+    }
+    table->buckets[slot] = id;
+    return id;
+}
+
+const char *symbolName(StringTable *table, uint16_t id) {
+    return id < table->count ? table->strings[id] : "?";
+}
+
+// ---------------- Cold strings and accessors ----------------
+
+void coldStringsInit(void) {
+    stringTableInit(&coldStrings.names);
+    stringTableInit(&coldStrings.sensorKinds);
+    for (int k = 0; k < SENSOR_KIND_COUNT; k++) {
+        internString(&coldStrings.sensorKinds, sensorKindNames[k]);
+    }
+}
+
+void coldStringsFree(void) {
+    stringTableFree(&coldStrings.names);
+    stringTableFree(&coldStrings.sensorKinds);
+}
+
+const char *vehicleMake(const Vehicle *vehicle) {
+    return symbolName(&coldStrings.names, vehicle->make);
+}
+
+const char *vehicleModel(const Vehicle *vehicle) {
+    return symbolName(&coldStrings.names, vehicle->model);
+}
+
+const char *sensorType(const Vehicle *vehicle, int i) {
+    return symbolName(&coldStrings.sensorKinds, vehicle->sensor_kind[i]);
+}
+
+// ---------------- Fleet (09 API on the hot records) ----------------
+
+int fleetInit(VehicleFleet *fleet, int capacity) {
+    fleet->vehicles = aligned_alloc(64, sizeof(Vehicle) * (size_t)capacity);
+    fleet->count = 0;
+    fleet->capacity = fleet->vehicles ? capacity : 0;
+    if (!fleet->vehicles) {
+        printf("Error: Cannot allocate fleet of %d vehicles\n", capacity);
+        return -1;
+    }
+    return 0;
+}
+
+void fleetFree(VehicleFleet *fleet) {
+    free(fleet->vehicles);
+    memset(fleet, 0, sizeof(*fleet));
+}
+
+Vehicle createVehicle(char *make, char *model, int year, float engine_capacity, int mileage) {
+    Vehicle vehicle;
+    memset(&vehicle, 0, sizeof(vehicle));
+    vehicle.make = internString(&coldStrings.names, make);
+    vehicle.model = internString(&coldStrings.names, model);
+    vehicle.year = year;
+    vehicle.engine_capacity = engine_capacity;
+    vehicle.mileage = mileage;
+    vehicle.sensor_count = 0;
+    return vehicle;
+}
+
+void addVehicle(VehicleFleet *fleet, Vehicle vehicle) {
+    if (fleet->count < fleet->capacity) {
+        fleet->vehicles[fleet->count++] = vehicle;
+    } else {
+        printf("Error: Fleet is full, cannot add vehicle\n");
+    }
+}
+
+void addSensor(Vehicle *vehicle, char *type, float value) {
+    if (vehicle->sensor_count >= MAX_SENSORS) {
+        printf("Error: Sensor limit reached for vehicle %s %s\n", vehicleMake(vehicle), vehicleModel(vehicle));
+        return;
+    }
+    uint16_t kind = lookupSymbol(&coldStrings.sensorKinds, type);
+    if (kind == NO_SYMBOL) {
+        if (coldStrings.sensorKinds.count >= MAX_SENSOR_KINDS) {
+            printf("Error: Too many sensor types, cannot add %s\n", type);
+            return;
+        }
+        kind = internString(&coldStrings.sensorKinds, type);
+    }
+    vehicle->sensor_kind[vehicle->sensor_count] = (uint8_t)kind;
+    vehicle->sensor_value[vehicle->sensor_count] = value;
+    vehicle->sensor_count++;
+}
+
+void printVehicle(Vehicle vehicle) {
+    printf("Make: %s\n", vehicleMake(&vehicle));
+    printf("Model: %s\n", vehicleModel(&vehicle));
+    printf("Year: %d\n", vehicle.year);
+    printf("Engine Capacity: %.2fL\n", vehicle.engine_capacity);
+    printf("Mileage: %d km\n", vehicle.mileage);
+}
+
+void displayFleet(VehicleFleet *fleet) {
+    for (int i = 0; i < fleet->count; i++) {
+        printVehicle(fleet->vehicles[i]);
+        printf("----------------------\n");
+    }
+}
+
+void displaySensorData(Vehicle *vehicle) {
+    for (int i = 0; i < vehicle->sensor_count; i++) {
+        printf("%s: %.2f\n", sensorType(vehicle, i), vehicle->sensor_value[i]);
+    }
+}
+
+// The strings are resolved to symbols once; the scan then compares two uint16_t per vehicle
+int findVehicleIndex(VehicleFleet *fleet, char *make, char *model) {
+    uint16_t makeId = lookupSymbol(&coldStrings.names, make);
+    uint16_t modelId = lookupSymbol(&coldStrings.names, model);
+    if (makeId == NO_SYMBOL || modelId == NO_SYMBOL) return -1;
+    for (int i = 0; i < fleet->count; i++) {
+        if (fleet->vehicles[i].make == makeId && fleet->vehicles[i].model == modelId) return i;
+    }
+    return -1;
+}
+
+int removeVehicle(VehicleFleet *fleet, char *make, char *model) {
+    int index = findVehicleIndex(fleet, make, model);
+    if (index < 0) return -1;
+    memmove(&fleet->vehicles[index], &fleet->vehicles[index + 1], sizeof(Vehicle) * (fleet->count - index - 1));
+    fleet->count--;
+    return 0;
+}
+
+void updateMileage(Vehicle *vehicle, int mileage) {
+    vehicle->mileage = mileage;
+}
+
+// ---------------- Scan Benchmark ----------------
+
+// Distinct 64-byte lines holding bytes [first, last) of every record, per record.
+// This is what a scan reading those fields pulls through the cache.
+static double bytesTouchedPerVehicle(const void *base, size_t stride, int count, size_t first, size_t last) {
+    uintptr_t lastLine = UINTPTR_MAX;
+    uint64_t lines = 0;
+    for (int i = 0; i < count; i++) {
+        uintptr_t lo = ((uintptr_t)base + (size_t)i * stride + first) / 64;
+        uintptr_t hi = ((uintptr_t)base + (size_t)i * stride + last - 1) / 64;
+        lines += hi - lo + 1 - (lo == lastLine);
+        lastLine = hi;
+    }
+    return 64.0 * lines / count;
+}
+
+typedef struct {
+    long long mileage;          // Sum over vehicles from 2018 on
+    int recent;
+    double temperature;         // Sum of Temperature readings
+    int temperatureCount;
+    int matches;                // Vehicles of the searched make and model
+} ScanResult;
+
+static void scanWideMileage(const WideVehicle *v, int n, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        if (v[i].year >= 2018) {
+            r->mileage += v[i].mileage;
+            r->recent++;
+        }
+    }
+}
+
+static void scanHotMileage(const Vehicle *v, int n, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        if (v[i].year >= 2018) {
+            r->mileage += v[i].mileage;
+            r->recent++;
+        }
+    }
+}
+
+static void scanWideSensors(const WideVehicle *v, int n, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        for (int s = 0; s < v[i].sensor_count; s++) {
+            if (strcmp(v[i].sensors[s].type, "Temperature") == 0) {
+                r->temperature += v[i].sensors[s].value;
+                r->temperatureCount++;
+            }
+        }
+    }
+}
+
+static void scanHotSensors(const Vehicle *v, int n, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        for (int s = 0; s < v[i].sensor_count; s++) {
+            if (v[i].sensor_kind[s] == SENSOR_TEMPERATURE) {
+                r->temperature += v[i].sensor_value[s];
+                r->temperatureCount++;
+            }
+        }
+    }
+}
+
+static void scanWideFind(const WideVehicle *v, int n, const char *make, const char *model, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        if (strcmp(v[i].make, make) == 0 && strcmp(v[i].model, model) == 0) r->matches++;
+    }
+}
+
+static void scanHotFind(const Vehicle *v, int n, uint16_t make, uint16_t model, ScanResult *r) {
+    for (int i = 0; i < n; i++) {
+        if (v[i].make == make && v[i].model == model) r->matches++;
+    }
+}
+
+// Fastest of a few passes, in ns per vehicle
+#define TIME_SCAN(ns, n, call)                                  \
+    do {                                                        \
+        ns = 1e30;                                              \
+        for (int rep = 0; rep < 5; rep++) {                     \
+            struct timespec t0, t1;                             \
+            clock_gettime(CLOCK_MONOTONIC, &t0);                \
+            call;                                               \
+            clock_gettime(CLOCK_MONOTONIC, &t1);                \
+            double pass = elapsedNs(t0, t1) / (n);              \
+            if (pass < ns) ns = pass;                           \
+        }                                                       \
+    } while (0)
+
+static void printScanRow(const char *scan, double wideBytes, double wideNs, double hotBytes, double hotNs, int same) {
+    printf("%-22s %7.1f B %7.2f ns | %7.1f B %7.2f ns | %5.2fx | %s\n", scan, wideBytes, wideNs, hotBytes, hotNs,
+           wideNs / hotNs, same ? "same result" : "MISMATCH");
+}
+
+void runScanBenchmark(int numVehicles) {
+    static char *makes[] = {"Toyota", "Ford", "Honda", "BMW", "Tesla", "Volvo", "Kia", "Audi"};
+    static char *models[] = {"Camry", "Mustang", "Civic", "X5", "Model 3", "XC90", "Sportage", "A4"};
+
+    WideVehicle *wide = malloc(sizeof(WideVehicle) * (size_t)numVehicles);
+    VehicleFleet fleet;
+    if (!wide || fleetInit(&fleet, numVehicles) != 0) {
+        printf("Error: Cannot allocate %d vehicles for the scan benchmark\n", numVehicles);
+        free(wide);
+        return;
+    }
+
+    // The same fleet in both layouts
+    srand(42);
+    for (int i = 0; i < numVehicles; i++) {
+        int m = rand() % 8;
+        Vehicle v = createVehicle(makes[m], models[(m + rand() % 2) % 8], 2005 + rand() % 20,
+                                  1.0f + (rand() % 40) / 10.0f, rand() % 300000);
+        WideVehicle *w = &wide[i];
+        memset(w, 0, sizeof(*w));
+        strcpy(w->make, makes[m]);
+        strcpy(w->model, vehicleModel(&v));
+        w->year = v.year;
+        w->engine_capacity = v.engine_capacity;
+        w->mileage = v.mileage;
+
+        int sensors = 1 + rand() % MAX_SENSORS;
+        for (int s = 0; s < sensors; s++) {
+            int kind = rand() % SENSOR_KIND_COUNT;
+            float value = (float)(rand() % 1000) / 10.0f;
+            addSensor(&v, (char *)sensorKindNames[kind], value);
+            strcpy(w->sensors[s].type, sensorKindNames[kind]);
+            w->sensors[s].value = value;
+        }
+        w->sensor_count = sensors;
+        addVehicle(&fleet, v);
+    }
+
+    printf("\n---- Scan Benchmark: %d vehicles, %zu B per 09 record vs %zu B hot record ----\n", numVehicles,
+           sizeof(WideVehicle), sizeof(Vehicle));
+    printf("%-22s %21s | %21s |\n", "scan", "09 layout", "hot/cold");
+    printf("%-22s %9s %11s | %9s %11s |\n", "", "touched", "per vehicle", "touched", "per vehicle");
+
+    ScanResult a, b, check;
+    double wideNs, hotNs;
+    int n = numVehicles;
+
+    TIME_SCAN(wideNs, n, (memset(&a, 0, sizeof(a)), scanWideMileage(wide, n, &a)));
+    TIME_SCAN(hotNs, n, (memset(&b, 0, sizeof(b)), scanHotMileage(fleet.vehicles, n, &b)));
+    printScanRow("mileage, year >= 2018",
+                 bytesTouchedPerVehicle(wide, sizeof(WideVehicle), n, offsetof(WideVehicle, year),
+                                        offsetof(WideVehicle, mileage) + sizeof(int)),
+                 wideNs,
+                 bytesTouchedPerVehicle(fleet.vehicles, sizeof(Vehicle), n, offsetof(Vehicle, year),
+                                        offsetof(Vehicle, mileage) + sizeof(int)),
+                 hotNs, a.mileage == b.mileage && a.recent == b.recent);
+    check.recent = b.recent;
+
+    TIME_SCAN(wideNs, n, (memset(&a, 0, sizeof(a)), scanWideSensors(wide, n, &a)));
+    TIME_SCAN(hotNs, n, (memset(&b, 0, sizeof(b)), scanHotSensors(fleet.vehicles, n, &b)));
+    printScanRow("Temperature readings",
+                 bytesTouchedPerVehicle(wide, sizeof(WideVehicle), n, offsetof(WideVehicle, sensors),
+                                        sizeof(WideVehicle)),
+                 wideNs,
+                 bytesTouchedPerVehicle(fleet.vehicles, sizeof(Vehicle), n, offsetof(Vehicle, sensor_count),
+                                        offsetof(Vehicle, sensor_value) + sizeof(float) * MAX_SENSORS),
+                 hotNs, a.temperature == b.temperature && a.temperatureCount == b.temperatureCount);
+    check.temperature = b.temperature;
+    check.temperatureCount = b.temperatureCount;
+
+    uint16_t makeId = lookupSymbol(&coldStrings.names, "Ford");
+    uint16_t modelId = lookupSymbol(&coldStrings.names, "Mustang");
+    TIME_SCAN(wideNs, n, (memset(&a, 0, sizeof(a)), scanWideFind(wide, n, "Ford", "Mustang", &a)));
+    TIME_SCAN(hotNs, n, (memset(&b, 0, sizeof(b)), scanHotFind(fleet.vehicles, n, makeId, modelId, &b)));
+    printScanRow("make/model match",
+                 bytesTouchedPerVehicle(wide, sizeof(WideVehicle), n, offsetof(WideVehicle, make),
+                                        offsetof(WideVehicle, model) + sizeof(wide->model)),
+                 wideNs,
+                 bytesTouchedPerVehicle(fleet.vehicles, sizeof(Vehicle), n, offsetof(Vehicle, make),
+                                        offsetof(Vehicle, model) + sizeof(uint16_t)),
+                 hotNs, a.matches == b.matches);
+
+    printf("Fleet footprint: %.1f MB (09) vs %.1f MB hot + %d interned strings cold\n",
+           sizeof(WideVehicle) * (double)n / 1e6, sizeof(Vehicle) * (double)n / 1e6,
+           coldStrings.names.count + coldStrings.sensorKinds.count);
+    printf("Results: %d vehicles from 2018 on, %d Temperature readings averaging %.2f, %d Ford Mustangs\n",
+           check.recent, check.temperatureCount,
+           check.temperatureCount ? check.temperature / check.temperatureCount : 0.0, b.matches);
+
+    free(wide);
+    fleetFree(&fleet);
+}
+
+int main(int argc, char *argv[]) {
+    int numVehicles = argc > 1 ? atoi(argv[1]) : 1000000;
+    if (numVehicles < 1) {
+        printf("Error: Need at least 1 vehicle\n");
+        return 1;
+    }
+    coldStringsInit();
+
+    VehicleFleet fleet;
+    if (fleetInit(&fleet, MAX_VEHICLES) != 0) return 1;
+
+    // Creating and adding vehicles
+    Vehicle v1 = createVehicle("Toyota", "Camry", 2021, 2.5, 15000);
+    Vehicle v2 = createVehicle("Ford", "Mustang", 2020, 5.0, 22000);
+    addVehicle(&fleet, v1);
+    addVehicle(&fleet, v2);
+
+    // Adding sensors to vehicles
+    addSensor(&fleet.vehicles[1], "Temperature", 85.2);
+    addSensor(&fleet.vehicles[0], "Oil Pressure", 30.5);
+    addSensor(&fleet.vehicles[1], "Brake Fluid", 12.7);
+
+    // Displaying fleet
+    printf("Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+
+    // Displaying sensor data
+    for (int j = 0; j < fleet.count; j++) {
+        printf("\nSensor Data for Vehicle: %d %s %s:\n", (j + 1), vehicleMake(&fleet.vehicles[j]),
+               vehicleModel(&fleet.vehicles[j]));
+        displaySensorData(&fleet.vehicles[j]);
+    }
+
+    // Updating mileage
+    updateMileage(&fleet.vehicles[0], 18000);
+    printf("\nUpdated Mileage for %s %s: %d km\n", vehicleMake(&fleet.vehicles[0]), vehicleModel(&fleet.vehicles[0]),
+           fleet.vehicles[0].mileage);
+
+    int index = findVehicleIndex(&fleet, "Ford", "Mustang");
+    printf("Ford Mustang is vehicle %d; removing it: %s\n", index + 1,
+           removeVehicle(&fleet, "Ford", "Mustang") == 0 ? "done" : "not found");
+    fleetFree(&fleet);
+
+    runScanBenchmark(numVehicles);
+    coldStringsFree();
+    return 0;
+}
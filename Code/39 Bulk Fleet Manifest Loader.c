@@ -0,0 +1,675 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Build: gcc -O2 -pthread "39 Bulk Fleet Manifest Loader.c"
+// Usage: ./a.out [fleet.csv | fleet.bin] [threads]
+//        Without a file, a 1M-vehicle manifest is generated in both formats and loaded.
+
+#define MAX_THREADS 64
+#define MANIFEST_MAGIC 0x4D544C46u          // "FLTM"
+#define MANIFEST_VERSION 1
+#define CSV_HEADER "make,model,year,engine_capacity,mileage,seat\n"
+
+// Define a structure for storing vehicle information
+typedef struct {
+    char make[50];
+    char model[50];
+    int year;
+    float engine_capacity;
+    int mileage;
+    int seat;
+} Vehicle;
+
+// Growable fleet; the loader reserves once and constructs every vehicle in its final slot
+typedef struct {
+    Vehicle *vehicles;
+    int count;
+    int capacity;
+} VehicleFleet;
+
+// Binary manifest: this header, then `count` records laid out exactly like Vehicle
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t recordSize;
+} ManifestHeader;
+
+typedef enum {
+    MANIFEST_CSV,
+    MANIFEST_BINARY
+} ManifestFormat;
+
+typedef struct {
+    ManifestFormat format;
+    int threads;
+    size_t bytes;
+    int rows;                   // Data lines (CSV) or records (binary)
+    int loaded;
+    int malformed;              // Skipped rows
+    double scanMs;              // CSV: splitting and counting rows
+    double parseMs;             // Parse or read into the fleet
+} ManifestStats;
+
+// One thread's share of the manifest
+typedef struct {
+    const char *begin, *end;    // CSV: whole lines only
+    size_t firstRecord;         // Binary: record range
+    size_t recordCount;
+    int fd;
+    int rows;
+    int first;                  // Fleet index of this chunk's first row
+    int loaded;
+    int malformed;
+    Vehicle *out;
+} ManifestChunk;
+
+// Function prototypes
+void fleetInit(VehicleFleet *fleet);
+int fleetReserve(VehicleFleet *fleet, int capacity);
+void fleetFree(VehicleFleet *fleet);
+Vehicle *fleetEmplace(VehicleFleet *fleet);
+void initVehicle(Vehicle *vehicle, const char *make, size_t makeLen, const char *model, size_t modelLen, int year,
+                 float engine_capacity, int mileage, int seat);
+Vehicle *addVehicle(VehicleFleet *fleet, const char *make, const char *model, int year, float engine_capacity,
+                    int mileage, int seat);
+void printVehicle(const Vehicle *vehicle);
+void displayFleet(const VehicleFleet *fleet);
+int findVehicleIndex(const VehicleFleet *fleet, const char *make, const char *model);
+int removeVehicle(VehicleFleet *fleet, const char *make, const char *model);
+int loadFleetManifest(VehicleFleet *fleet, const char *path, int threads, ManifestStats *stats);
+int writeCsvManifest(const VehicleFleet *fleet, const char *path);
+int writeBinaryManifest(const VehicleFleet *fleet, const char *path);
+
+static double elapsedMs(struct timespec a, struct timespec b) {
+    return (b.tv_sec - a.tv_sec) * 1e3 + (b.tv_nsec - a.tv_nsec) / 1e6;
+}
+
+// ---------------- Fleet ----------------
+
+void fleetInit(VehicleFleet *fleet) {
+    fleet->vehicles = NULL;
+    fleet->count = 0;
+    fleet->capacity = 0;
+}
+
+// Grows the storage to hold `capacity` vehicles; a no-op when it already does
+int fleetReserve(VehicleFleet *fleet, int capacity) {
+    if (capacity <= fleet->capacity) return 0;
+    Vehicle *grown = realloc(fleet->vehicles, sizeof(Vehicle) * (size_t)capacity);
+    if (!grown) {
+        printf("Error: Cannot reserve room for %d vehicles\n", capacity);
+        return -1;
+    }
+    fleet->vehicles = grown;
+    fleet->capacity = capacity;
+    return 0;
+}
+
+void fleetFree(VehicleFleet *fleet) {
+    free(fleet->vehicles);
+    fleetInit(fleet);
+}
+
+// Next free slot, constructed by the caller; NULL when the reservation is used up
+Vehicle *fleetEmplace(VehicleFleet *fleet) {
+    if (fleet->count >= fleet->capacity) {
+        printf("Error: Fleet is full, cannot add vehicle\n");
+        return NULL;
+    }
+    return &fleet->vehicles[fleet->count++];
+}
+
+// Constructs a vehicle where it will live; the strings need not be NUL-terminated
+void initVehicle(Vehicle *vehicle, const char *make, size_t makeLen, const char *model, size_t modelLen, int year,
+                 float engine_capacity, int mileage, int seat) {
+    if (makeLen >= sizeof(vehicle->make)) makeLen = sizeof(vehicle->make) - 1;
+    if (modelLen >= sizeof(vehicle->model)) modelLen = sizeof(vehicle->model) - 1;
+    memcpy(vehicle->make, make, makeLen);
+    memset(vehicle->make + makeLen, 0, sizeof(vehicle->make) - makeLen);
+    memcpy(vehicle->model, model, modelLen);
+    memset(vehicle->model + modelLen, 0, sizeof(vehicle->model) - modelLen);
+    vehicle->year = year;
+    vehicle->engine_capacity = engine_capacity;
+    vehicle->mileage = mileage;
+    vehicle->seat = seat;
+}
+
+// Replaces 08's createVehicle + addVehicle pair: no Vehicle is passed or returned by value
+Vehicle *addVehicle(VehicleFleet *fleet, const char *make, const char *model, int year, float engine_capacity,
+                    int mileage, int seat) {
+    if (fleet->count == fleet->capacity && fleetReserve(fleet, fleet->capacity ? fleet->capacity * 2 : 16) != 0) {
+        return NULL;
+    }
+    Vehicle *vehicle = fleetEmplace(fleet);
+    if (!vehicle) return NULL;
+    initVehicle(vehicle, make, strlen(make), model, strlen(model), year, engine_capacity, mileage, seat);
+    return vehicle;
+}
+
+// Function to print details of a single vehicle
+void printVehicle(const Vehicle *vehicle) {
+    printf("Make: %s\n", vehicle->make);
+    printf("Model: %s\n", vehicle->model);
+    printf("Year: %d\n", vehicle->year);
+    printf("Engine Capacity: %.2fL\n", vehicle->engine_capacity);
+    printf("Mileage: %d km\n", vehicle->mileage);
+    printf("Seat: %d \n", vehicle->seat);
+}
+
+// Function to display the entire fleet
+void displayFleet(const VehicleFleet *fleet) {
+    for (int i = 0; i < fleet->count; i++) {
+        printVehicle(&fleet->vehicles[i]);
+        printf("----------------------\n");
+    }
+}
+
+// Function to search for a vehicle in the fleet by make and model
+int findVehicleIndex(const VehicleFleet *fleet, const char *make, const char *model) {
+    for (int i = 0; i < fleet->count; i++) {
+        if (strcmp(fleet->vehicles[i].make, make) == 0 && strcmp(fleet->vehicles[i].model, model) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Function to remove a vehicle from the fleet
+int removeVehicle(VehicleFleet *fleet, const char *make, const char *model) {
+    int index = findVehicleIndex(fleet, make, model);
+    if (index == -1) return -1;
+    memmove(&fleet->vehicles[index], &fleet->vehicles[index + 1], sizeof(Vehicle) * (fleet->count - index - 1));
+    fleet->count--;
+    return 0;
+}
+
+// ---------------- CSV Parsing ----------------
+
+static const char *parseInt(const char *p, const char *end, int *out) {
+    const char *start = p;
+    int v = 0;
+    while (p < end && *p >= '0' && *p <= '9' && p - start < 9) v = v * 10 + (*p++ - '0');
+    *out = v;
+    return p > start ? p : NULL;
+}
+
+// Plain decimals only ("2.5", "13", "0.75"), which is what the manifest holds
+static const char *parseFloat(const char *p, const char *end, float *out) {
+    static const double scale[] = {1, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9};
+    const char *start = p;
+    int64_t whole = 0, frac = 0;
+    int digits = 0;
+    while (p < end && *p >= '0' && *p <= '9' && p - start < 9) whole = whole * 10 + (*p++ - '0');
+    if (p == start) return NULL;
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && *p >= '0' && *p <= '9' && digits < 9) {
+            frac = frac * 10 + (*p++ - '0');
+            digits++;
+        }
+    }
+    *out = (float)((double)whole + (double)frac * scale[digits]);
+    return p;
+}
+
+// "make,model,year,engine_capacity,mileage,seat" into the slot; 0 if the line is malformed
+static int parseCsvLine(const char *p, const char *eol, Vehicle *slot) {
+    if (eol > p && eol[-1] == '\r') eol--;
+    if (eol <= p) return 0;
+    const char *make = p;
+    const char *comma = memchr(p, ',', (size_t)(eol - p));
+    if (!comma) return 0;
+    size_t makeLen = (size_t)(comma - make);
+    const char *model = comma + 1;
+    comma = memchr(model, ',', (size_t)(eol - model));
+    if (!comma) return 0;
+    size_t modelLen = (size_t)(comma - model);
+    if (!makeLen || !modelLen || makeLen >= sizeof(slot->make) || modelLen >= sizeof(slot->model)) return 0;
+
+    int year, mileage, seat;
+    float engine;
+    p = comma + 1;
+    if (!(p = parseInt(p, eol, &year)) || p >= eol || *p++ != ',') return 0;
+    if (!(p = parseFloat(p, eol, &engine)) || p >= eol || *p++ != ',') return 0;
+    if (!(p = parseInt(p, eol, &mileage)) || p >= eol || *p++ != ',') return 0;
+    if (!(p = parseInt(p, eol, &seat)) || p != eol) return 0;
+
+    initVehicle(slot, make, makeLen, model, modelLen, year, engine, mileage, seat);
+    return 1;
+}
+
+// Pass 1: rows in the chunk, so every chunk knows where its vehicles start
+static void countCsvChunk(ManifestChunk *c) {
+    int rows = 0;
+    for (const char *p = c->begin; p < c->end;) {
+        const char *eol = memchr(p, '\n', (size_t)(c->end - p));
+        rows++;
+        if (!eol) break;
+        p = eol + 1;
+    }
+    c->rows = rows;
+}
+
+// Pass 2: parse straight into the chunk's range of the reserved fleet
+static void parseCsvChunk(ManifestChunk *c) {
+    Vehicle *slot = c->out;
+    for (const char *p = c->begin; p < c->end;) {
+        const char *eol = memchr(p, '\n', (size_t)(c->end - p));
+        if (!eol) eol = c->end;
+        if (parseCsvLine(p, eol, slot)) {
+            slot++;
+        } else if (eol > p && !(eol - p == 1 && *p == '\r')) {
+            c->malformed++;
+        }
+        p = eol + 1;
+    }
+    c->loaded = (int)(slot - c->out);
+}
+
+// Binary: read the chunk's records from the file directly into their slots
+static void readBinaryChunk(ManifestChunk *c) {
+    size_t bytes = c->recordCount * sizeof(Vehicle);
+    off_t offset = (off_t)(sizeof(ManifestHeader) + c->firstRecord * sizeof(Vehicle));
+    char *dst = (char *)c->out;
+    while (bytes > 0) {
+        ssize_t n = pread(c->fd, dst, bytes, offset);
+        if (n <= 0) break;
+        dst += n;
+        offset += n;
+        bytes -= (size_t)n;
+    }
+    c->loaded = (int)(c->recordCount - (bytes + sizeof(Vehicle) - 1) / sizeof(Vehicle));
+    for (int i = 0; i < c->loaded; i++) {
+        // Never trust a string from disk to be terminated
+        c->out[i].make[sizeof(c->out[i].make) - 1] = '\0';
+        c->out[i].model[sizeof(c->out[i].model) - 1] = '\0';
+    }
+}
+
+typedef enum {
+    CHUNK_COUNT_CSV,
+    CHUNK_PARSE_CSV,
+    CHUNK_READ_BINARY
+} ChunkJob;
+
+typedef struct {
+    ManifestChunk *chunks;
+    int index;
+    int threads;
+    ChunkJob job;
+} ChunkWorkerArgs;
+
+static void *chunkWorker(void *arg) {
+    ChunkWorkerArgs *w = arg;
+    ManifestChunk *c = &w->chunks[w->index];
+    switch (w->job) {
+        case CHUNK_COUNT_CSV: countCsvChunk(c); break;
+        case CHUNK_PARSE_CSV: parseCsvChunk(c); break;
+        case CHUNK_READ_BINARY: readBinaryChunk(c); break;
+    }
+    return NULL;
+}
+
+// One chunk per thread; this thread takes chunk 0 (27's runWorkers)
+static void runChunks(ManifestChunk *chunks, int threads, ChunkJob job) {
+    pthread_t ids[MAX_THREADS];
+    int started[MAX_THREADS] = {0};     // pthread_t has no portable "none" value
+    ChunkWorkerArgs args[MAX_THREADS];
+    for (int t = 0; t < threads; t++) {
+        args[t] = (ChunkWorkerArgs){chunks, t, threads, job};
+        if (t == 0) continue;
+        if (pthread_create(&ids[t], NULL, chunkWorker, &args[t]) == 0) {
+            started[t] = 1;
+        } else {
+            printf("Error: Cannot start loader thread %d, running its chunk inline\n", t);
+        }
+    }
+    chunkWorker(&args[0]);
+    for (int t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(ids[t], NULL);
+        else chunkWorker(&args[t]);
+    }
+}
+
+// ---------------- Manifest Loader ----------------
+
+static int loadCsv(VehicleFleet *fleet, const char *data, size_t size, int threads, ManifestStats *stats) {
+    struct timespec t0, t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    const char *p = data, *end = data + size;
+    if (size >= strlen(CSV_HEADER) - 1 && memcmp(p, CSV_HEADER, strlen(CSV_HEADER) - 1) == 0) {
+        const char *eol = memchr(p, '\n', size);
+        p = eol ? eol + 1 : end;
+    }
+
+    // Split at line boundaries near equal byte offsets
+    ManifestChunk chunks[MAX_THREADS];
+    memset(chunks, 0, sizeof(chunks));
+    const char *cursor = p;
+    for (int t = 0; t < threads; t++) {
+        const char *cut = t == threads - 1 ? end : p + (size_t)(end - p) * (t + 1) / threads;
+        if (cut < cursor) cut = cursor;
+        if (cut < end) {
+            const char *eol = memchr(cut, '\n', (size_t)(end - cut));
+            cut = eol ? eol + 1 : end;
+        }
+        chunks[t].begin = cursor;
+        chunks[t].end = cut;
+        cursor = cut;
+    }
+    runChunks(chunks, threads, CHUNK_COUNT_CSV);
+
+    int rows = 0;
+    for (int t = 0; t < threads; t++) {
+        chunks[t].first = fleet->count + rows;
+        rows += chunks[t].rows;
+    }
+    if (fleetReserve(fleet, fleet->count + rows) != 0) return -1;
+    for (int t = 0; t < threads; t++) chunks[t].out = &fleet->vehicles[chunks[t].first];
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+
+    runChunks(chunks, threads, CHUNK_PARSE_CSV);
+
+    // Skipped rows leave gaps at chunk ends; close them up in order
+    int next = fleet->count;
+    for (int t = 0; t < threads; t++) {
+        if (chunks[t].first != next) {
+            memmove(&fleet->vehicles[next], chunks[t].out, sizeof(Vehicle) * (size_t)chunks[t].loaded);
+        }
+        next += chunks[t].loaded;
+        stats->malformed += chunks[t].malformed;
+    }
+    stats->rows = rows;
+    stats->loaded = next - fleet->count;
+    fleet->count = next;
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    stats->scanMs = elapsedMs(t0, t1);
+    stats->parseMs = elapsedMs(t1, t2);
+    return 0;
+}
+
+static int loadBinary(VehicleFleet *fleet, int fd, const ManifestHeader *h, size_t size, int threads,
+                      ManifestStats *stats) {
+    struct timespec t0, t1;
+    if (h->version != MANIFEST_VERSION || h->recordSize != sizeof(Vehicle) ||
+        h->count > (size - sizeof(ManifestHeader)) / sizeof(Vehicle) || h->count > INT32_MAX - (uint32_t)fleet->count) {
+        printf("Error: Unsupported or truncated binary manifest (version %u, record %u bytes, %u records)\n",
+               h->version, h->recordSize, h->count);
+        return -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (fleetReserve(fleet, fleet->count + (int)h->count) != 0) return -1;
+
+    ManifestChunk chunks[MAX_THREADS];
+    memset(chunks, 0, sizeof(chunks));
+    size_t per = (h->count + threads - 1) / threads;
+    for (int t = 0; t < threads; t++) {
+        size_t first = per * t < h->count ? per * t : h->count;
+        size_t last = per * (t + 1) < h->count ? per * (t + 1) : h->count;
+        chunks[t] = (ManifestChunk){.firstRecord = first, .recordCount = last - first, .fd = fd,
+                                    .first = fleet->count + (int)first, .out = &fleet->vehicles[fleet->count + first]};
+    }
+    runChunks(chunks, threads, CHUNK_READ_BINARY);
+
+    int loaded = 0;
+    for (int t = 0; t < threads; t++) {
+        loaded += chunks[t].loaded;
+        if (chunks[t].loaded != (int)chunks[t].recordCount) {
+            printf("Error: Short read in binary manifest\n");
+            return -1;
+        }
+    }
+    stats->rows = (int)h->count;
+    stats->loaded = loaded;
+    fleet->count += loaded;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    stats->parseMs = elapsedMs(t0, t1);
+    return 0;
+}
+
+// Appends every vehicle in the manifest to the fleet. The format is taken from the
+// file: a binary manifest starts with MANIFEST_MAGIC, anything else is read as CSV.
+int loadFleetManifest(VehicleFleet *fleet, const char *path, int threads, ManifestStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+    stats->threads = threads;
+
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        printf("Error: Cannot open manifest %s\n", path);
+        if (fd >= 0) close(fd);
+        return -1;
+    }
+    stats->bytes = (size_t)st.st_size;
+    if (st.st_size == 0) {
+        close(fd);
+        return 0;
+    }
+
+    ManifestHeader header;
+    int result;
+    if ((size_t)st.st_size >= sizeof(header) && pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+        header.magic == MANIFEST_MAGIC) {
+        stats->format = MANIFEST_BINARY;
+        result = loadBinary(fleet, fd, &header, (size_t)st.st_size, threads, stats);
+    } else {
+        stats->format = MANIFEST_CSV;
+        const char *data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            printf("Error: Cannot map manifest %s\n", path);
+            close(fd);
+            return -1;
+        }
+        madvise((void *)data, (size_t)st.st_size, MADV_SEQUENTIAL);
+        result = loadCsv(fleet, data, (size_t)st.st_size, threads, stats);
+        munmap((void *)data, (size_t)st.st_size);
+    }
+    close(fd);
+    return result;
+}
+
+// ---------------- Manifest Writers ----------------
+
+int writeCsvManifest(const VehicleFleet *fleet, const char *path) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        printf("Error: Cannot create %s\n", path);
+        return -1;
+    }
+    fputs(CSV_HEADER, f);
+    for (int i = 0; i < fleet->count; i++) {
+        const Vehicle *v = &fleet->vehicles[i];
+        fprintf(f, "%s,%s,%d,%.2f,%d,%d\n", v->make, v->model, v->year, v->engine_capacity, v->mileage, v->seat);
+    }
+    return fclose(f) == 0 ? 0 : -1;
+}
+
+int writeBinaryManifest(const VehicleFleet *fleet, const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        printf("Error: Cannot create %s\n", path);
+        return -1;
+    }
+    ManifestHeader h = {MANIFEST_MAGIC, MANIFEST_VERSION, (uint32_t)fleet->count, sizeof(Vehicle)};
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1 &&
+             fwrite(fleet->vehicles, sizeof(Vehicle), (size_t)fleet->count, f) == (size_t)fleet->count;
+    return fclose(f) == 0 && ok ? 0 : -1;
+}
+
+// ---------------- Startup Benchmark ----------------
+
+// 08's path: a Vehicle filled by sscanf, copied into createVehicle, copied out of it,
+// copied into addVehicle, and copied again into a fleet that doubles as it goes
+static Vehicle legacyCreateVehicle(Vehicle vehicle) {
+    return vehicle;
+}
+
+static void legacyAddVehicle(VehicleFleet *fleet, Vehicle vehicle) {
+    if (fleet->count == fleet->capacity && fleetReserve(fleet, fleet->capacity ? fleet->capacity * 2 : 16) != 0) return;
+    fleet->vehicles[fleet->count++] = vehicle;
+}
+
+static int legacyLoadCsv(VehicleFleet *fleet, const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        printf("Error: Cannot open manifest %s\n", path);
+        return -1;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), f)) {
+        Vehicle v;
+        memset(&v, 0, sizeof(v));
+        if (sscanf(line, "%49[^,],%49[^,],%d,%f,%d,%d", v.make, v.model, &v.year, &v.engine_capacity, &v.mileage,
+                   &v.seat) == 6) {
+            legacyAddVehicle(fleet, legacyCreateVehicle(v));
+        }
+    }
+    fclose(f);
+    return 0;
+}
+
+// FNV-1a over every field, so fleets loaded different ways can be compared
+static uint64_t fleetChecksum(const VehicleFleet *fleet) {
+    uint64_t h = 1469598103934665603ULL;
+    for (int i = 0; i < fleet->count; i++) {
+        const Vehicle *v = &fleet->vehicles[i];
+        for (const char *s = v->make; *s; s++) h = (h ^ (uint8_t)*s) * 1099511628211ULL;
+        h = (h ^ ',') * 1099511628211ULL;
+        for (const char *s = v->model; *s; s++) h = (h ^ (uint8_t)*s) * 1099511628211ULL;
+        uint32_t bits;
+        memcpy(&bits, &v->engine_capacity, sizeof(bits));
+        uint64_t fields[] = {(uint32_t)v->year, bits, (uint32_t)v->mileage, (uint32_t)v->seat};
+        for (int k = 0; k < 4; k++) h = (h ^ fields[k]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+static void printLoad(const char *label, const ManifestStats *s, double totalMs, uint64_t checksum,
+                      uint64_t expected) {
+    printf("%-26s %8.1f ms (%6.1f MB/s) | %d loaded, %d malformed | %s\n", label, totalMs,
+           s->bytes / 1e6 / (totalMs / 1e3), s->loaded, s->malformed, checksum == expected ? "checksum OK" : "MISMATCH");
+}
+
+static int runStartupBenchmark(int vehicles, int threads) {
+    static const char *makes[] = {"Toyota", "Ford", "Honda", "BMW", "Tesla", "Volvo", "Kia", "Audi"};
+    static const char *models[] = {"Corolla", "Focus", "Civic", "X5", "Model 3", "XC90", "Sportage", "A4"};
+    const char *csvPath = "fleet_manifest_bench.csv";
+    const char *binPath = "fleet_manifest_bench.bin";
+
+    // Source fleet; the CSV holds two decimals, so store what the CSV will say
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+    if (fleetReserve(&fleet, vehicles) != 0) return -1;
+    srand(42);
+    for (int i = 0; i < vehicles; i++) {
+        int m = rand() % 8;
+        char engine[16];
+        snprintf(engine, sizeof(engine), "%.2f", 1.0 + (rand() % 400) / 100.0);
+        addVehicle(&fleet, makes[m], models[(m + rand() % 2) % 8], 2000 + rand() % 25, strtof(engine, NULL),
+                   rand() % 400000, 2 + rand() % 6);
+    }
+    if (writeCsvManifest(&fleet, csvPath) != 0 || writeBinaryManifest(&fleet, binPath) != 0) {
+        fleetFree(&fleet);
+        return -1;
+    }
+    uint64_t expected = fleetChecksum(&fleet);
+    fleetFree(&fleet);
+
+    printf("\n---- Startup Load: %d vehicles, %d threads ----\n", vehicles, threads);
+    struct timespec t0, t1;
+    ManifestStats stats;
+
+    // 08-style: fgets + sscanf + by-value create/add into a doubling array
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    legacyLoadCsv(&fleet, csvPath);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    memset(&stats, 0, sizeof(stats));
+    struct stat st;
+    stats.bytes = stat(csvPath, &st) == 0 ? (size_t)st.st_size : 0;
+    stats.loaded = fleet.count;
+    printLoad("fgets + sscanf + by-value", &stats, elapsedMs(t0, t1), fleetChecksum(&fleet), expected);
+    fleetFree(&fleet);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (loadFleetManifest(&fleet, csvPath, threads, &stats) != 0) return -1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printLoad("bulk CSV, in place", &stats, elapsedMs(t0, t1), fleetChecksum(&fleet), expected);
+    printf("%-26s split + count %.1f ms, parse %.1f ms\n", "", stats.scanMs, stats.parseMs);
+    fleetFree(&fleet);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    if (loadFleetManifest(&fleet, binPath, threads, &stats) != 0) return -1;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printLoad("bulk binary, read in place", &stats, elapsedMs(t0, t1), fleetChecksum(&fleet), expected);
+    fleetFree(&fleet);
+
+    unlink(csvPath);
+    unlink(binPath);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = argc > 2 ? atoi(argv[2]) : (cpus > 1 ? (int)cpus : 4);
+
+    if (argc > 1) {
+        VehicleFleet fleet;
+        ManifestStats stats;
+        fleetInit(&fleet);
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        if (loadFleetManifest(&fleet, argv[1], threads, &stats) != 0) return 1;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        printf("Loaded %d of %d %s rows from %s in %.1f ms with %d threads (%d malformed)\n", stats.loaded, stats.rows,
+               stats.format == MANIFEST_BINARY ? "binary" : "CSV", argv[1], elapsedMs(t0, t1), stats.threads,
+               stats.malformed);
+        if (fleet.count > 0) {
+            printf("First vehicle:\n");
+            printVehicle(&fleet.vehicles[0]);
+        }
+        fleetFree(&fleet);
+        return 0;
+    }
+
+    // 08's demo on the in-place API
+    VehicleFleet fleet;
+    fleetInit(&fleet);
+    fleetReserve(&fleet, 5);
+    addVehicle(&fleet, "Toyota", "Corolla", 2020, 1.8, 15000, 4);
+    addVehicle(&fleet, "Ford", "Focus", 2019, 2.0, 20000, 3);
+    addVehicle(&fleet, "Honda", "Civic", 2021, 1.5, 5000, 2);
+
+    printf("Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+
+    int index = findVehicleIndex(&fleet, "Ford", "Focus");
+    if (index != -1) {
+        printf("\nFound vehicle: %s %s\n", "Ford", "Focus");
+        printVehicle(&fleet.vehicles[index]);
+    } else {
+        printf("\nVehicle not found: %s %s\n", "Ford", "Focus");
+    }
+
+    if (removeVehicle(&fleet, "Toyota", "Corolla") == 0) {
+        printf("\nVehicle removed successfully!\n");
+    } else {
+        printf("\nError: Vehicle not found for removal.\n");
+    }
+    printf("\nUpdated Fleet of Vehicles:\n");
+    displayFleet(&fleet);
+    fleetFree(&fleet);
+
+    return runStartupBenchmark(1000000, threads) != 0;
+}